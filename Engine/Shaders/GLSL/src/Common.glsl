@@ -1,4 +1,4 @@
-#define MAX_LIGHTS_PER_FRAME 32
+#define MAX_LIGHTS_PER_FRAME 128
 #define MAX_LIGHTS_PER_DRAW 8
 #define MAX_TEXTURES 4
 
@@ -95,6 +95,7 @@ struct LightData
 struct MeshInstanceData
 {
     mat4 mTransform;
+    uint mInstanceIndex;
 };
 
 struct GlobalUniforms
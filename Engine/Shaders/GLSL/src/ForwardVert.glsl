@@ -59,6 +59,6 @@ void main()
     outColor = vec4(1.0, 1.0, 1.0, 1.0);
 
 #if INSTANCED_DRAW
-    outInstanceIndex = gl_InstanceIndex;
+    outInstanceIndex = instanceData[gl_InstanceIndex].mInstanceIndex;
 #endif
 }
@@ -59,6 +59,6 @@ void main()
     outColor = SrgbToLinear(inColor);
 
 #if INSTANCED_DRAW
-    outInstanceIndex = gl_InstanceIndex;
+    outInstanceIndex = instanceData[gl_InstanceIndex].mInstanceIndex;
 #endif
 }
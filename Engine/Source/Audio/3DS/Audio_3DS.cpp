@@ -13,6 +13,10 @@
 static float sSampleRates[AUDIO_MAX_VOICES] = {};
 static ndspWaveBuf sWaveBufs[AUDIO_MAX_VOICES] = {};
 
+static ndspWaveBuf sStreamWaveBufs[AUDIO_MAX_VOICES][AUDIO_STREAM_BUFFERS] = {};
+static uint32_t sStreamNextBuf[AUDIO_MAX_VOICES] = {};
+static uint32_t sStreamChannels[AUDIO_MAX_VOICES] = {};
+
 void AUD_Initialize()
 {
 #if USE_DSP
@@ -98,6 +102,7 @@ void AUD_Stop(uint32_t voiceIndex)
 {
     //ndspChnSetPaused(voiceIndex, true);
     ndspChnWaveBufClear(voiceIndex);
+    memset(sStreamWaveBufs[voiceIndex], 0, sizeof(sStreamWaveBufs[voiceIndex]));
     
     //ndspChnReset(voiceIndex);
 }
@@ -126,6 +131,68 @@ void AUD_SetPitch(uint32_t voiceIndex, float pitch)
     ndspChnSetRate(voiceIndex, pitchHz);
 }
 
+void AUD_PlayStream(uint32_t voiceIndex, PcmFormat format, float volume, float pitch, bool spatial)
+{
+    OCT_ASSERT(format.mBytesPerSample == 2);
+
+    sSampleRates[voiceIndex] = (float)format.mSampleRate;
+    sStreamChannels[voiceIndex] = format.mNumChannels;
+    sStreamNextBuf[voiceIndex] = 0;
+    memset(sStreamWaveBufs[voiceIndex], 0, sizeof(sStreamWaveBufs[voiceIndex]));
+
+    ndspChnReset(voiceIndex);
+    ndspChnSetInterp(voiceIndex, NDSP_INTERP_LINEAR);
+    ndspChnSetRate(voiceIndex, format.mSampleRate * pitch);
+    ndspChnSetFormat(voiceIndex, (format.mNumChannels == 2) ? NDSP_FORMAT_STEREO_PCM16 : NDSP_FORMAT_MONO_PCM16);
+
+    float mix[12];
+    memset(mix, 0, sizeof(mix));
+    mix[0] = spatial ? 0.0f : volume;
+    mix[1] = spatial ? 0.0f : volume;
+    ndspChnSetMix(voiceIndex, mix);
+}
+
+static bool IsWaveBufQueued(const ndspWaveBuf& waveBuf)
+{
+    return waveBuf.status == NDSP_WBUF_QUEUED || waveBuf.status == NDSP_WBUF_PLAYING;
+}
+
+bool AUD_QueueStreamBuffer(uint32_t voiceIndex, uint8_t* data, uint32_t size)
+{
+    ndspWaveBuf& waveBuf = sStreamWaveBufs[voiceIndex][sStreamNextBuf[voiceIndex]];
+
+    if (IsWaveBufQueued(waveBuf))
+    {
+        return false;
+    }
+
+    DSP_FlushDataCache(data, size);
+
+    waveBuf = {};
+    waveBuf.data_vaddr = data;
+    waveBuf.nsamples = size / (sStreamChannels[voiceIndex] * 2);
+    waveBuf.looping = false;
+    ndspChnWaveBufAdd(voiceIndex, &waveBuf);
+
+    sStreamNextBuf[voiceIndex] = (sStreamNextBuf[voiceIndex] + 1) % AUDIO_STREAM_BUFFERS;
+    return true;
+}
+
+uint32_t AUD_GetNumQueuedStreamBuffers(uint32_t voiceIndex)
+{
+    uint32_t numQueued = 0;
+
+    for (uint32_t i = 0; i < AUDIO_STREAM_BUFFERS; ++i)
+    {
+        if (IsWaveBufQueued(sStreamWaveBufs[voiceIndex][i]))
+        {
+            ++numQueued;
+        }
+    }
+
+    return numQueued;
+}
+
 uint8_t* AUD_AllocWaveBuffer(uint32_t size)
 {
     return (uint8_t*)linearAlloc(size);
@@ -129,7 +129,7 @@ void AUD_Initialize()
         // Now to create buffer queues for loading sound to be played.
         SLDataLocator_AndroidSimpleBufferQueue dataLocatorIn;
         dataLocatorIn.locatorType = SL_DATALOCATOR_ANDROIDSIMPLEBUFFERQUEUE;
-        dataLocatorIn.numBuffers = 1;
+        dataLocatorIn.numBuffers = AUDIO_STREAM_BUFFERS;
 
         SLDataFormat_PCM dataFormat;
         dataFormat.formatType = SL_DATAFORMAT_PCM;
@@ -407,6 +407,47 @@ void AUD_SetPitch(uint32_t voiceIndex, float pitch)
 
 }
 
+void AUD_PlayStream(uint32_t voiceIndex, PcmFormat format, float volume, float pitch, bool spatial)
+{
+    // Players are created for 2 channel, 16 bit, 44100 Hz audio. Streams are converted while decoding.
+    OCT_ASSERT(format.mNumChannels == 2 && format.mBytesPerSample == 2 && format.mSampleRate == 44100);
+
+    SLresult result = (*(sBufferQueues[voiceIndex]))->Clear(sBufferQueues[voiceIndex]);
+
+    if (result != SL_RESULT_SUCCESS)
+    {
+        LogError("Error clearing player queue.");
+        return;
+    }
+
+    sLoop[voiceIndex] = false;
+    sSoundData[voiceIndex] = nullptr;
+    sSoundSizes[voiceIndex] = 0;
+
+    AUD_SetVolume(voiceIndex, spatial ? 0.0f : volume, spatial ? 0.0f : volume);
+    AUD_SetPitch(voiceIndex, pitch);
+}
+
+bool AUD_QueueStreamBuffer(uint32_t voiceIndex, uint8_t* data, uint32_t size)
+{
+    SLresult result = (*(sBufferQueues[voiceIndex]))->Enqueue(sBufferQueues[voiceIndex], data, size);
+    return (result == SL_RESULT_SUCCESS);
+}
+
+uint32_t AUD_GetNumQueuedStreamBuffers(uint32_t voiceIndex)
+{
+    uint32_t numQueued = 0;
+    SLBufferQueueState queueState;
+    SLresult result = (*(sBufferQueues[voiceIndex]))->GetState(sBufferQueues[voiceIndex], &queueState);
+
+    if (result == SL_RESULT_SUCCESS)
+    {
+        numQueued = uint32_t(queueState.count);
+    }
+
+    return numQueued;
+}
+
 uint8_t* AUD_AllocWaveBuffer(uint32_t size)
 {
     return (uint8_t*)SYS_AlignedMalloc(size, 32);
@@ -12,6 +12,9 @@
 
 #include <vorbis/vorbisenc.h>
 
+#define OV_EXCLUDE_STATIC_CALLBACKS
+#include <vorbis/vorbisfile.h>
+
 // Most of this vorbis encoding / decoding code was taken from the official libvorbis samples.
 
 #define READ 1024
@@ -483,3 +486,111 @@ void AUD_DecodeVorbis(Stream& inStream, Stream& outStream, PcmFormat format)
     LogDebug("Decoded Vorbis: %d bytes -> %d bytes", inStream.GetSize(), outStream.GetSize());
 }
 
+struct VorbisStream
+{
+    OggVorbis_File mFile;
+    const uint8_t* mData = nullptr;
+    uint32_t mSize = 0;
+    uint32_t mPos = 0;
+};
+
+static size_t VorbisStreamRead(void* ptr, size_t size, size_t nmemb, void* datasource)
+{
+    VorbisStream* stream = (VorbisStream*)datasource;
+    size_t bytes = glm::min<size_t>(size * nmemb, stream->mSize - stream->mPos);
+    memcpy(ptr, stream->mData + stream->mPos, bytes);
+    stream->mPos += uint32_t(bytes);
+    return (size > 0) ? (bytes / size) : 0;
+}
+
+static int VorbisStreamSeek(void* datasource, ogg_int64_t offset, int whence)
+{
+    VorbisStream* stream = (VorbisStream*)datasource;
+    ogg_int64_t pos = offset;
+
+    if (whence == SEEK_CUR)
+    {
+        pos += stream->mPos;
+    }
+    else if (whence == SEEK_END)
+    {
+        pos += stream->mSize;
+    }
+
+    if (pos < 0 || pos > stream->mSize)
+    {
+        return -1;
+    }
+
+    stream->mPos = uint32_t(pos);
+    return 0;
+}
+
+static long VorbisStreamTell(void* datasource)
+{
+    VorbisStream* stream = (VorbisStream*)datasource;
+    return (long)stream->mPos;
+}
+
+VorbisStream* AUD_OpenVorbisStream(const uint8_t* data, uint32_t size)
+{
+    VorbisStream* stream = new VorbisStream();
+    stream->mData = data;
+    stream->mSize = size;
+
+    ov_callbacks callbacks = {};
+    callbacks.read_func = VorbisStreamRead;
+    callbacks.seek_func = VorbisStreamSeek;
+    callbacks.close_func = nullptr;
+    callbacks.tell_func = VorbisStreamTell;
+
+    if (ov_open_callbacks(stream, &stream->mFile, nullptr, 0, callbacks) != 0)
+    {
+        LogError("Failed to open Vorbis stream.");
+        delete stream;
+        stream = nullptr;
+    }
+
+    return stream;
+}
+
+void AUD_CloseVorbisStream(VorbisStream* stream)
+{
+    if (stream != nullptr)
+    {
+        ov_clear(&stream->mFile);
+        delete stream;
+    }
+}
+
+uint32_t AUD_ReadVorbisStream(VorbisStream* stream, uint8_t* dst, uint32_t size)
+{
+    uint32_t totalBytes = 0;
+
+    // ov_read() returns at most one packet of data per call.
+    while (totalBytes < size)
+    {
+        int bitstream = 0;
+        long bytes = ov_read(&stream->mFile, (char*)(dst + totalBytes), int(size - totalBytes), 0, 2, 1, &bitstream);
+
+        if (bytes == OV_HOLE)
+        {
+            // Interruption in the data. Skip over it and keep decoding.
+            continue;
+        }
+        else if (bytes <= 0)
+        {
+            // End of stream or unrecoverable error.
+            break;
+        }
+
+        totalBytes += uint32_t(bytes);
+    }
+
+    return totalBytes;
+}
+
+bool AUD_SeekVorbisStream(VorbisStream* stream, uint32_t frame)
+{
+    return ov_pcm_seek(&stream->mFile, (ogg_int64_t)frame) == 0;
+}
@@ -5,6 +5,7 @@
 class Stream;
 class SoundWave;
 class Audio3D;
+struct VorbisStream;
 
 struct PcmFormat
 {
@@ -31,6 +32,12 @@ bool AUD_IsPlaying(uint32_t voiceIndex);
 void AUD_SetVolume(uint32_t voiceIndex, float leftVolume, float rightVolume);
 void AUD_SetPitch(uint32_t voiceIndex, float pitch);
 
+// Streaming voices play PCM buffers in the order they are queued. Buffers must stay valid
+// until they are no longer counted by AUD_GetNumQueuedStreamBuffers(). Stopped with AUD_Stop().
+void AUD_PlayStream(uint32_t voiceIndex, PcmFormat format, float volume, float pitch, bool spatial);
+bool AUD_QueueStreamBuffer(uint32_t voiceIndex, uint8_t* data, uint32_t size);
+uint32_t AUD_GetNumQueuedStreamBuffers(uint32_t voiceIndex);
+
 uint8_t* AUD_AllocWaveBuffer(uint32_t size);
 void AUD_FreeWaveBuffer(void* buffer);
 void AUD_ProcessWaveBuffer(SoundWave* soundWave);
@@ -38,3 +45,10 @@ void AUD_ProcessWaveBuffer(SoundWave* soundWave);
 // Platform Independent
 void AUD_EncodeVorbis(Stream& inStream, Stream& outStream, PcmFormat format);
 void AUD_DecodeVorbis(Stream& inStream, Stream& outStream, PcmFormat format);
+
+// Incremental decoding of Ogg Vorbis data held in memory. Output is interleaved 16 bit little endian PCM.
+// The data must outlive the VorbisStream.
+VorbisStream* AUD_OpenVorbisStream(const uint8_t* data, uint32_t size);
+void AUD_CloseVorbisStream(VorbisStream* stream);
+uint32_t AUD_ReadVorbisStream(VorbisStream* stream, uint8_t* dst, uint32_t size);
+bool AUD_SeekVorbisStream(VorbisStream* stream, uint32_t frame);
@@ -10,4 +10,26 @@
 #define AUDIO_MAX_VOICES 8
 #elif PLATFORM_3DS
 #define AUDIO_MAX_VOICES 8
-#endif
\ No newline at end of file
+#endif
+
+// Streaming voices cycle through a small ring of decoded PCM buffers.
+// ASND can only hold the playing buffer plus one pending buffer per voice.
+#if PLATFORM_DOLPHIN
+#define AUDIO_STREAM_BUFFERS 2
+#define AUDIO_STREAM_BUFFER_SIZE (32 * 1024)
+#else
+#define AUDIO_STREAM_BUFFERS 4
+#define AUDIO_STREAM_BUFFER_SIZE (16 * 1024)
+#endif
+
+// Output format restrictions of the platform voices. Streamed audio is converted while decoding.
+#if PLATFORM_WINDOWS
+#define AUDIO_STREAM_STEREO_ONLY 1
+#define AUDIO_STREAM_44100_ONLY 0
+#elif PLATFORM_ANDROID
+#define AUDIO_STREAM_STEREO_ONLY 1
+#define AUDIO_STREAM_44100_ONLY 1
+#else
+#define AUDIO_STREAM_STEREO_ONLY 0
+#define AUDIO_STREAM_44100_ONLY 0
+#endif
@@ -13,6 +13,11 @@
 
 static int32_t sSampleRates[AUDIO_MAX_VOICES] = {};
 
+// Streaming voice state needed to restart the voice if it runs dry.
+static int32_t sStreamFormats[AUDIO_MAX_VOICES] = {};
+static int32_t sStreamPitches[AUDIO_MAX_VOICES] = {};
+static int32_t sStreamVolumes[AUDIO_MAX_VOICES][2] = {};
+
 void AUD_Initialize()
 {
     ASND_Init();
@@ -105,12 +110,72 @@ void AUD_SetVolume(uint32_t voiceIndex, float leftVolume, float rightVolume)
     int32_t leftVolInt = int32_t(MID_VOLUME * leftVolume);
     int32_t rightVolInt = int32_t(MID_VOLUME * rightVolume);
     ASND_ChangeVolumeVoice(voiceIndex, leftVolInt, rightVolInt);
+
+    sStreamVolumes[voiceIndex][0] = leftVolInt;
+    sStreamVolumes[voiceIndex][1] = rightVolInt;
 }
 
 void AUD_SetPitch(uint32_t voiceIndex, float pitch)
 {
     int32_t pitchHz = int32_t(pitch * sSampleRates[voiceIndex]);
     ASND_ChangePitchVoice(voiceIndex, pitchHz);
+
+    sStreamPitches[voiceIndex] = pitchHz;
+}
+
+void AUD_PlayStream(uint32_t voiceIndex, PcmFormat format, float volume, float pitch, bool spatial)
+{
+    OCT_ASSERT(format.mBytesPerSample == 2);
+
+    int32_t volumeInt = spatial ? 0 : int32_t(volume * MID_VOLUME);
+
+    sSampleRates[voiceIndex] = format.mSampleRate;
+    sStreamFormats[voiceIndex] = (format.mNumChannels == 2) ? VOICE_STEREO_16BIT_LE : VOICE_MONO_16BIT_LE;
+    sStreamPitches[voiceIndex] = int32_t(format.mSampleRate * pitch);
+    sStreamVolumes[voiceIndex][0] = volumeInt;
+    sStreamVolumes[voiceIndex][1] = volumeInt;
+
+    // The voice is started once the first buffer is queued.
+    ASND_StopVoice(voiceIndex);
+}
+
+bool AUD_QueueStreamBuffer(uint32_t voiceIndex, uint8_t* data, uint32_t size)
+{
+    bool queued = false;
+
+    if (ASND_StatusVoice(voiceIndex) == SND_UNUSED)
+    {
+        // Either the first buffer or the voice was starved, (re)start it.
+        queued = ASND_SetVoice(
+            voiceIndex,
+            sStreamFormats[voiceIndex],
+            sStreamPitches[voiceIndex],
+            0,
+            data,
+            size,
+            sStreamVolumes[voiceIndex][0],
+            sStreamVolumes[voiceIndex][1],
+            nullptr) == SND_OK;
+    }
+    else if (ASND_TestVoiceBufferReady(voiceIndex))
+    {
+        queued = ASND_AddVoice(voiceIndex, data, size) == SND_OK;
+    }
+
+    return queued;
+}
+
+uint32_t AUD_GetNumQueuedStreamBuffers(uint32_t voiceIndex)
+{
+    uint32_t numQueued = 0;
+
+    if (ASND_StatusVoice(voiceIndex) != SND_UNUSED)
+    {
+        // ASND holds the playing buffer plus at most one pending buffer.
+        numQueued = ASND_TestVoiceBufferReady(voiceIndex) ? 1 : 2;
+    }
+
+    return numQueued;
 }
 
 uint8_t* AUD_AllocWaveBuffer(uint32_t size)
@@ -1,4 +1,4 @@
-#if PLATFORM_LINUX
+#if PLATFORM_LINUX && !DEDICATED_SERVER
 
 #include "Audio/Audio.h"
 #include "Audio/AudioConstants.h"
@@ -29,10 +29,48 @@ struct SoundVoice
     uint32_t mBytesPerSample = 2;
     bool mLoop = false;
     bool mActive = false;
+
+    // Streaming voices read 16 bit frames from a queue of buffers instead of mSrcBuffer.
+    // mCurFrame is relative to the start of the oldest queued buffer.
+    bool mStreaming = false;
+    uint8_t* mStreamBuffers[AUDIO_STREAM_BUFFERS] = {};
+    uint32_t mStreamBufferFrames[AUDIO_STREAM_BUFFERS] = {};
+    uint32_t mStreamHead = 0;
+    uint32_t mNumStreamBuffers = 0;
 };
 
 static SoundVoice sVoices[AUDIO_MAX_VOICES];
 
+static void GetStreamFrame(const SoundVoice& voice, uint32_t frame, int16_t& outLeft, int16_t& outRight)
+{
+    outLeft = 0;
+    outRight = 0;
+
+    for (uint32_t b = 0; b < voice.mNumStreamBuffers; ++b)
+    {
+        uint32_t index = (voice.mStreamHead + b) % AUDIO_STREAM_BUFFERS;
+
+        if (frame < voice.mStreamBufferFrames[index])
+        {
+            const int16_t* samples = (const int16_t*)voice.mStreamBuffers[index];
+
+            if (voice.mNumChannels == 1)
+            {
+                outLeft = samples[frame];
+                outRight = outLeft;
+            }
+            else
+            {
+                outLeft = samples[frame * 2 + 0];
+                outRight = samples[frame * 2 + 1];
+            }
+            break;
+        }
+
+        frame -= voice.mStreamBufferFrames[index];
+    }
+}
+
 void AUD_Initialize()
 {
     int err = snd_pcm_open( &sSoundDevice, "default", SND_PCM_STREAM_PLAYBACK, 0 );
@@ -130,7 +168,7 @@ void AUD_Update()
             if (sVoices[i].mActive)
             {
                 SoundVoice& voice = sVoices[i];
-                OCT_ASSERT(voice.mSrcFrames > 0);
+                OCT_ASSERT(voice.mStreaming || voice.mSrcFrames > 0);
 
                 // If the voice is active, that means we need to mix *frames* number of frames
                 // into the mix buffer. The src voice may move at a faster or slower pace based on the 
@@ -162,7 +200,11 @@ void AUD_Update()
                     {
                         int32_t frameIndex = srcFrames[f];
 
-                        if (frameIndex >= int32_t(voice.mSrcFrames))
+                        if (voice.mStreaming)
+                        {
+                            GetStreamFrame(voice, uint32_t(frameIndex), srcSampleL[f], srcSampleR[f]);
+                        }
+                        else if (frameIndex >= int32_t(voice.mSrcFrames))
                         {
                             srcSampleL[f] = 0;
                             srcSampleR[f] = 0;
@@ -223,7 +265,24 @@ void AUD_Update()
 
                 voice.mCurFrame += (frames * srcDeltaFrame);
 
-                if (voice.mLoop)
+                if (voice.mStreaming)
+                {
+                    // Release the buffers that have been fully consumed.
+                    while (voice.mNumStreamBuffers > 0 &&
+                        voice.mCurFrame >= voice.mStreamBufferFrames[voice.mStreamHead])
+                    {
+                        voice.mCurFrame -= voice.mStreamBufferFrames[voice.mStreamHead];
+                        voice.mStreamHead = (voice.mStreamHead + 1) % AUDIO_STREAM_BUFFERS;
+                        voice.mNumStreamBuffers--;
+                    }
+
+                    if (voice.mNumStreamBuffers == 0)
+                    {
+                        // Starved. Resume from the start of the next buffer that gets queued.
+                        voice.mCurFrame = 0.0f;
+                    }
+                }
+                else if (voice.mLoop)
                 {
                     voice.mCurFrame = fmod(voice.mCurFrame, (float) voice.mSrcFrames);
                 }
@@ -258,6 +317,7 @@ void AUD_Play(
     OCT_ASSERT(!sVoices[voiceIndex].mActive);
 
     sVoices[voiceIndex].mActive = true;
+    sVoices[voiceIndex].mStreaming = false;
     sVoices[voiceIndex].mBytesPerSample = soundWave->GetBitsPerSample() / 8;
     sVoices[voiceIndex].mCurFrame = 0.0f;
     sVoices[voiceIndex].mLoop = loop;
@@ -280,12 +340,14 @@ void AUD_Play(
 void AUD_Stop(uint32_t voiceIndex)
 {
     sVoices[voiceIndex].mActive = false;
+    sVoices[voiceIndex].mStreaming = false;
+    sVoices[voiceIndex].mNumStreamBuffers = 0;
 }
 
 bool AUD_IsPlaying(uint32_t voiceIndex)
 {
     return sVoices[voiceIndex].mActive &&
-           sVoices[voiceIndex].mCurFrame < sVoices[voiceIndex].mSrcFrames;
+           (sVoices[voiceIndex].mStreaming || sVoices[voiceIndex].mCurFrame < sVoices[voiceIndex].mSrcFrames);
 }
 
 void AUD_SetVolume(uint32_t voiceIndex, float leftVolume, float rightVolume)
@@ -299,6 +361,52 @@ void AUD_SetPitch(uint32_t voiceIndex, float pitch)
     sVoices[voiceIndex].mPitch = pitch;
 }
 
+void AUD_PlayStream(uint32_t voiceIndex, PcmFormat format, float volume, float pitch, bool spatial)
+{
+    OCT_ASSERT(!sVoices[voiceIndex].mActive);
+    OCT_ASSERT(format.mBytesPerSample == 2);
+
+    SoundVoice& voice = sVoices[voiceIndex];
+    voice.mActive = true;
+    voice.mStreaming = true;
+    voice.mBytesPerSample = format.mBytesPerSample;
+    voice.mCurFrame = 0.0f;
+    voice.mLoop = false;
+    voice.mNumChannels = format.mNumChannels;
+    voice.mPitch = pitch;
+    voice.mSampleRate = format.mSampleRate;
+    voice.mSrcBuffer = nullptr;
+    voice.mSrcBufferLen = 0;
+    voice.mSrcFrames = 0;
+    voice.mVolumeL = spatial ? 0.0f : volume;
+    voice.mVolumeR = spatial ? 0.0f : volume;
+    voice.mStreamHead = 0;
+    voice.mNumStreamBuffers = 0;
+}
+
+bool AUD_QueueStreamBuffer(uint32_t voiceIndex, uint8_t* data, uint32_t size)
+{
+    SoundVoice& voice = sVoices[voiceIndex];
+    OCT_ASSERT(voice.mStreaming);
+
+    if (voice.mNumStreamBuffers >= AUDIO_STREAM_BUFFERS)
+    {
+        return false;
+    }
+
+    uint32_t index = (voice.mStreamHead + voice.mNumStreamBuffers) % AUDIO_STREAM_BUFFERS;
+    voice.mStreamBuffers[index] = data;
+    voice.mStreamBufferFrames[index] = size / (voice.mNumChannels * voice.mBytesPerSample);
+    voice.mNumStreamBuffers++;
+
+    return true;
+}
+
+uint32_t AUD_GetNumQueuedStreamBuffers(uint32_t voiceIndex)
+{
+    return sVoices[voiceIndex].mNumStreamBuffers;
+}
+
 uint8_t* AUD_AllocWaveBuffer(uint32_t size)
 {
     return (uint8_t*)SYS_AlignedMalloc(size, 32);
@@ -0,0 +1,86 @@
+#if DEDICATED_SERVER
+
+// Audio backend for headless builds. No device is opened and voices never play, but wave
+// buffers are still allocated so sound assets load the same way they do on clients.
+
+#include "Audio/Audio.h"
+#include "System/System.h"
+
+void AUD_Initialize()
+{
+
+}
+
+void AUD_Shutdown()
+{
+
+}
+
+void AUD_Update()
+{
+
+}
+
+void AUD_Play(
+    uint32_t voiceIndex,
+    SoundWave* soundWave,
+    float volume,
+    float pitch,
+    bool loop,
+    float startTime,
+    bool spatial)
+{
+
+}
+
+void AUD_Stop(uint32_t voiceIndex)
+{
+
+}
+
+bool AUD_IsPlaying(uint32_t voiceIndex)
+{
+    return false;
+}
+
+void AUD_SetVolume(uint32_t voiceIndex, float leftVolume, float rightVolume)
+{
+
+}
+
+void AUD_SetPitch(uint32_t voiceIndex, float pitch)
+{
+
+}
+
+void AUD_PlayStream(uint32_t voiceIndex, PcmFormat format, float volume, float pitch, bool spatial)
+{
+
+}
+
+bool AUD_QueueStreamBuffer(uint32_t voiceIndex, uint8_t* data, uint32_t size)
+{
+    return false;
+}
+
+uint32_t AUD_GetNumQueuedStreamBuffers(uint32_t voiceIndex)
+{
+    return 0;
+}
+
+uint8_t* AUD_AllocWaveBuffer(uint32_t size)
+{
+    return (uint8_t*)SYS_AlignedMalloc(size, 32);
+}
+
+void AUD_FreeWaveBuffer(void* buffer)
+{
+    SYS_AlignedFree(buffer);
+}
+
+void AUD_ProcessWaveBuffer(SoundWave* soundWave)
+{
+
+}
+
+#endif
@@ -183,6 +183,63 @@ void AUD_SetPitch(uint32_t voiceIndex, float pitch)
     sSourceVoices[voiceIndex]->SetFrequencyRatio(pitch);
 }
 
+void AUD_PlayStream(uint32_t voiceIndex, PcmFormat format, float volume, float pitch, bool spatial)
+{
+    OCT_ASSERT(sSourceVoices[voiceIndex] == nullptr);
+
+    // Streams are decoded to stereo so that left/right channel volumes can be applied.
+    OCT_ASSERT(format.mNumChannels == 2);
+
+    WAVEFORMATEX waveFormat = {};
+    waveFormat.wFormatTag = WAVE_FORMAT_PCM;
+    waveFormat.nChannels = (WORD)format.mNumChannels;
+    waveFormat.nSamplesPerSec = format.mSampleRate;
+    waveFormat.wBitsPerSample = (WORD)(format.mBytesPerSample * 8);
+    waveFormat.nBlockAlign = (WORD)(format.mNumChannels * format.mBytesPerSample);
+    waveFormat.nAvgBytesPerSec = format.mSampleRate * waveFormat.nBlockAlign;
+    waveFormat.cbSize = 0;
+
+    if (sXAudio2->CreateSourceVoice(&sSourceVoices[voiceIndex], &waveFormat) >= 0)
+    {
+        sSourceVoices[voiceIndex]->SetVolume(spatial ? 0.0f : volume);
+        sSourceVoices[voiceIndex]->SetFrequencyRatio(pitch);
+        sSourceVoices[voiceIndex]->Start();
+    }
+    else
+    {
+        LogError("Error creating XAUDIO2 source voice");
+        OCT_ASSERT(0);
+    }
+}
+
+bool AUD_QueueStreamBuffer(uint32_t voiceIndex, uint8_t* data, uint32_t size)
+{
+    if (sSourceVoices[voiceIndex] == nullptr)
+    {
+        return false;
+    }
+
+    XAUDIO2_BUFFER buffer = {};
+    buffer.AudioBytes = size;
+    buffer.pAudioData = data;
+
+    return sSourceVoices[voiceIndex]->SubmitSourceBuffer(&buffer) >= 0;
+}
+
+uint32_t AUD_GetNumQueuedStreamBuffers(uint32_t voiceIndex)
+{
+    uint32_t numQueued = 0;
+
+    if (sSourceVoices[voiceIndex] != nullptr)
+    {
+        XAUDIO2_VOICE_STATE state;
+        sSourceVoices[voiceIndex]->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+        numQueued = state.BuffersQueued;
+    }
+
+    return numQueued;
+}
+
 uint8_t* AUD_AllocWaveBuffer(uint32_t size)
 {
     return (uint8_t*)SYS_AlignedMalloc(size, 32);
@@ -32,6 +32,8 @@
 #include "Assets/Font.h"
 #include "AssetDir.h"
 #include "EmbeddedFile.h"
+#include "CookCache.h"
+#include "Profiler.h"
 #include "Utilities.h"
 #include "EditorUtils.h"
 #include "EditorImgui.h"
@@ -63,6 +65,95 @@
 
 ActionManager* ActionManager::sInstance = nullptr;
 
+enum class CookJobType
+{
+    Hash,
+    Cook
+};
+
+struct CookJob
+{
+    Asset* mAsset = nullptr;
+    std::string mSourcePath;
+    std::string mCookedPath;
+    uint64_t mSourceHash = 0;
+    std::vector<std::string> mDependencies;
+    bool mSaved = false;
+};
+
+struct CookJobQueue
+{
+    std::vector<CookJob>* mJobs = nullptr;
+    CookJobType mType = CookJobType::Hash;
+    Platform mPlatform = Platform::Count;
+    uint32_t mNextJob = 0;
+    MutexObject* mMutex = nullptr;
+};
+
+static ThreadFuncRet CookThreadFunc(void* arg)
+{
+    CookJobQueue* queue = (CookJobQueue*)arg;
+
+    while (true)
+    {
+        CookJob* job = nullptr;
+
+        {
+            SCOPED_LOCK(queue->mMutex);
+            if (queue->mNextJob < queue->mJobs->size())
+            {
+                job = &(*queue->mJobs)[queue->mNextJob];
+                queue->mNextJob++;
+            }
+        }
+
+        if (job == nullptr)
+        {
+            break;
+        }
+
+        if (queue->mType == CookJobType::Hash)
+        {
+            job->mSourceHash = CookCache::HashFile(job->mSourcePath);
+        }
+        else
+        {
+            job->mSaved = job->mAsset->SaveFile(job->mCookedPath.c_str(), queue->mPlatform, &job->mDependencies);
+        }
+    }
+
+    THREAD_RETURN();
+}
+
+static void RunCookJobs(std::vector<CookJob>& jobs, CookJobType type, Platform platform)
+{
+    if (jobs.size() == 0)
+        return;
+
+    CookJobQueue queue;
+    queue.mJobs = &jobs;
+    queue.mType = type;
+    queue.mPlatform = platform;
+    queue.mMutex = SYS_CreateMutex();
+
+    uint32_t numThreads = glm::min<uint32_t>(NUM_COOK_THREADS, uint32_t(jobs.size()));
+    std::vector<ThreadObject*> threads;
+
+    for (uint32_t i = 0; i < numThreads; ++i)
+    {
+        threads.push_back(SYS_CreateThread(CookThreadFunc, &queue));
+    }
+
+    for (uint32_t i = 0; i < threads.size(); ++i)
+    {
+        SYS_JoinThread(threads[i]);
+        SYS_DestroyThread(threads[i]);
+    }
+
+    SYS_DestroyMutex(queue.mMutex);
+    queue.mMutex = nullptr;
+}
+
 TypeId CheckDaeAssetType(const char* path)
 {
     TypeId retType = 0;
@@ -122,6 +213,7 @@ void ActionManager::BuildData(Platform platform, bool embedded)
     const std::string& projectName = engineState->mProjectName;
 
     std::vector<std::pair<AssetStub*, std::string> > embeddedAssets;
+    std::vector<std::pair<AssetStub*, std::string> > cookedAssets;
 
     if (projectDir == "")
     {
@@ -130,7 +222,8 @@ void ActionManager::BuildData(Platform platform, bool embedded)
     }
 
     // Build Data is responsible for 3 things
-    // (1) Create a Packaged directory in ProjectDir/Packaged. Erase previous packaged first.
+    // (1) Create a Packaged directory in ProjectDir/Packaged. Previously cooked assets are kept
+    // and only re-cooked when their source data changes.
     std::string packagedDir = projectDir + "Packaged/";
 
     // Create top level Packaged dir first.
@@ -139,15 +232,28 @@ void ActionManager::BuildData(Platform platform, bool embedded)
         CreateDir(packagedDir.c_str());
     }
 
-    // Create platform-specific packaged dir. Delete old platform dir if it exists.
+    // Create platform-specific packaged dir.
     packagedDir += GetPlatformString(platform);
     packagedDir += "/";
-    if (DoesDirExist(packagedDir.c_str()))
+    if (!DoesDirExist(packagedDir.c_str()))
     {
-        RemoveDir(packagedDir.c_str());
+        CreateDir(packagedDir.c_str());
     }
 
-    CreateDir(packagedDir.c_str());
+    // Copied folders are refreshed every build.
+    RemoveDir((packagedDir + "Engine/Scripts").c_str());
+    RemoveDir((packagedDir + projectName + "/Scripts").c_str());
+    RemoveDir((packagedDir + "Engine/Shaders/GLSL/bin").c_str());
+
+    std::string intermediateDir = projectDir + "Intermediate";
+    if (!DoesDirExist(intermediateDir.c_str()))
+    {
+        CreateDir(intermediateDir.c_str());
+    }
+
+    std::string cookCachePath = intermediateDir + "/CookCache_" + GetPlatformString(platform) + ".bin";
+    CookCache cookCache;
+    cookCache.Load(cookCachePath);
 
     // (2) Iterate over AssetDirs and save each file (platform-specific save) to the Packaged folder.
     std::function<void(AssetDir*, bool)> saveDir = [&](AssetDir* dir, bool engine)
@@ -169,25 +275,11 @@ void ActionManager::BuildData(Platform platform, bool embedded)
             CreateDir(packDir.c_str());
         }
 
-        // Cook the assets into our packaged folder
+        // Gather the assets to cook into our packaged folder
         for (uint32_t i = 0; i < dir->mAssetStubs.size(); ++i)
         {
             AssetStub* stub = dir->mAssetStubs[i];
-            bool alreadyLoaded = (stub->mAsset != nullptr);
-
-            if (!alreadyLoaded)
-            {
-                AssetManager::Get()->LoadAsset(*stub);
-            }
-
-            std::string packFile = packDir + stub->mAsset->GetName() + ".oct";
-            stub->mAsset->SaveFile(packFile.c_str(), platform);
-
-            if (true)
-            {
-                // Save the asset in the src location. There is probably a better time and place for this.
-                AssetManager::Get()->SaveAsset(*stub);
-            }
+            std::string packFile = packDir + Asset::GetNameFromPath(stub->mPath) + ".oct";
 
             // Currently either embed everything or embed nothing...
             // Embed flag on Asset does nothing, but if we want to keep that feature, then 
@@ -197,10 +289,7 @@ void ActionManager::BuildData(Platform platform, bool embedded)
                 embeddedAssets.push_back({ stub, packFile });
             }
 
-            if (!alreadyLoaded)
-            {
-                AssetManager::Get()->UnloadAsset(*stub);
-            }
+            cookedAssets.push_back({ stub, packFile });
         }
 
         // Cook child dirs
@@ -220,11 +309,41 @@ void ActionManager::BuildData(Platform platform, bool embedded)
     saveDir(engineAssetDir, true);
     saveDir(projectAssetDir, false);
 
+    CookAssets(cookedAssets, platform, cookCache);
+
+    std::vector<std::string> cookedPaths;
+    for (uint32_t i = 0; i < cookedAssets.size(); ++i)
+    {
+        cookedPaths.push_back(cookedAssets[i].second);
+    }
+
+    // Delete cooked files of assets that no longer exist.
+    std::vector<std::string> stalePaths = cookCache.RemoveStaleEntries(cookedPaths);
+    for (uint32_t i = 0; i < stalePaths.size(); ++i)
+    {
+        SYS_RemoveFile(stalePaths[i].c_str());
+    }
+
+    cookCache.Save(cookCachePath);
+
     // (3) Generate .cpp / .h files (empty if not embedded) using the .oct files in the Packaged folder.
     // (4) Create and save an asset registry file with simple list of asset paths into Packaged folder.
     std::unordered_map<std::string, AssetStub*>& assetMap = AssetManager::Get()->GetAssetMap();
     FILE* registryFile = nullptr;
 
+    auto getRegistryPath = [&](AssetStub* stub) -> std::string
+    {
+        std::string regPath = stub->mPath;
+        if (!stub->mEngineAsset &&
+            regPath.find(projectDir) != std::string::npos)
+        {
+            regPath = regPath.substr(projectDir.length());
+            regPath = projectName + "/" + regPath;
+        }
+
+        return regPath;
+    };
+
     std::string registryFileName = packagedDir + projectName + "/AssetRegistry.txt";
     registryFile = fopen(registryFileName.c_str(), "w");
 
@@ -239,14 +358,7 @@ void ActionManager::BuildData(Platform platform, bool embedded)
         if (registryFile != nullptr)
         {
             const char* regType = Asset::GetNameFromTypeId(pair.second->mType);
-
-            std::string regPath = pair.second->mPath.c_str();
-            if (!pair.second->mEngineAsset &&
-                regPath.find(projectDir) != std::string::npos)
-            {
-                regPath = regPath.substr(projectDir.length());
-                regPath = projectName + "/" + regPath;
-            }
+            std::string regPath = getRegistryPath(pair.second);
 
             fprintf(registryFile, "%s,%s\n", regType, regPath.c_str());
         }
@@ -258,6 +370,32 @@ void ActionManager::BuildData(Platform platform, bool embedded)
         registryFile = nullptr;
     }
 
+    // (5) Pack every cooked asset into a single archive so packaged builds can discover
+    // and load assets without opening thousands of files. Embedded builds don't need it.
+    if (!embedded)
+    {
+        std::vector<AssetPackSource> packSources;
+        packSources.reserve(cookedAssets.size());
+
+        for (uint32_t i = 0; i < cookedAssets.size(); ++i)
+        {
+            AssetPackSource source;
+            source.mPath = getRegistryPath(cookedAssets[i].first);
+            source.mFilePath = cookedAssets[i].second;
+            source.mType = cookedAssets[i].first->mType;
+            source.mEngineAsset = cookedAssets[i].first->mEngineAsset;
+            packSources.push_back(source);
+        }
+
+        std::string packFileName = packagedDir + projectName + "/" + ASSET_PACK_FILENAME;
+        if (!AssetPack::Write(packFileName.c_str(), packSources))
+        {
+            // Without the pack a packaged build can't find any of its assets.
+            LogError("Build data failed, couldn't write the asset pack");
+            return;
+        }
+    }
+
     // Create a Generated folder inside the project folder if it doesn't exist
     if (!DoesDirExist((projectDir + "Generated").c_str()))
     {
@@ -1759,6 +1897,116 @@ void ActionManager::GenerateEmbeddedScriptFiles(
     }
 }
 
+void ActionManager::CookAssets(std::vector<std::pair<AssetStub*, std::string> >& assets, Platform platform, CookCache& cookCache)
+{
+    SCOPED_STAT("CookAssets");
+
+    uint32_t cookKey = CookCache::GetCookKey(platform);
+    std::vector<CookJob> hashJobs(assets.size());
+
+    for (uint32_t i = 0; i < assets.size(); ++i)
+    {
+        AssetStub* stub = assets[i].first;
+
+        if (stub->mAsset != nullptr)
+        {
+            // Save loaded assets first so the source file matches what will be cooked.
+            AssetManager::Get()->SaveAsset(*stub);
+        }
+
+        hashJobs[i].mSourcePath = stub->mPath;
+        hashJobs[i].mCookedPath = assets[i].second;
+    }
+
+    RunCookJobs(hashJobs, CookJobType::Hash, platform);
+
+    // Cooked entries are keyed on the source hashes of the assets they reference too.
+    AssetHashMap assetHashes;
+    for (uint32_t i = 0; i < assets.size(); ++i)
+    {
+        assetHashes[assets[i].first->mName] = hashJobs[i].mSourceHash;
+    }
+
+    std::vector<uint32_t> dirtyAssets;
+
+    for (uint32_t i = 0; i < hashJobs.size(); ++i)
+    {
+        // A zero hash means the source couldn't be read, so always cook it.
+        if (hashJobs[i].mSourceHash == 0 ||
+            !cookCache.IsUpToDate(hashJobs[i].mCookedPath, hashJobs[i].mSourceHash, cookKey, assetHashes))
+        {
+            dirtyAssets.push_back(i);
+        }
+    }
+
+    LogDebug("Cooking %d of %d assets", int32_t(dirtyAssets.size()), int32_t(assets.size()));
+
+    // Load and cook in batches to bound memory use. Loading (and creating GPU resources)
+    // happens on the main thread, serializing the cooked data happens on the cook threads.
+    for (uint32_t batchStart = 0; batchStart < dirtyAssets.size(); batchStart += COOK_BATCH_SIZE)
+    {
+        uint32_t batchEnd = glm::min<uint32_t>(batchStart + COOK_BATCH_SIZE, uint32_t(dirtyAssets.size()));
+
+        std::vector<CookJob> cookJobs;
+        std::vector<CookJob> cookedJobs;
+        std::vector<AssetStub*> loadedStubs;
+
+        for (uint32_t d = batchStart; d < batchEnd; ++d)
+        {
+            uint32_t index = dirtyAssets[d];
+            AssetStub* stub = assets[index].first;
+
+            if (stub->mAsset == nullptr)
+            {
+                AssetManager::Get()->LoadAsset(*stub);
+                loadedStubs.push_back(stub);
+            }
+
+            if (stub->mAsset == nullptr)
+            {
+                LogError("Failed to load asset for cooking: %s", stub->mPath.c_str());
+                continue;
+            }
+
+            CookJob job = hashJobs[index];
+            job.mAsset = stub->mAsset;
+
+            if (job.mAsset->IsCookThreadSafe())
+            {
+                cookJobs.push_back(job);
+            }
+            else
+            {
+                job.mSaved = job.mAsset->SaveFile(job.mCookedPath.c_str(), platform, &job.mDependencies);
+                cookedJobs.push_back(job);
+            }
+        }
+
+        RunCookJobs(cookJobs, CookJobType::Cook, platform);
+        cookedJobs.insert(cookedJobs.end(), cookJobs.begin(), cookJobs.end());
+
+        // Only record assets that were actually written, so a failed save is retried next time.
+        for (uint32_t i = 0; i < cookedJobs.size(); ++i)
+        {
+            const CookJob& job = cookedJobs[i];
+
+            if (!job.mSaved)
+            {
+                LogError("Failed to cook asset: %s", job.mSourcePath.c_str());
+            }
+            else if (job.mSourceHash != 0)
+            {
+                cookCache.Update(job.mCookedPath, job.mSourceHash, cookKey, job.mDependencies, assetHashes);
+            }
+        }
+
+        for (uint32_t i = 0; i < loadedStubs.size(); ++i)
+        {
+            AssetManager::Get()->UnloadAsset(*loadedStubs[i]);
+        }
+    }
+}
+
 void ActionManager::GatherScriptFiles(const std::string& dir, std::vector<std::string>& outFiles)
 {
     // Recursively iterate through the Script directory and find .lua files.
@@ -1870,7 +2118,7 @@ void ActionManager::ResaveAllAssets()
     }
 
     // Refsweep afterwards to 
-    AssetManager::Get()->RefSweep();
+    AssetManager::Get()->RefSweep(true);
 }
 
 void ActionManager::DeleteAsset(AssetStub* stub)
@@ -2600,16 +2848,16 @@ void ActionSetInstanceData::Execute()
     }
     else
     {
-        // Remove X num of instance data
-        int32_t removeEnd = int32_t(mStartIndex + mData.size());
-        removeEnd = glm::min<uint32_t>(removeEnd, (int32_t)mInstMesh->GetNumInstances());
-        for (int32_t i = removeEnd - 1; i >= mStartIndex; --i)
+        // Overwrite the instances that already exist in place so only they get updated,
+        // then add the rest.
+        int32_t setEnd = int32_t(mStartIndex + mData.size());
+        setEnd = glm::min<uint32_t>(setEnd, (int32_t)mInstMesh->GetNumInstances());
+        for (int32_t i = mStartIndex; i < setEnd; ++i)
         {
-            mInstMesh->RemoveInstanceData(i);
+            mInstMesh->SetInstanceData(i, mData[i - mStartIndex]);
         }
 
-        // Add X num of new instance data
-        for (int32_t i = 0; i < mData.size(); ++i)
+        for (int32_t i = glm::max(setEnd - mStartIndex, 0); i < mData.size(); ++i)
         {
             mInstMesh->AddInstanceData(mData[i], mStartIndex + i);
         }
@@ -2624,16 +2872,16 @@ void ActionSetInstanceData::Reverse()
     }
     else
     {
-        // Remove X num of instance data
-        int32_t removeEnd = int32_t(mStartIndex + mPrevData.size());
-        removeEnd = glm::min<uint32_t>(removeEnd, (int32_t)mInstMesh->GetNumInstances());
-        for (int32_t i = removeEnd - 1; i >= mStartIndex; --i)
+        // Overwrite the instances that already exist in place so only they get updated,
+        // then add the rest.
+        int32_t setEnd = int32_t(mStartIndex + mPrevData.size());
+        setEnd = glm::min<uint32_t>(setEnd, (int32_t)mInstMesh->GetNumInstances());
+        for (int32_t i = mStartIndex; i < setEnd; ++i)
         {
-            mInstMesh->RemoveInstanceData(i);
+            mInstMesh->SetInstanceData(i, mPrevData[i - mStartIndex]);
         }
 
-        // Add X num of new instance data
-        for (int32_t i = 0; i < mPrevData.size(); ++i)
+        for (int32_t i = glm::max(setEnd - mStartIndex, 0); i < mPrevData.size(); ++i)
         {
             mInstMesh->AddInstanceData(mPrevData[i], mStartIndex + i);
         }
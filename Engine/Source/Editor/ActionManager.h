@@ -90,6 +90,8 @@ protected:
 
     void GatherScriptFiles(const std::string& dir, std::vector<std::string>& outFiles);
 
+    void CookAssets(std::vector<std::pair<AssetStub*, std::string> >& assets, Platform platform, class CookCache& cookCache);
+
     std::vector<Action*> mActionHistory;
     std::vector<Action*> mActionFuture;
     std::vector<Node*> mExiledNodes;
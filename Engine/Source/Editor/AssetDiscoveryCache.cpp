@@ -0,0 +1,109 @@
+#if EDITOR
+
+#include "AssetDiscoveryCache.h"
+#include "Stream.h"
+#include "Log.h"
+
+#include "System/System.h"
+
+// Bump this whenever the asset header layout or the modification time units change.
+#define ASSET_DISCOVERY_CACHE_VERSION 2
+#define ASSET_DISCOVERY_CACHE_MAGIC_NUMBER 0x4f414443
+
+void AssetDiscoveryCache::Load(const std::string& path)
+{
+    mEntries.clear();
+
+    if (!SYS_DoesFileExist(path.c_str(), false))
+        return;
+
+    Stream stream;
+    stream.ReadFile(path.c_str(), false);
+
+    if (stream.GetSize() < 12 ||
+        stream.ReadUint32() != ASSET_DISCOVERY_CACHE_MAGIC_NUMBER ||
+        stream.ReadUint32() != ASSET_DISCOVERY_CACHE_VERSION)
+    {
+        LogWarning("Discarding out of date asset discovery cache: %s", path.c_str());
+        return;
+    }
+
+    uint32_t numEntries = stream.ReadUint32();
+
+    for (uint32_t i = 0; i < numEntries; ++i)
+    {
+        std::string assetPath;
+        AssetDiscoveryEntry entry;
+
+        stream.ReadString(assetPath);
+        uint32_t timeLow = stream.ReadUint32();
+        uint32_t timeHigh = stream.ReadUint32();
+        entry.mModTime = uint64_t(timeLow) | (uint64_t(timeHigh) << 32);
+        uint32_t sizeLow = stream.ReadUint32();
+        uint32_t sizeHigh = stream.ReadUint32();
+        entry.mSize = uint64_t(sizeLow) | (uint64_t(sizeHigh) << 32);
+        entry.mType = TypeId(stream.ReadUint32());
+
+        mEntries[assetPath] = entry;
+    }
+}
+
+void AssetDiscoveryCache::Save(const std::string& path)
+{
+    Stream stream;
+    stream.WriteUint32(ASSET_DISCOVERY_CACHE_MAGIC_NUMBER);
+    stream.WriteUint32(ASSET_DISCOVERY_CACHE_VERSION);
+    stream.WriteUint32(uint32_t(mEntries.size()));
+
+    for (auto it = mEntries.begin(); it != mEntries.end(); ++it)
+    {
+        stream.WriteString(it->first);
+        stream.WriteUint32(uint32_t(it->second.mModTime & 0xffffffff));
+        stream.WriteUint32(uint32_t(it->second.mModTime >> 32));
+        stream.WriteUint32(uint32_t(it->second.mSize & 0xffffffff));
+        stream.WriteUint32(uint32_t(it->second.mSize >> 32));
+        stream.WriteUint32(uint32_t(it->second.mType));
+    }
+
+    stream.WriteFile(path.c_str());
+}
+
+bool AssetDiscoveryCache::Find(const std::string& assetPath, uint64_t modTime, uint64_t size, TypeId& outType) const
+{
+    auto it = mEntries.find(assetPath);
+
+    if (it != mEntries.end() &&
+        it->second.mModTime == modTime &&
+        it->second.mSize == size)
+    {
+        outType = it->second.mType;
+        return true;
+    }
+
+    return false;
+}
+
+void AssetDiscoveryCache::Update(const std::string& assetPath, uint64_t modTime, uint64_t size, TypeId type)
+{
+    AssetDiscoveryEntry& entry = mEntries[assetPath];
+    entry.mModTime = modTime;
+    entry.mSize = size;
+    entry.mType = type;
+}
+
+void AssetDiscoveryCache::RemoveEntries(const std::string& dirPath)
+{
+    for (auto it = mEntries.begin(); it != mEntries.end();)
+    {
+        if (it->first.compare(0, dirPath.size(), dirPath) == 0)
+        {
+            it = mEntries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "EngineTypes.h"
+#include "Constants.h"
+
+#include <string>
+#include <unordered_map>
+
+struct AssetDiscoveryEntry
+{
+    uint64_t mModTime = 0; // Nanoseconds, so saves within the same second are still told apart.
+    uint64_t mSize = 0;
+    TypeId mType = INVALID_TYPE_ID;
+};
+
+// Remembers the asset type of every discovered .oct file along with its modification time and size,
+// so that AssetManager::Discover() only reads the headers of files that changed since the last launch.
+class AssetDiscoveryCache
+{
+public:
+
+    void Load(const std::string& path);
+    void Save(const std::string& path);
+
+    // Safe to call from multiple threads as long as nothing modifies the cache.
+    bool Find(const std::string& assetPath, uint64_t modTime, uint64_t size, TypeId& outType) const;
+
+    void Update(const std::string& assetPath, uint64_t modTime, uint64_t size, TypeId type);
+
+    // Removes every entry located under the given directory.
+    void RemoveEntries(const std::string& dirPath);
+
+protected:
+
+    std::unordered_map<std::string, AssetDiscoveryEntry> mEntries;
+};
@@ -0,0 +1,175 @@
+#if EDITOR
+
+#include "CookCache.h"
+#include "Asset.h"
+#include "Stream.h"
+#include "Utilities.h"
+#include "Log.h"
+
+#include "System/System.h"
+
+#include <unordered_set>
+#include <algorithm>
+
+// Bump this whenever cooking code changes in a way that invalidates previously cooked data.
+#define COOK_CACHE_VERSION 3
+#define COOK_CACHE_MAGIC_NUMBER 0x4f434b43
+
+void CookCache::Load(const std::string& path)
+{
+    mEntries.clear();
+
+    if (!SYS_DoesFileExist(path.c_str(), false))
+        return;
+
+    Stream stream;
+    stream.ReadFile(path.c_str(), false);
+
+    if (stream.GetSize() < 12 ||
+        stream.ReadUint32() != COOK_CACHE_MAGIC_NUMBER ||
+        stream.ReadUint32() != COOK_CACHE_VERSION)
+    {
+        LogWarning("Discarding out of date cook cache: %s", path.c_str());
+        return;
+    }
+
+    uint32_t numEntries = stream.ReadUint32();
+
+    for (uint32_t i = 0; i < numEntries; ++i)
+    {
+        std::string cookedPath;
+        CookCacheEntry entry;
+
+        stream.ReadString(cookedPath);
+        uint32_t hashLow = stream.ReadUint32();
+        uint32_t hashHigh = stream.ReadUint32();
+        entry.mSourceHash = uint64_t(hashLow) | (uint64_t(hashHigh) << 32);
+        entry.mCookKey = stream.ReadUint32();
+
+        uint32_t numDependencies = stream.ReadUint32();
+        entry.mDependencies.resize(numDependencies);
+        for (uint32_t d = 0; d < numDependencies; ++d)
+        {
+            stream.ReadString(entry.mDependencies[d]);
+        }
+
+        mEntries[cookedPath] = entry;
+    }
+}
+
+void CookCache::Save(const std::string& path)
+{
+    Stream stream;
+    stream.WriteUint32(COOK_CACHE_MAGIC_NUMBER);
+    stream.WriteUint32(COOK_CACHE_VERSION);
+    stream.WriteUint32(uint32_t(mEntries.size()));
+
+    for (auto it = mEntries.begin(); it != mEntries.end(); ++it)
+    {
+        stream.WriteString(it->first);
+        stream.WriteUint32(uint32_t(it->second.mSourceHash & 0xffffffff));
+        stream.WriteUint32(uint32_t(it->second.mSourceHash >> 32));
+        stream.WriteUint32(it->second.mCookKey);
+
+        stream.WriteUint32(uint32_t(it->second.mDependencies.size()));
+        for (uint32_t d = 0; d < it->second.mDependencies.size(); ++d)
+        {
+            stream.WriteString(it->second.mDependencies[d]);
+        }
+    }
+
+    stream.WriteFile(path.c_str());
+}
+
+bool CookCache::IsUpToDate(const std::string& cookedPath, uint64_t sourceHash, uint32_t cookKey, const AssetHashMap& assetHashes) const
+{
+    auto it = mEntries.find(cookedPath);
+
+    return it != mEntries.end() &&
+        it->second.mSourceHash == FoldDependencies(sourceHash, it->second.mDependencies, assetHashes) &&
+        it->second.mCookKey == cookKey &&
+        SYS_DoesFileExist(cookedPath.c_str(), false);
+}
+
+void CookCache::Update(const std::string& cookedPath, uint64_t sourceHash, uint32_t cookKey, const std::vector<std::string>& dependencies, const AssetHashMap& assetHashes)
+{
+    CookCacheEntry& entry = mEntries[cookedPath];
+    entry.mDependencies = dependencies;
+    std::sort(entry.mDependencies.begin(), entry.mDependencies.end());
+    entry.mDependencies.erase(std::unique(entry.mDependencies.begin(), entry.mDependencies.end()), entry.mDependencies.end());
+
+    entry.mSourceHash = FoldDependencies(sourceHash, entry.mDependencies, assetHashes);
+    entry.mCookKey = cookKey;
+}
+
+std::vector<std::string> CookCache::RemoveStaleEntries(const std::vector<std::string>& cookedPaths)
+{
+    std::unordered_set<std::string> current(cookedPaths.begin(), cookedPaths.end());
+    std::vector<std::string> stale;
+
+    for (auto it = mEntries.begin(); it != mEntries.end();)
+    {
+        if (current.find(it->first) == current.end())
+        {
+            stale.push_back(it->first);
+            it = mEntries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return stale;
+}
+
+uint64_t CookCache::HashFile(const std::string& path)
+{
+    // 64 bit FNV-1a over the whole file.
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    char* data = nullptr;
+    uint32_t size = 0;
+    SYS_AcquireFileData(path.c_str(), false, 0, data, size);
+
+    if (data == nullptr)
+        return 0;
+
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        hash ^= uint8_t(data[i]);
+        hash *= 0x100000001b3ull;
+    }
+
+    SYS_ReleaseFileData(data);
+
+    return hash;
+}
+
+uint64_t CookCache::FoldDependencies(uint64_t sourceHash, const std::vector<std::string>& dependencies, const AssetHashMap& assetHashes)
+{
+    // Referenced assets that aren't being cooked (or were removed) fold in as 0.
+    uint64_t hash = sourceHash;
+
+    for (uint32_t i = 0; i < dependencies.size(); ++i)
+    {
+        auto it = assetHashes.find(dependencies[i]);
+        uint64_t depHash = (it != assetHashes.end()) ? it->second : 0;
+
+        hash ^= depHash + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    }
+
+    return hash;
+}
+
+uint32_t CookCache::GetCookKey(Platform platform)
+{
+    // Everything outside of the source asset that affects cooked output.
+    std::string settings = GetPlatformString(platform);
+    settings += "|" + std::to_string(ASSET_VERSION_CURRENT);
+    settings += "|" + std::to_string(COOK_CACHE_VERSION);
+
+    return OctHashString(settings.c_str());
+}
+
+#endif
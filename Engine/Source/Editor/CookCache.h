@@ -0,0 +1,43 @@
+#pragma once
+
+#include "EngineTypes.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// Maps asset names to the hash of their source file.
+typedef std::unordered_map<std::string, uint64_t> AssetHashMap;
+
+struct CookCacheEntry
+{
+    // Source hash with the source hashes of the referenced assets folded in.
+    uint64_t mSourceHash = 0;
+    uint32_t mCookKey = 0;
+    std::vector<std::string> mDependencies;
+};
+
+// Remembers which source asset content each cooked file was built from, so that
+// BuildData() only re-cooks assets whose source data, referenced assets or cook settings changed.
+class CookCache
+{
+public:
+
+    void Load(const std::string& path);
+    void Save(const std::string& path);
+
+    bool IsUpToDate(const std::string& cookedPath, uint64_t sourceHash, uint32_t cookKey, const AssetHashMap& assetHashes) const;
+    void Update(const std::string& cookedPath, uint64_t sourceHash, uint32_t cookKey, const std::vector<std::string>& dependencies, const AssetHashMap& assetHashes);
+
+    // Removes entries that aren't in the given set of cooked paths and returns their paths.
+    std::vector<std::string> RemoveStaleEntries(const std::vector<std::string>& cookedPaths);
+
+    static uint64_t HashFile(const std::string& path);
+    static uint32_t GetCookKey(Platform platform);
+
+protected:
+
+    static uint64_t FoldDependencies(uint64_t sourceHash, const std::vector<std::string>& dependencies, const AssetHashMap& assetHashes);
+
+    std::unordered_map<std::string, CookCacheEntry> mEntries;
+};
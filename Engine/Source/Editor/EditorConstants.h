@@ -14,3 +14,6 @@
 #define BASIC_CAMERA "Camera"
 #define BASIC_TEXT_MESH "Text Mesh"
 #define BASIC_INSTANCED_MESH "Instanced Mesh"
+
+#define NUM_COOK_THREADS 8
+#define COOK_BATCH_SIZE 64
@@ -218,6 +218,11 @@ void EditorState::SetPaintMode(PaintMode paintMode)
             // Make sure cursor is visible and unlocked 
             INP_ShowCursor(true);
             INP_LockCursor(false);
+
+            if (mPaintManager)
+            {
+                mPaintManager->StopTracking();
+            }
         }
     }
 }
@@ -373,6 +378,22 @@ void EditorState::HandleNodeDestroy(Node* node)
     }
 }
 
+void EditorState::HandleNodeChanged(Node* node, bool includeChildren)
+{
+    if (mPaintManager)
+    {
+        mPaintManager->HandleNodeChanged(node, includeChildren);
+    }
+}
+
+void EditorState::HandleNodeRemoved(Node* node)
+{
+    if (mPaintManager)
+    {
+        mPaintManager->HandleNodeRemoved(node);
+    }
+}
+
 
 void EditorState::SetSelectedNode(Node* newNode)
 {
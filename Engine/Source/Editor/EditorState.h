@@ -144,6 +144,8 @@ struct EditorState
     void WriteEditorProjectSave();
 
     void HandleNodeDestroy(Node* node);
+    void HandleNodeChanged(Node* node, bool includeChildren = false);
+    void HandleNodeRemoved(Node* node);
 
     void SetSelectedNode(Node* newNode);
     void AddSelectedNode(Node* node, bool addAllChildren);
@@ -0,0 +1,444 @@
+#if EDITOR
+
+#include "MeshOptimizer.h"
+#include "Maths.h"
+#include "Assertion.h"
+
+#include <algorithm>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+// Forsyth scoring parameters. The cache size here is only used for scoring, it doesn't need to
+// match the hardware, the result is good across a wide range of real cache sizes.
+#define VERTEX_CACHE_SIZE 32
+#define CACHE_DECAY_POWER 1.5f
+#define LAST_TRI_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.0f
+#define VALENCE_BOOST_POWER 0.5f
+
+// FIFO cache size used when measuring clusters for overdraw sorting.
+#define OVERDRAW_CACHE_SIZE 16
+#define OVERDRAW_THRESHOLD 1.05f
+
+static float ScoreVertex(int32_t cachePos, uint32_t numLiveTris)
+{
+    if (numLiveTris == 0)
+    {
+        // No triangles left that use this vertex.
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+
+    if (cachePos >= 0)
+    {
+        if (cachePos < 3)
+        {
+            // Used by the last triangle. Fixed score so that it doesn't matter which of the three it was.
+            score = LAST_TRI_SCORE;
+        }
+        else
+        {
+            float scaler = 1.0f / (VERTEX_CACHE_SIZE - 3);
+            score = powf(1.0f - (cachePos - 3) * scaler, CACHE_DECAY_POWER);
+        }
+    }
+
+    // Boost vertices with few triangles left so that lone triangles don't get stranded.
+    score += VALENCE_BOOST_SCALE * powf(float(numLiveTris), -VALENCE_BOOST_POWER);
+    return score;
+}
+
+static glm::vec3 GetPosition(const void* vertices, uint32_t vertexStride, uint32_t index)
+{
+    return *reinterpret_cast<const glm::vec3*>(reinterpret_cast<const uint8_t*>(vertices) + size_t(index) * vertexStride);
+}
+
+void OptimizeVertexCache(IndexType* indices, uint32_t numIndices, uint32_t numVertices)
+{
+    OCT_ASSERT(numIndices % 3 == 0);
+    uint32_t numTris = numIndices / 3;
+
+    if (numTris == 0)
+    {
+        return;
+    }
+
+    // Vertex to triangle adjacency. The first numLiveTris entries of each vertex's range are the
+    // triangles that haven't been emitted yet.
+    std::vector<uint32_t> triOffsets(numVertices + 1, 0);
+    for (uint32_t i = 0; i < numIndices; ++i)
+    {
+        triOffsets[indices[i] + 1]++;
+    }
+
+    for (uint32_t v = 0; v < numVertices; ++v)
+    {
+        triOffsets[v + 1] += triOffsets[v];
+    }
+
+    std::vector<uint32_t> numLiveTris(numVertices);
+    std::vector<uint32_t> triList(numIndices);
+    for (uint32_t v = 0; v < numVertices; ++v)
+    {
+        numLiveTris[v] = triOffsets[v + 1] - triOffsets[v];
+    }
+
+    {
+        std::vector<uint32_t> fill(triOffsets.begin(), triOffsets.end() - 1);
+        for (uint32_t i = 0; i < numIndices; ++i)
+        {
+            triList[fill[indices[i]]++] = i / 3;
+        }
+    }
+
+    std::vector<int32_t> cachePos(numVertices, -1);
+    std::vector<float> vertexScores(numVertices);
+    for (uint32_t v = 0; v < numVertices; ++v)
+    {
+        vertexScores[v] = ScoreVertex(-1, numLiveTris[v]);
+    }
+
+    std::vector<float> triScores(numTris);
+    std::vector<bool> emitted(numTris, false);
+    for (uint32_t t = 0; t < numTris; ++t)
+    {
+        triScores[t] = vertexScores[indices[t * 3 + 0]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+    }
+
+    std::vector<IndexType> output;
+    output.reserve(numIndices);
+
+    uint32_t cache[VERTEX_CACHE_SIZE + 3];
+    uint32_t newCache[VERTEX_CACHE_SIZE + 3];
+    uint32_t cacheCount = 0;
+    uint32_t scanCursor = 0;
+    int32_t bestTri = -1;
+
+    for (uint32_t numEmitted = 0; numEmitted < numTris; ++numEmitted)
+    {
+        if (bestTri < 0)
+        {
+            // Nothing in the cache touches a live triangle (e.g. a new disconnected piece). Start from the next unused one.
+            while (emitted[scanCursor])
+            {
+                ++scanCursor;
+            }
+
+            bestTri = int32_t(scanCursor);
+        }
+
+        const IndexType* tri = &indices[bestTri * 3];
+        emitted[bestTri] = true;
+
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            uint32_t v = tri[c];
+            output.push_back(IndexType(v));
+
+            // Swap the triangle out of the vertex's live range.
+            uint32_t* vertTris = &triList[triOffsets[v]];
+            for (uint32_t i = 0; i < numLiveTris[v]; ++i)
+            {
+                if (vertTris[i] == uint32_t(bestTri))
+                {
+                    std::swap(vertTris[i], vertTris[numLiveTris[v] - 1]);
+                    break;
+                }
+            }
+
+            numLiveTris[v]--;
+        }
+
+        // The triangle's vertices move to the front of the cache, everything else shifts back.
+        uint32_t newCount = 0;
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            newCache[newCount++] = tri[c];
+        }
+
+        for (uint32_t i = 0; i < cacheCount; ++i)
+        {
+            uint32_t v = cache[i];
+            if (v != tri[0] && v != tri[1] && v != tri[2])
+            {
+                newCache[newCount++] = v;
+            }
+        }
+
+        for (uint32_t i = 0; i < newCount; ++i)
+        {
+            cachePos[newCache[i]] = (i < VERTEX_CACHE_SIZE) ? int32_t(i) : -1;
+        }
+
+        // Rescore everything that moved, including the vertices that just fell out of the cache.
+        for (uint32_t i = 0; i < newCount; ++i)
+        {
+            uint32_t v = newCache[i];
+            float newScore = ScoreVertex(cachePos[v], numLiveTris[v]);
+            float delta = newScore - vertexScores[v];
+            vertexScores[v] = newScore;
+
+            const uint32_t* vertTris = &triList[triOffsets[v]];
+            for (uint32_t t = 0; t < numLiveTris[v]; ++t)
+            {
+                triScores[vertTris[t]] += delta;
+            }
+        }
+
+        cacheCount = glm::min<uint32_t>(newCount, VERTEX_CACHE_SIZE);
+        memcpy(cache, newCache, cacheCount * sizeof(uint32_t));
+
+        // Only triangles touching the cache can have the best score.
+        bestTri = -1;
+        float bestScore = -FLT_MAX;
+        for (uint32_t i = 0; i < cacheCount; ++i)
+        {
+            uint32_t v = cache[i];
+            const uint32_t* vertTris = &triList[triOffsets[v]];
+
+            for (uint32_t t = 0; t < numLiveTris[v]; ++t)
+            {
+                if (triScores[vertTris[t]] > bestScore)
+                {
+                    bestScore = triScores[vertTris[t]];
+                    bestTri = int32_t(vertTris[t]);
+                }
+            }
+        }
+    }
+
+    memcpy(indices, output.data(), numIndices * sizeof(IndexType));
+}
+
+void OptimizeOverdraw(
+    IndexType* indices,
+    uint32_t numIndices,
+    const void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    float threshold)
+{
+    OCT_ASSERT(numIndices % 3 == 0);
+    uint32_t numTris = numIndices / 3;
+
+    if (numTris == 0)
+    {
+        return;
+    }
+
+    // FIFO cache simulation. Bumping the clock past the cache size empties the cache.
+    std::vector<uint32_t> timestamps(numVertices, 0);
+    uint32_t time = OVERDRAW_CACHE_SIZE + 1;
+
+    auto simulateTri = [&](uint32_t t) -> uint32_t
+    {
+        uint32_t misses = 0;
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            uint32_t v = indices[t * 3 + c];
+            if (time - timestamps[v] > OVERDRAW_CACHE_SIZE)
+            {
+                timestamps[v] = time++;
+                ++misses;
+            }
+        }
+        return misses;
+    };
+
+    auto resetCache = [&]()
+    {
+        time += OVERDRAW_CACHE_SIZE + 1;
+    };
+
+    // Hard boundaries are where every vertex of a triangle misses, i.e. the cache optimizer started
+    // over somewhere else. Reordering at those points costs nothing.
+    std::vector<uint32_t> hardClusters;
+    for (uint32_t t = 0; t < numTris; ++t)
+    {
+        if (simulateTri(t) == 3 || t == 0)
+        {
+            hardClusters.push_back(t);
+        }
+    }
+    hardClusters.push_back(numTris);
+
+    // Split further wherever the cluster so far is within threshold of the whole cluster's efficiency.
+    std::vector<uint32_t> clusters;
+    for (uint32_t h = 0; h + 1 < hardClusters.size(); ++h)
+    {
+        uint32_t start = hardClusters[h];
+        uint32_t end = hardClusters[h + 1];
+
+        resetCache();
+        uint32_t clusterMisses = 0;
+        for (uint32_t t = start; t < end; ++t)
+        {
+            clusterMisses += simulateTri(t);
+        }
+
+        float missThreshold = threshold * float(clusterMisses) / float(end - start);
+
+        resetCache();
+        clusters.push_back(start);
+        uint32_t subStart = start;
+        uint32_t subMisses = 0;
+
+        for (uint32_t t = start; t < end; ++t)
+        {
+            subMisses += simulateTri(t);
+
+            if (t + 1 < end &&
+                subMisses <= missThreshold * float(t + 1 - subStart))
+            {
+                clusters.push_back(t + 1);
+                subStart = t + 1;
+                subMisses = 0;
+                resetCache();
+            }
+        }
+    }
+    clusters.push_back(numTris);
+
+    // Sort key: how far the cluster faces away from the middle of the mesh. Clusters on the outside
+    // facing outward are the most likely to occlude the rest.
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    uint32_t numClusters = uint32_t(clusters.size()) - 1;
+    std::vector<glm::vec3> clusterCentroids(numClusters, glm::vec3(0.0f));
+    std::vector<glm::vec3> clusterNormals(numClusters, glm::vec3(0.0f));
+    std::vector<float> clusterAreas(numClusters, 0.0f);
+
+    for (uint32_t c = 0; c < numClusters; ++c)
+    {
+        for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t)
+        {
+            glm::vec3 p0 = GetPosition(vertices, vertexStride, indices[t * 3 + 0]);
+            glm::vec3 p1 = GetPosition(vertices, vertexStride, indices[t * 3 + 1]);
+            glm::vec3 p2 = GetPosition(vertices, vertexStride, indices[t * 3 + 2]);
+            glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+            float area = glm::length(normal);
+
+            clusterCentroids[c] += (p0 + p1 + p2) * (area / 3.0f);
+            clusterNormals[c] += normal;
+            clusterAreas[c] += area;
+        }
+
+        meshCentroid += clusterCentroids[c];
+        meshArea += clusterAreas[c];
+    }
+
+    meshCentroid = (meshArea > 0.0f) ? meshCentroid / meshArea : meshCentroid;
+
+    std::vector<float> sortKeys(numClusters, 0.0f);
+    for (uint32_t c = 0; c < numClusters; ++c)
+    {
+        float normalLen = glm::length(clusterNormals[c]);
+
+        if (clusterAreas[c] > 0.0f && normalLen > 0.0f)
+        {
+            glm::vec3 centroid = clusterCentroids[c] / clusterAreas[c];
+            sortKeys[c] = glm::dot(centroid - meshCentroid, clusterNormals[c] / normalLen);
+        }
+    }
+
+    std::vector<uint32_t> order(numClusters);
+    for (uint32_t c = 0; c < numClusters; ++c)
+    {
+        order[c] = c;
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t l, uint32_t r) { return sortKeys[l] > sortKeys[r]; });
+
+    std::vector<IndexType> source(indices, indices + numIndices);
+    uint32_t writeIndex = 0;
+    for (uint32_t c : order)
+    {
+        uint32_t first = clusters[c] * 3;
+        uint32_t count = (clusters[c + 1] - clusters[c]) * 3;
+        memcpy(indices + writeIndex, source.data() + first, count * sizeof(IndexType));
+        writeIndex += count;
+    }
+
+    OCT_ASSERT(writeIndex == numIndices);
+}
+
+uint32_t OptimizeVertexFetch(
+    void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    IndexType* indices,
+    uint32_t numIndices,
+    std::vector<uint32_t>* outRemap)
+{
+    std::vector<uint32_t> remap(numVertices, UINT32_MAX);
+    uint32_t numUsed = 0;
+
+    for (uint32_t i = 0; i < numIndices; ++i)
+    {
+        uint32_t v = indices[i];
+        if (remap[v] == UINT32_MAX)
+        {
+            remap[v] = numUsed++;
+        }
+
+        indices[i] = IndexType(remap[v]);
+    }
+
+    uint8_t* vertexData = reinterpret_cast<uint8_t*>(vertices);
+    std::vector<uint8_t> source(vertexData, vertexData + size_t(numVertices) * vertexStride);
+
+    for (uint32_t v = 0; v < numVertices; ++v)
+    {
+        if (remap[v] != UINT32_MAX)
+        {
+            memcpy(vertexData + size_t(remap[v]) * vertexStride, source.data() + size_t(v) * vertexStride, vertexStride);
+        }
+    }
+
+    if (outRemap != nullptr)
+    {
+        outRemap->swap(remap);
+    }
+
+    return numUsed;
+}
+
+uint32_t OptimizeMesh(
+    void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    IndexType* indices,
+    uint32_t numIndices)
+{
+    OptimizeVertexCache(indices, numIndices, numVertices);
+    OptimizeOverdraw(indices, numIndices, vertices, vertexStride, numVertices, OVERDRAW_THRESHOLD);
+    return OptimizeVertexFetch(vertices, vertexStride, numVertices, indices, numIndices);
+}
+
+float ComputeAcmr(const IndexType* indices, uint32_t numIndices, uint32_t numVertices, uint32_t cacheSize)
+{
+    if (numIndices < 3)
+    {
+        return 0.0f;
+    }
+
+    std::vector<uint32_t> timestamps(numVertices, 0);
+    uint32_t time = cacheSize + 1;
+    uint32_t misses = 0;
+
+    for (uint32_t i = 0; i < numIndices; ++i)
+    {
+        uint32_t v = indices[i];
+        if (time - timestamps[v] > cacheSize)
+        {
+            timestamps[v] = time++;
+            ++misses;
+        }
+    }
+
+    return float(misses) / float(numIndices / 3);
+}
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Graphics/GraphicsTypes.h"
+
+#include <vector>
+
+// Import-time reordering passes for static and skeletal meshes. None of them change the rendered
+// result, only the order triangles and vertices are fed to the GPU. Each vertex must begin with a
+// glm::vec3 position.
+
+// Reorders triangles for the post-transform vertex cache (Forsyth's linear-speed algorithm).
+void OptimizeVertexCache(IndexType* indices, uint32_t numIndices, uint32_t numVertices);
+
+// Splits a cache-optimized index list into clusters and sorts them so outward facing clusters on
+// the outside of the mesh draw first, which cuts overdraw. threshold is how much worse than the
+// original cache efficiency a cluster may get (1.05 = 5%).
+void OptimizeOverdraw(
+    IndexType* indices,
+    uint32_t numIndices,
+    const void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    float threshold);
+
+// Reorders vertices by first use so vertex fetches walk memory in order, and remaps the indices.
+// Unreferenced vertices are dropped. Returns the new vertex count. outRemap (optional) receives the
+// new index of every old vertex, or UINT32_MAX for dropped ones.
+uint32_t OptimizeVertexFetch(
+    void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    IndexType* indices,
+    uint32_t numIndices,
+    std::vector<uint32_t>* outRemap = nullptr);
+
+// Runs all of the passes above. Returns the new vertex count.
+uint32_t OptimizeMesh(
+    void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    IndexType* indices,
+    uint32_t numIndices);
+
+// Average number of vertex shader invocations per triangle with a FIFO cache of the given size.
+float ComputeAcmr(const IndexType* indices, uint32_t numIndices, uint32_t numVertices, uint32_t cacheSize);
@@ -0,0 +1,333 @@
+#if EDITOR
+
+#include "MeshSimplifier.h"
+#include "Maths.h"
+#include "Assertion.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <float.h>
+
+// Collapses that would rotate a surrounding triangle's normal further than this (cosine, ~75 degrees) are rejected.
+#define SIMPLIFY_MIN_NORMAL_DOT 0.25f
+#define SIMPLIFY_MAX_PASSES 64
+
+struct Quadric
+{
+    // Upper triangle of the symmetric 4x4 plane error matrix.
+    double m[10] = {};
+
+    void AddPlane(const glm::dvec3& n, double d, double weight)
+    {
+        m[0] += weight * n.x * n.x;
+        m[1] += weight * n.x * n.y;
+        m[2] += weight * n.x * n.z;
+        m[3] += weight * n.x * d;
+        m[4] += weight * n.y * n.y;
+        m[5] += weight * n.y * n.z;
+        m[6] += weight * n.y * d;
+        m[7] += weight * n.z * n.z;
+        m[8] += weight * n.z * d;
+        m[9] += weight * d * d;
+    }
+
+    void Add(const Quadric& other)
+    {
+        for (uint32_t i = 0; i < 10; ++i)
+        {
+            m[i] += other.m[i];
+        }
+    }
+
+    double Evaluate(const glm::vec3& p) const
+    {
+        double x = p.x;
+        double y = p.y;
+        double z = p.z;
+
+        return m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x +
+            m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y +
+            m[7] * z * z + 2.0 * m[8] * z +
+            m[9];
+    }
+};
+
+struct Collapse
+{
+    uint32_t mSrc;
+    uint32_t mDst;
+    float mError;
+};
+
+static uint64_t EdgeKey(uint32_t a, uint32_t b)
+{
+    return (a < b) ? ((uint64_t(a) << 32) | b) : ((uint64_t(b) << 32) | a);
+}
+
+static float CollapseError(const std::vector<Quadric>& quadrics, const std::vector<glm::vec3>& positions, uint32_t src, uint32_t dst)
+{
+    Quadric q = quadrics[src];
+    q.Add(quadrics[dst]);
+    return float(glm::max(q.Evaluate(positions[dst]), 0.0));
+}
+
+static bool CollapseFlipsTriangle(
+    uint32_t src,
+    uint32_t dst,
+    const std::vector<IndexType>& indices,
+    const std::vector<uint32_t>& triOffsets,
+    const std::vector<uint32_t>& triList,
+    const std::vector<glm::vec3>& positions)
+{
+    for (uint32_t i = triOffsets[src]; i < triOffsets[src + 1]; ++i)
+    {
+        uint32_t tri = triList[i];
+        uint32_t v0 = indices[tri * 3 + 0];
+        uint32_t v1 = indices[tri * 3 + 1];
+        uint32_t v2 = indices[tri * 3 + 2];
+
+        if (v0 == dst || v1 == dst || v2 == dst)
+        {
+            // This triangle collapses to nothing.
+            continue;
+        }
+
+        glm::vec3 p0 = positions[v0];
+        glm::vec3 p1 = positions[v1];
+        glm::vec3 p2 = positions[v2];
+        glm::vec3 before = glm::cross(p1 - p0, p2 - p0);
+
+        if (v0 == src) { p0 = positions[dst]; }
+        if (v1 == src) { p1 = positions[dst]; }
+        if (v2 == src) { p2 = positions[dst]; }
+        glm::vec3 after = glm::cross(p1 - p0, p2 - p0);
+
+        float beforeLen = glm::length(before);
+        float afterLen = glm::length(after);
+
+        if (beforeLen > 0.0f &&
+            glm::dot(before, after) <= SIMPLIFY_MIN_NORMAL_DOT * beforeLen * afterLen)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SimplifyMesh(
+    const void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    const IndexType* indices,
+    uint32_t numIndices,
+    uint32_t targetNumIndices,
+    std::vector<IndexType>& outIndices)
+{
+    OCT_ASSERT(numIndices % 3 == 0);
+    outIndices.assign(indices, indices + numIndices);
+
+    if (numIndices <= targetNumIndices)
+    {
+        return;
+    }
+
+    std::vector<glm::vec3> positions(numVertices);
+    for (uint32_t i = 0; i < numVertices; ++i)
+    {
+        positions[i] = *reinterpret_cast<const glm::vec3*>(reinterpret_cast<const uint8_t*>(vertices) + size_t(i) * vertexStride);
+    }
+
+    // Lock every vertex on an edge that isn't shared by exactly two triangles. Seams show up
+    // as open edges too, since the triangles on each side use their own copy of the vertex.
+    std::vector<bool> locked(numVertices, false);
+    {
+        std::unordered_map<uint64_t, uint32_t> edgeCounts;
+        edgeCounts.reserve(numIndices);
+
+        for (uint32_t i = 0; i < numIndices; i += 3)
+        {
+            for (uint32_t e = 0; e < 3; ++e)
+            {
+                edgeCounts[EdgeKey(indices[i + e], indices[i + (e + 1) % 3])]++;
+            }
+        }
+
+        for (const auto& edge : edgeCounts)
+        {
+            if (edge.second != 2)
+            {
+                locked[uint32_t(edge.first >> 32)] = true;
+                locked[uint32_t(edge.first & 0xffffffff)] = true;
+            }
+        }
+    }
+
+    // Area weighted plane quadrics
+    std::vector<Quadric> quadrics(numVertices);
+    for (uint32_t i = 0; i < numIndices; i += 3)
+    {
+        glm::dvec3 p0 = positions[indices[i + 0]];
+        glm::dvec3 p1 = positions[indices[i + 1]];
+        glm::dvec3 p2 = positions[indices[i + 2]];
+        glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+        double area2 = glm::length(normal);
+
+        if (area2 > 0.0)
+        {
+            normal /= area2;
+            double d = -glm::dot(normal, p0);
+
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                quadrics[indices[i + c]].AddPlane(normal, d, area2 * 0.5);
+            }
+        }
+    }
+
+    std::vector<uint32_t> remap(numVertices);
+    std::vector<bool> touched(numVertices);
+    std::vector<uint32_t> triOffsets;
+    std::vector<uint32_t> triFill;
+    std::vector<uint32_t> triList;
+    std::vector<Collapse> collapses;
+
+    for (uint32_t pass = 0; pass < SIMPLIFY_MAX_PASSES && outIndices.size() > targetNumIndices; ++pass)
+    {
+        uint32_t numTris = uint32_t(outIndices.size() / 3);
+
+        // Vertex to triangle adjacency
+        triOffsets.assign(numVertices + 1, 0);
+        for (IndexType index : outIndices)
+        {
+            triOffsets[index + 1]++;
+        }
+
+        for (uint32_t i = 0; i < numVertices; ++i)
+        {
+            triOffsets[i + 1] += triOffsets[i];
+        }
+
+        triFill.assign(triOffsets.begin(), triOffsets.end() - 1);
+        triList.resize(outIndices.size());
+        for (uint32_t t = 0; t < numTris; ++t)
+        {
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                triList[triFill[outIndices[t * 3 + c]]++] = t;
+            }
+        }
+
+        // One candidate per edge, in whichever direction is cheaper. Interior edges are seen once
+        // from each side, so only take them from the side where they run low to high.
+        collapses.clear();
+        for (uint32_t i = 0; i < outIndices.size(); i += 3)
+        {
+            for (uint32_t e = 0; e < 3; ++e)
+            {
+                uint32_t a = outIndices[i + e];
+                uint32_t b = outIndices[i + (e + 1) % 3];
+
+                if (a > b || (locked[a] && locked[b]))
+                {
+                    continue;
+                }
+
+                float errorAB = locked[a] ? FLT_MAX : CollapseError(quadrics, positions, a, b);
+                float errorBA = locked[b] ? FLT_MAX : CollapseError(quadrics, positions, b, a);
+
+                if (errorAB <= errorBA)
+                {
+                    collapses.push_back({ a, b, errorAB });
+                }
+                else
+                {
+                    collapses.push_back({ b, a, errorBA });
+                }
+            }
+        }
+
+        if (collapses.empty())
+        {
+            break;
+        }
+
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& l, const Collapse& r) { return l.mError < r.mError; });
+
+        // Each collapse removes about two triangles. Don't reach much past the error of the collapses
+        // needed to hit the target, so later passes get to use the updated quadrics.
+        uint32_t trisToRemove = numTris - targetNumIndices / 3;
+        size_t limitIndex = glm::min<size_t>(collapses.size() - 1, trisToRemove / 2);
+        float errorLimit = collapses[limitIndex].mError * 1.5f;
+
+        for (uint32_t i = 0; i < numVertices; ++i)
+        {
+            remap[i] = i;
+        }
+
+        std::fill(touched.begin(), touched.end(), false);
+        uint32_t numRemoved = 0;
+
+        for (const Collapse& collapse : collapses)
+        {
+            if (numRemoved >= trisToRemove ||
+                collapse.mError > errorLimit)
+            {
+                break;
+            }
+
+            uint32_t src = collapse.mSrc;
+            uint32_t dst = collapse.mDst;
+
+            if (touched[src] || touched[dst] ||
+                CollapseFlipsTriangle(src, dst, outIndices, triOffsets, triList, positions))
+            {
+                continue;
+            }
+
+            remap[src] = dst;
+            quadrics[dst].Add(quadrics[src]);
+
+            // Freeze the whole ring around the collapse for the rest of the pass, so no triangle
+            // has more than one of its corners moved before the flip check runs again.
+            for (uint32_t t = triOffsets[src]; t < triOffsets[src + 1]; ++t)
+            {
+                uint32_t tri = triList[t];
+                bool hasDst = false;
+
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    touched[outIndices[tri * 3 + c]] = true;
+                    hasDst = hasDst || (outIndices[tri * 3 + c] == dst);
+                }
+
+                numRemoved += hasDst ? 1 : 0;
+            }
+        }
+
+        if (numRemoved == 0)
+        {
+            break;
+        }
+
+        // Apply the collapses and drop the triangles that became degenerate.
+        uint32_t writeIndex = 0;
+        for (uint32_t i = 0; i < outIndices.size(); i += 3)
+        {
+            uint32_t v0 = remap[outIndices[i + 0]];
+            uint32_t v1 = remap[outIndices[i + 1]];
+            uint32_t v2 = remap[outIndices[i + 2]];
+
+            if (v0 != v1 && v1 != v2 && v2 != v0)
+            {
+                outIndices[writeIndex++] = IndexType(v0);
+                outIndices[writeIndex++] = IndexType(v1);
+                outIndices[writeIndex++] = IndexType(v2);
+            }
+        }
+
+        outIndices.resize(writeIndex);
+    }
+}
+
+#endif
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Graphics/GraphicsTypes.h"
+
+#include <vector>
+
+// Quadric error metric edge collapse simplifier, used to build StaticMesh LODs at import time.
+// Each vertex must begin with a glm::vec3 position. Vertices are never moved, only merged into a
+// neighbor, so the output indices still refer to the input vertex array. Vertices on open edges
+// (including UV/normal seams, where the two sides use different vertices) are kept in place.
+void SimplifyMesh(
+    const void* vertices,
+    uint32_t vertexStride,
+    uint32_t numVertices,
+    const IndexType* indices,
+    uint32_t numIndices,
+    uint32_t targetNumIndices,
+    std::vector<IndexType>& outIndices);
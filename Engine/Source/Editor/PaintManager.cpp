@@ -8,9 +8,12 @@
 #include "InputDevices.h"
 #include "Viewport3d.h"
 #include "ActionManager.h"
+#include "VertexGrid.h"
 
 #include "Nodes/3D/InstancedMesh3d.h"
 
+#include <algorithm>
+
 constexpr uint8_t kMeshColGroup = 0x02;
 constexpr uint8_t kInstanceColGroup = 0x04;
 constexpr uint8_t kPaintSphereColGroup = 0x80;
@@ -86,17 +89,55 @@ void PaintManager::HandleNodeDestroy(Node* node)
 {
     StaticMesh3D* meshNode = node->As<StaticMesh3D>();
 
-    auto it = mMeshCollisionMap.find(meshNode);
-    if (it != mMeshCollisionMap.end())
+    if (meshNode != nullptr)
     {
-        RemovePaintMeshCollision(it->second);
-        delete it->second.mCollisionObject;
-        it->second.mCollisionObject = nullptr;
+        DestroyPaintMeshCollision(meshNode);
+        mDirtyMeshNodes.erase(meshNode);
+    }
+}
+
+void PaintManager::HandleNodeChanged(Node* node, bool includeChildren)
+{
+    if (!mTrackChanges)
+        return;
 
-        mMeshCollisionMap.erase(meshNode);
+    if (includeChildren)
+    {
+        node->Traverse([&](Node* child) -> bool
+            {
+                StaticMesh3D* meshNode = child->As<StaticMesh3D>();
+                if (meshNode != nullptr)
+                {
+                    mDirtyMeshNodes.insert(meshNode);
+                }
+                return true;
+            });
+    }
+    else
+    {
+        StaticMesh3D* meshNode = node->As<StaticMesh3D>();
+        if (meshNode != nullptr)
+        {
+            mDirtyMeshNodes.insert(meshNode);
+        }
     }
 }
 
+void PaintManager::HandleNodeRemoved(Node* node)
+{
+    // Removing the collision right away means the map never holds a node that left the world.
+    HandleNodeDestroy(node);
+}
+
+void PaintManager::StopTracking()
+{
+    // Nothing reports changes while we aren't painting, so the next update does a full sync.
+    mTrackChanges = false;
+    mDirtyMeshNodes.clear();
+    mTrackedSelection.clear();
+    mTrackedWorld = nullptr;
+}
+
 static btTransform ConvertToBulletTransform(glm::vec3 position, glm::quat rotation)
 {
     btTransform transform;
@@ -112,6 +153,14 @@ static btCollisionShape* CreateTriCollisionShape(StaticMesh* mesh, glm::vec3 sca
     return scaledTriangleShape;
 }
 
+static float GetMinAxisScale(const glm::mat4& transform)
+{
+    float scaleX = glm::length(glm::vec3(transform[0]));
+    float scaleY = glm::length(glm::vec3(transform[1]));
+    float scaleZ = glm::length(glm::vec3(transform[2]));
+    return glm::min(glm::min(scaleX, scaleY), scaleZ);
+}
+
 void PaintManager::AddPaintMeshCollision(const PaintMeshCollision& paintCol)
 {
     InstancedMesh3D* instMesh = paintCol.mNode->As<InstancedMesh3D>();
@@ -160,120 +209,177 @@ void PaintManager::RemovePaintMeshCollision(const PaintMeshCollision& paintCol)
     }
 }
 
-void PaintManager::UpdateDynamicsWorld()
+void PaintManager::DestroyPaintMeshCollision(StaticMesh3D* meshNode)
 {
-    World* world = GetWorld(0);
-    Node* rootNode = world ? world->GetRootNode() : nullptr;
+    auto it = mMeshCollisionMap.find(meshNode);
+    if (it != mMeshCollisionMap.end())
+    {
+        RemovePaintMeshCollision(it->second);
+        delete it->second.mCollisionObject;
+        it->second.mCollisionObject = nullptr;
 
-    // Iterate over all collision data and set active to false
-    // When we traverse the world and update collision data, we will mark visited nodes as active
-    // At the end, we remove and collision data that wasn't visited
-    for (auto& meshColPair : mMeshCollisionMap)
+        mMeshCollisionMap.erase(it);
+    }
+}
+
+void PaintManager::SyncPaintMeshCollision(StaticMesh3D* meshNode, bool onlySelected, bool forceRebuild)
+{
+    InstancedMesh3D* instMesh = meshNode->As<InstancedMesh3D>();
+
+    bool paintable =
+        meshNode->GetWorld() == mTrackedWorld &&
+        meshNode->IsVisible(true) &&
+        meshNode->GetStaticMesh() &&
+        (!onlySelected || GetEditorState()->IsNodeSelected(meshNode)) &&
+        (instMesh == nullptr || instMesh->GetNumInstances() > 0);
+
+    if (!paintable)
     {
-        meshColPair.second.mActive = false;
+        DestroyPaintMeshCollision(meshNode);
+        return;
     }
 
-    if (rootNode != nullptr)
+    StaticMesh* curMesh = meshNode->GetStaticMesh();
+    glm::vec3 curPosition = meshNode->GetWorldPosition();
+    glm::quat curRotation = meshNode->GetWorldRotationQuat();
+    glm::vec3 curScale = meshNode->GetWorldScale();
+
+    if (instMesh != nullptr)
     {
-        bool onlySelected = GetEditorState()->GetSelectedNodes().size() > 0;
+        instMesh->UpdateInstanceData();
+    }
 
-        auto updateMeshDynamics = [&](Node* node) -> bool
-            {
-                if (!node->IsVisible())
-                    return false;
+    // Does this node already exist in the map?
+    auto it = mMeshCollisionMap.find(meshNode);
 
-                StaticMesh3D* meshNode = node->As<StaticMesh3D>();
-                InstancedMesh3D* instMesh = node->As<InstancedMesh3D>();
+    if (it == mMeshCollisionMap.end())
+    {
+        btCollisionObject* colObject = new btCollisionObject();
+        colObject->setUserPointer(meshNode);
+
+        PaintMeshCollision paintCol;
+        paintCol.mCollisionObject = colObject;
+        paintCol.mNode = meshNode;
+        paintCol.mPosition = curPosition;
+        paintCol.mRotation = curRotation;
+        paintCol.mScale = curScale;
+        paintCol.mMesh = curMesh;
+        paintCol.mActive = true;
+
+        AddPaintMeshCollision(paintCol);
+
+        mMeshCollisionMap.insert({ meshNode, paintCol });
+        return;
+    }
 
-                if (meshNode && 
-                    meshNode->GetStaticMesh() &&
-                    (!onlySelected || GetEditorState()->IsNodeSelected(node)) &&
-                    (instMesh == nullptr || instMesh->GetNumInstances() > 0))
-                {
-                    StaticMesh* curMesh = meshNode->GetStaticMesh();
-                    glm::vec3 curPosition = meshNode->GetWorldPosition();
-                    glm::quat curRotation = meshNode->GetWorldRotationQuat();
-                    glm::vec3 curScale = meshNode->GetWorldScale();
+    PaintMeshCollision& paintCol = it->second;
 
-                    if (instMesh != nullptr)
-                    {
-                        instMesh->UpdateInstanceData();
-                    }
+    bool meshChanged = curMesh != paintCol.mMesh.Get();
+    bool posChanged = glm::any(glm::epsilonNotEqual(paintCol.mPosition, curPosition, 0.00001f));
+    bool rotChanged = glm::any(glm::epsilonNotEqual(paintCol.mRotation, curRotation, 0.00001f));
+    bool sclChanged = glm::any(glm::epsilonNotEqual(paintCol.mScale, curScale, 0.00001f));
 
-                    // Does this node already exist in the map?
-                    auto it = mMeshCollisionMap.find(meshNode);
+    if (meshChanged ||
+        sclChanged ||
+        forceRebuild)
+    {
+        RemovePaintMeshCollision(paintCol);
 
-                    if (it == mMeshCollisionMap.end())
-                    {
-                        btCollisionObject* colObject = new btCollisionObject();
-                        colObject->setUserPointer(meshNode);
+        paintCol.mPosition = curPosition;
+        paintCol.mRotation = curRotation;
+        paintCol.mScale = curScale;
+        paintCol.mMesh = curMesh;
 
-                        PaintMeshCollision paintCol;
-                        paintCol.mCollisionObject = colObject;
-                        paintCol.mNode = meshNode;
-                        paintCol.mPosition = curPosition;
-                        paintCol.mRotation = curRotation;
-                        paintCol.mScale = curScale;
-                        paintCol.mMesh = curMesh;
+        AddPaintMeshCollision(paintCol);
+    }
+    else if (posChanged || rotChanged)
+    {
+        // The shape is still valid, just move it.
+        paintCol.mPosition = curPosition;
+        paintCol.mRotation = curRotation;
+        paintCol.mCollisionObject->setWorldTransform(ConvertToBulletTransform(curPosition, curRotation));
+        mDynamicsWorld->updateSingleAabb(paintCol.mCollisionObject);
+    }
 
-                        AddPaintMeshCollision(paintCol);
+    paintCol.mActive = true;
+}
 
-                        mMeshCollisionMap.insert({ meshNode, paintCol });
-                        it = mMeshCollisionMap.find(meshNode);
-                    }
+void PaintManager::UpdateDynamicsWorld()
+{
+    World* world = GetWorld(0);
+    Node* rootNode = world ? world->GetRootNode() : nullptr;
+
+    if (rootNode != nullptr)
+    {
+        const std::vector<Node*>& selectedNodes = GetEditorState()->GetSelectedNodes();
+        bool onlySelected = selectedNodes.size() > 0;
 
-                    OCT_ASSERT(it != mMeshCollisionMap.end());
-                    PaintMeshCollision& paintCol = it->second;
+        if (!mTrackChanges ||
+            world != mTrackedWorld ||
+            selectedNodes != mTrackedSelection)
+        {
+            // Full sync. Iterate over all collision data and set active to false.
+            // When we traverse the world and update collision data, we will mark visited nodes as active.
+            // At the end, we remove any collision data that wasn't visited.
+            mTrackedWorld = world;
+            mTrackedSelection = selectedNodes;
+            mDirtyMeshNodes.clear();
+
+            for (auto& meshColPair : mMeshCollisionMap)
+            {
+                meshColPair.second.mActive = false;
+            }
 
-                    btCollisionObject* colObject = paintCol.mCollisionObject;
-                    btCollisionShape* colShape = colObject->getCollisionShape();
-                    const glm::mat4& curTransform = meshNode->GetTransform();
+            auto updateMeshDynamics = [&](Node* node) -> bool
+                {
+                    if (!node->IsVisible())
+                        return false;
 
-                    bool meshChanged = curMesh != paintCol.mMesh.Get();
-                    bool posChanged = glm::any(glm::epsilonNotEqual(paintCol.mPosition, curPosition, 0.00001f));
-                    bool rotChanged = glm::any(glm::epsilonNotEqual(paintCol.mRotation, curRotation, 0.00001f));
-                    bool sclChanged = glm::any(glm::epsilonNotEqual(paintCol.mScale, curScale, 0.00001f));
-                    bool instChanged = instMesh ? instMesh->WasInstanceDataUpdatedThisFrame() : false;
+                    StaticMesh3D* meshNode = node->As<StaticMesh3D>();
 
-                    if (meshChanged ||
-                        posChanged ||
-                        rotChanged ||
-                        sclChanged ||
-                        instChanged)
+                    if (meshNode != nullptr)
                     {
-                        RemovePaintMeshCollision(paintCol);
+                        InstancedMesh3D* instMesh = node->As<InstancedMesh3D>();
+                        bool instChanged = instMesh ? instMesh->WasInstanceDataUpdatedThisFrame() : false;
+                        SyncPaintMeshCollision(meshNode, onlySelected, instChanged);
+                    }
 
-                        paintCol.mPosition = curPosition;
-                        paintCol.mRotation = curRotation;
-                        paintCol.mScale = curScale;
-                        paintCol.mMesh = curMesh;
+                    return true;
+                };
 
-                        AddPaintMeshCollision(paintCol);
-                    }
+            rootNode->Traverse(updateMeshDynamics);
 
-                    paintCol.mActive = true;
+            for (auto it = mMeshCollisionMap.begin(); it != mMeshCollisionMap.end(); )
+            {
+                if (it->second.mActive)
+                {
+                    ++it;
                 }
+                else
+                {
+                    // No longer in the world
+                    RemovePaintMeshCollision(it->second);
 
-                return true;
-            };
-
-        rootNode->Traverse(updateMeshDynamics);
+                    delete it->second.mCollisionObject;
+                    it->second.mCollisionObject = nullptr;
 
-        for (auto it = mMeshCollisionMap.begin(); it != mMeshCollisionMap.end(); )
-        {
-            if (it->second.mActive)
-            {
-                ++it;
+                    it = mMeshCollisionMap.erase(it);
+                }
             }
-            else
-            {
-                // No longer in the world
-                RemovePaintMeshCollision(it->second);
 
-                delete it->second.mCollisionObject;
-                it->second.mCollisionObject = nullptr;
+            mTrackChanges = true;
+        }
+        else if (mDirtyMeshNodes.size() > 0)
+        {
+            // Syncing can dirty more nodes (updating a transform marks its children), those are picked up next frame.
+            std::vector<StaticMesh3D*> dirtyNodes(mDirtyMeshNodes.begin(), mDirtyMeshNodes.end());
+            mDirtyMeshNodes.clear();
 
-                it = mMeshCollisionMap.erase(it);
+            for (StaticMesh3D* meshNode : dirtyNodes)
+            {
+                // An instanced mesh is only reported when it moved or its instances changed, and its
+                // compound shape has to be regenerated for the latter.
+                SyncPaintMeshCollision(meshNode, onlySelected, meshNode->As<InstancedMesh3D>() != nullptr);
             }
         }
 
@@ -461,6 +567,7 @@ void PaintManager::UpdatePaintDraw()
         if (paintMode == PaintMode::Color)
         {
             std::vector<ActionSetInstanceColorsData> colorData;
+            std::vector<uint32_t> candidateVerts;
 
             const float sphereRad2 = mRadius * mRadius;
             int32_t numOverlaps = mSphereGhost->getNumOverlappingObjects();
@@ -524,8 +631,19 @@ void PaintManager::UpdatePaintDraw()
                 const glm::mat4& transform = mesh3d->GetTransform();
                 bool anyVertColored = false;
 
-                for (uint32_t v = 0; v < numVerts; ++v)
+                // Only visit the vertices in grid cells under the brush. The query runs in mesh space, with
+                // the radius divided by the smallest axis scale so non-uniform scale can only add candidates.
+                float minScale = GetMinAxisScale(transform);
+                if (minScale <= 0.0f)
+                    continue;
+
+                glm::vec3 sphereLocalPos = glm::vec3(glm::inverse(transform) * glm::vec4(mSpherePosition, 1.0f));
+                candidateVerts.clear();
+                mesh->GetVertexGrid()->QuerySphere(sphereLocalPos, mRadius / minScale, candidateVerts);
+
+                for (uint32_t candidate = 0; candidate < candidateVerts.size(); ++candidate)
                 {
+                    uint32_t v = candidateVerts[candidate];
                     glm::vec3 vertLocalPos = meshHasColor ? ((VertexColor*)vertices)[v].mPosition : ((Vertex*)vertices)[v].mPosition;
                     glm::vec3 vertWorldPos = glm::vec3(transform * glm::vec4(vertLocalPos, 1.0f));
 
@@ -699,11 +817,21 @@ void PaintManager::UpdatePaintDraw()
                         }
                     }
 #else
-                    // Use instance position to determine erase
+                    // Use instance position to determine erase. Only instances in the chunks under the brush
+                    // are tested, from the highest index down so removals don't shift the remaining ones.
                     const float sphereRad2 = mRadius * mRadius;
-                    int32_t numInst = (int32_t)instMesh->GetNumInstances();
+                    float minScale = GetMinAxisScale(nodeTransform);
+                    std::vector<int32_t> candidateInsts;
+
+                    if (minScale > 0.0f)
+                    {
+                        instMesh->UpdateInstanceData();
+                        glm::vec3 sphereLocalPos = glm::vec3(glm::inverse(nodeTransform) * glm::vec4(mSpherePosition, 1.0f));
+                        instMesh->GatherInstancesNear(sphereLocalPos, mRadius / minScale, candidateInsts);
+                        std::sort(candidateInsts.begin(), candidateInsts.end(), std::greater<int32_t>());
+                    }
 
-                    for (int32_t i = numInst - 1; i >= 0; --i)
+                    for (int32_t i : candidateInsts)
                     {
                         glm::vec3 instPos = instMesh->GetInstanceData(i).mPosition;
                         instPos = nodeTransform * glm::vec4(instPos, 1.0f);
@@ -736,6 +864,11 @@ void PaintManager::UpdatePaintDraw()
 
                     glm::mat4 invParentTransform = glm::inverse(instMesh->GetParentTransform());
 
+                    // Instances added by this paint aren't in the chunks yet, so they are checked separately.
+                    instMesh->UpdateInstanceData();
+                    const uint32_t numChunkedInsts = instMesh->GetNumInstances();
+                    std::vector<int32_t> nearbyInsts;
+
                     for (int32_t i = 0; i < numMeshes; ++i)
                     {
                         glm::vec3 normal = mSphereNormal;
@@ -769,13 +902,21 @@ void PaintManager::UpdatePaintDraw()
                                 const std::vector<MeshInstanceData>& instData = instMesh->GetInstanceData();
                                 bool tooClose = false;
 
-                                for (const MeshInstanceData& instDatum : instData)
+                                nearbyInsts.clear();
+                                instMesh->GatherInstancesNear(randPointLocal, mInstanceOptions.mMinSeparation, nearbyInsts);
+
+                                for (uint32_t n = numChunkedInsts; n < instData.size(); ++n)
+                                {
+                                    nearbyInsts.push_back(int32_t(n));
+                                }
+
+                                for (int32_t n : nearbyInsts)
                                 {
-                                    float instDist2 = glm::distance2(randPointLocal, instDatum.mPosition);
+                                    float instDist2 = glm::distance2(randPointLocal, instData[n].mPosition);
                                     if (instDist2 < minSep2)
                                     {
                                         tooClose = true;
-                                        break;;
+                                        break;
                                     }
                                 }
 
@@ -3,6 +3,7 @@
 #if EDITOR
 
 #include <unordered_map>
+#include <unordered_set>
 
 #include "Bullet/btBulletDynamicsCommon.h"
 #include "Bullet/BulletCollision/CollisionDispatch/btGhostObject.h"
@@ -79,9 +80,14 @@ public:
     ~PaintManager();
     void Update();
     void HandleNodeDestroy(Node* node);
+    void HandleNodeChanged(Node* node, bool includeChildren);
+    void HandleNodeRemoved(Node* node);
+    void StopTracking();
 
     void AddPaintMeshCollision(const PaintMeshCollision& col);
     void RemovePaintMeshCollision(const PaintMeshCollision& col);
+    void DestroyPaintMeshCollision(StaticMesh3D* meshNode);
+    void SyncPaintMeshCollision(StaticMesh3D* meshNode, bool onlySelected, bool forceRebuild);
 
     void UpdateDynamicsWorld();
     void UpdateHotkeys();
@@ -100,6 +106,13 @@ public:
 
     std::unordered_map<StaticMesh3D*, PaintMeshCollision> mMeshCollisionMap;
 
+    // After one full sync, only nodes reported by world events (add/remove/move/mesh/visibility)
+    // are synced. A world or selection change, or leaving paint mode, forces another full sync.
+    std::unordered_set<StaticMesh3D*> mDirtyMeshNodes;
+    World* mTrackedWorld = nullptr;
+    std::vector<Node*> mTrackedSelection;
+    bool mTrackChanges = false;
+
     btPairCachingGhostObject* mSphereGhost = nullptr;
     btSphereShape* mSphereGhostShape = nullptr;
     btGhostPairCallback* mGhostPairCallback = nullptr;
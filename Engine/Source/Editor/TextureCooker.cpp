@@ -0,0 +1,928 @@
+#if EDITOR
+
+#include "TextureCooker.h"
+#include "Maths.h"
+#include "Log.h"
+#include "Assertion.h"
+
+#include <string.h>
+#include <float.h>
+
+// GX texture formats (GX_TF_*)
+#define GX_FORMAT_IA4 0x2
+#define GX_FORMAT_RGB565 0x4
+#define GX_FORMAT_RGB5A3 0x5
+#define GX_FORMAT_RGBA8 0x6
+#define GX_FORMAT_CMPR 0xE
+
+// Citro3D texture formats (GPU_TEXCOLOR)
+#define C3D_FORMAT_RGBA8 0x0
+#define C3D_FORMAT_RGBA5551 0x2
+#define C3D_FORMAT_RGB565 0x3
+#define C3D_FORMAT_LA4 0x9
+#define C3D_FORMAT_ETC1 0xC
+#define C3D_FORMAT_ETC1A4 0xD
+
+#define TPL_MAGIC_NUMBER 0x0020AF30
+#define TPL_DATA_ALIGNMENT 32
+
+struct TileEncodeJob;
+typedef void(*EncodeTileFP)(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out);
+
+// Describes one mip level to encode and the tile format to encode it with.
+struct TileEncodeJob
+{
+    const uint8_t* mPixels = nullptr;
+    uint32_t mWidth = 0;
+    uint32_t mHeight = 0;
+    uint32_t mTileWidth = 4;
+    uint32_t mTileHeight = 4;
+    uint32_t mTileSize = 0;
+    bool mAlpha = false;
+    EncodeTileFP mEncodeTile = nullptr;
+    uint8_t* mOut = nullptr;
+};
+
+static const int32_t sEtc1Modifiers[8][2] =
+{
+    { 2, 8 },
+    { 5, 17 },
+    { 9, 29 },
+    { 13, 42 },
+    { 18, 60 },
+    { 24, 80 },
+    { 33, 106 },
+    { 47, 183 }
+};
+
+static uint32_t Quantize(uint32_t value, uint32_t maxValue)
+{
+    return (value * maxValue + 127) / 255;
+}
+
+static uint8_t GetLuminance(const uint8_t* rgba)
+{
+    return uint8_t((rgba[0] * 77 + rgba[1] * 150 + rgba[2] * 29 + 128) >> 8);
+}
+
+static void WriteUint16BE(uint8_t* out, uint16_t value)
+{
+    out[0] = uint8_t(value >> 8);
+    out[1] = uint8_t(value);
+}
+
+static void WriteUint32BE(uint8_t* out, uint32_t value)
+{
+    out[0] = uint8_t(value >> 24);
+    out[1] = uint8_t(value >> 16);
+    out[2] = uint8_t(value >> 8);
+    out[3] = uint8_t(value);
+}
+
+static void WriteUint16LE(uint8_t* out, uint16_t value)
+{
+    out[0] = uint8_t(value);
+    out[1] = uint8_t(value >> 8);
+}
+
+static void WriteUint64LE(uint8_t* out, uint64_t value)
+{
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        out[i] = uint8_t(value >> (i * 8));
+    }
+}
+
+static const uint8_t* GetTexel(const TileEncodeJob& job, uint32_t x, uint32_t y)
+{
+    // Partial tiles on the right and bottom edges repeat the edge texels.
+    x = glm::min(x, job.mWidth - 1);
+    y = glm::min(y, job.mHeight - 1);
+    return job.mPixels + (y * job.mWidth + x) * 4;
+}
+
+static void GetBlock(const TileEncodeJob& job, uint32_t x, uint32_t y, uint8_t outBlock[64])
+{
+    for (uint32_t by = 0; by < 4; ++by)
+    {
+        for (uint32_t bx = 0; bx < 4; ++bx)
+        {
+            memcpy(&outBlock[(by * 4 + bx) * 4], GetTexel(job, x + bx, y + by), 4);
+        }
+    }
+}
+
+static uint16_t PackRgb565(const glm::vec3& color)
+{
+    glm::vec3 c = glm::clamp(color, glm::vec3(0.0f), glm::vec3(255.0f));
+    uint32_t r = Quantize(uint32_t(c.r + 0.5f), 31);
+    uint32_t g = Quantize(uint32_t(c.g + 0.5f), 63);
+    uint32_t b = Quantize(uint32_t(c.b + 0.5f), 31);
+    return uint16_t((r << 11) | (g << 5) | b);
+}
+
+static glm::ivec3 UnpackRgb565(uint16_t color)
+{
+    int32_t r = (color >> 11) & 0x1f;
+    int32_t g = (color >> 5) & 0x3f;
+    int32_t b = color & 0x1f;
+    return glm::ivec3((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+}
+
+// CMPR sub-blocks are BC1 blocks with big endian colors. Endpoints come from the block's principal axis, inset slightly to reduce error.
+// Indices are returned in pixel order (row major), 0-3 as in the BC1 spec.
+static void EncodeDxtBlock(const uint8_t block[64], bool punchThrough, uint16_t& outColor0, uint16_t& outColor1, uint8_t outIndices[16])
+{
+    bool transparent[16] = {};
+    bool anyTransparent = false;
+    uint32_t numOpaque = 0;
+    glm::vec3 mean = glm::vec3(0.0f);
+
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        transparent[i] = punchThrough && block[i * 4 + 3] < 128;
+        anyTransparent = anyTransparent || transparent[i];
+
+        if (!transparent[i])
+        {
+            mean += glm::vec3(block[i * 4 + 0], block[i * 4 + 1], block[i * 4 + 2]);
+            ++numOpaque;
+        }
+    }
+
+    if (numOpaque == 0)
+    {
+        // Equal endpoints select the 3 color mode, where index 3 is transparent.
+        outColor0 = 0;
+        outColor1 = 0;
+        memset(outIndices, 3, 16);
+        return;
+    }
+
+    mean /= float(numOpaque);
+
+    glm::mat3 covariance = glm::mat3(0.0f);
+
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        if (!transparent[i])
+        {
+            glm::vec3 d = glm::vec3(block[i * 4 + 0], block[i * 4 + 1], block[i * 4 + 2]) - mean;
+            covariance += glm::outerProduct(d, d);
+        }
+    }
+
+    // Power iteration converges on the principal axis quickly enough for a 4x4 block.
+    glm::vec3 axis = glm::vec3(1.0f, 1.0f, 1.0f);
+
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        glm::vec3 next = covariance * axis;
+        float length = glm::length(next);
+
+        if (length < 0.0001f)
+            break;
+
+        axis = next / length;
+    }
+
+    axis = glm::normalize(axis);
+
+    float minT = FLT_MAX;
+    float maxT = -FLT_MAX;
+
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        if (!transparent[i])
+        {
+            float t = glm::dot(glm::vec3(block[i * 4 + 0], block[i * 4 + 1], block[i * 4 + 2]) - mean, axis);
+            minT = glm::min(minT, t);
+            maxT = glm::max(maxT, t);
+        }
+    }
+
+    float inset = (maxT - minT) / 16.0f;
+    uint16_t color0 = PackRgb565(mean + axis * (maxT - inset));
+    uint16_t color1 = PackRgb565(mean + axis * (minT + inset));
+
+    // color0 > color1 selects 4 colors, color0 <= color1 selects 3 colors + transparent.
+    if ((anyTransparent && color0 > color1) ||
+        (!anyTransparent && color0 < color1))
+    {
+        uint16_t temp = color0;
+        color0 = color1;
+        color1 = temp;
+    }
+
+    bool threeColor = (color0 <= color1);
+
+    glm::ivec3 palette[4];
+    palette[0] = UnpackRgb565(color0);
+    palette[1] = UnpackRgb565(color1);
+
+    if (threeColor)
+    {
+        palette[2] = (palette[0] + palette[1]) / 2;
+        palette[3] = glm::ivec3(0);
+    }
+    else
+    {
+        palette[2] = (palette[0] * 2 + palette[1]) / 3;
+        palette[3] = (palette[0] + palette[1] * 2) / 3;
+    }
+
+    uint32_t numColors = threeColor ? 3 : 4;
+
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        if (transparent[i])
+        {
+            outIndices[i] = 3;
+            continue;
+        }
+
+        glm::ivec3 color = glm::ivec3(block[i * 4 + 0], block[i * 4 + 1], block[i * 4 + 2]);
+        int32_t bestError = INT32_MAX;
+
+        for (uint32_t p = 0; p < numColors; ++p)
+        {
+            glm::ivec3 d = color - palette[p];
+            int32_t error = d.r * d.r + d.g * d.g + d.b * d.b;
+
+            if (error < bestError)
+            {
+                bestError = error;
+                outIndices[i] = uint8_t(p);
+            }
+        }
+    }
+
+    outColor0 = color0;
+    outColor1 = color1;
+}
+
+static int32_t ExpandEtcColor(int32_t value, bool differential)
+{
+    return differential ? ((value << 3) | (value >> 2)) : ((value << 4) | value);
+}
+
+static bool IsInEtcSubblock(uint32_t x, uint32_t y, bool flip, uint32_t subblock)
+{
+    return (flip ? (y < 2) : (x < 2)) == (subblock == 0);
+}
+
+// Picks the modifier table and per pixel selectors for one half of an ETC1 block. Returns the squared error.
+static uint32_t FitEtcSubblock(const uint8_t block[64], bool flip, uint32_t subblock, const glm::ivec3& base, uint32_t& outTable, uint8_t outSelectors[16])
+{
+    uint32_t bestError = UINT32_MAX;
+
+    for (uint32_t t = 0; t < 8; ++t)
+    {
+        uint32_t error = 0;
+        uint8_t selectors[16] = {};
+
+        for (uint32_t y = 0; y < 4; ++y)
+        {
+            for (uint32_t x = 0; x < 4; ++x)
+            {
+                if (!IsInEtcSubblock(x, y, flip, subblock))
+                    continue;
+
+                const uint8_t* texel = &block[(y * 4 + x) * 4];
+                uint32_t bestPixelError = UINT32_MAX;
+
+                for (uint32_t s = 0; s < 4; ++s)
+                {
+                    // Selector 0/1 add the small/large modifier, 2/3 subtract them.
+                    int32_t modifier = sEtc1Modifiers[t][s & 1] * ((s & 2) ? -1 : 1);
+                    uint32_t pixelError = 0;
+
+                    for (uint32_t c = 0; c < 3; ++c)
+                    {
+                        int32_t d = glm::clamp(base[c] + modifier, 0, 255) - int32_t(texel[c]);
+                        pixelError += uint32_t(d * d);
+                    }
+
+                    if (pixelError < bestPixelError)
+                    {
+                        bestPixelError = pixelError;
+                        selectors[x * 4 + y] = uint8_t(s);
+                    }
+                }
+
+                error += bestPixelError;
+            }
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            outTable = t;
+
+            for (uint32_t y = 0; y < 4; ++y)
+            {
+                for (uint32_t x = 0; x < 4; ++x)
+                {
+                    if (IsInEtcSubblock(x, y, flip, subblock))
+                    {
+                        outSelectors[x * 4 + y] = selectors[x * 4 + y];
+                    }
+                }
+            }
+        }
+    }
+
+    return bestError;
+}
+
+// Returns the 64 bit ETC1 block as defined by the spec (the first byte of the file format is the top byte).
+static uint64_t EncodeEtc1Block(const uint8_t block[64])
+{
+    uint64_t bestBlock = 0;
+    uint32_t bestError = UINT32_MAX;
+
+    for (uint32_t f = 0; f < 2; ++f)
+    {
+        bool flip = (f == 1);
+        glm::ivec3 average[2] = {};
+
+        for (uint32_t s = 0; s < 2; ++s)
+        {
+            glm::ivec3 sum = glm::ivec3(0);
+
+            for (uint32_t y = 0; y < 4; ++y)
+            {
+                for (uint32_t x = 0; x < 4; ++x)
+                {
+                    if (IsInEtcSubblock(x, y, flip, s))
+                    {
+                        const uint8_t* texel = &block[(y * 4 + x) * 4];
+                        sum += glm::ivec3(texel[0], texel[1], texel[2]);
+                    }
+                }
+            }
+
+            average[s] = (sum + 4) / 8;
+        }
+
+        for (uint32_t m = 0; m < 2; ++m)
+        {
+            bool differential = (m == 1);
+            uint32_t maxValue = differential ? 31 : 15;
+            glm::ivec3 quantized[2];
+
+            for (uint32_t s = 0; s < 2; ++s)
+            {
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    quantized[s][c] = int32_t(Quantize(uint32_t(average[s][c]), maxValue));
+                }
+            }
+
+            glm::ivec3 delta = quantized[1] - quantized[0];
+
+            if (differential &&
+                (glm::any(glm::lessThan(delta, glm::ivec3(-4))) || glm::any(glm::greaterThan(delta, glm::ivec3(3)))))
+            {
+                continue;
+            }
+
+            uint32_t tables[2] = {};
+            uint8_t selectors[16] = {};
+            uint32_t error = 0;
+
+            for (uint32_t s = 0; s < 2; ++s)
+            {
+                glm::ivec3 base;
+
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    base[c] = ExpandEtcColor(quantized[s][c], differential);
+                }
+
+                error += FitEtcSubblock(block, flip, s, base, tables[s], selectors);
+            }
+
+            if (error >= bestError)
+                continue;
+
+            uint64_t etc = 0;
+
+            if (differential)
+            {
+                etc |= uint64_t(quantized[0].r) << 59;
+                etc |= uint64_t(delta.r & 0x7) << 56;
+                etc |= uint64_t(quantized[0].g) << 51;
+                etc |= uint64_t(delta.g & 0x7) << 48;
+                etc |= uint64_t(quantized[0].b) << 43;
+                etc |= uint64_t(delta.b & 0x7) << 40;
+            }
+            else
+            {
+                etc |= uint64_t(quantized[0].r) << 60;
+                etc |= uint64_t(quantized[1].r) << 56;
+                etc |= uint64_t(quantized[0].g) << 52;
+                etc |= uint64_t(quantized[1].g) << 48;
+                etc |= uint64_t(quantized[0].b) << 44;
+                etc |= uint64_t(quantized[1].b) << 40;
+            }
+
+            etc |= uint64_t(tables[0]) << 37;
+            etc |= uint64_t(tables[1]) << 34;
+            etc |= uint64_t(differential ? 1 : 0) << 33;
+            etc |= uint64_t(flip ? 1 : 0) << 32;
+
+            // Selectors are stored column major, the high bits in the upper half word.
+            for (uint32_t p = 0; p < 16; ++p)
+            {
+                etc |= uint64_t(selectors[p] >> 1) << (16 + p);
+                etc |= uint64_t(selectors[p] & 1) << p;
+            }
+
+            bestError = error;
+            bestBlock = etc;
+        }
+    }
+
+    return bestBlock;
+}
+
+//----------------------------------------------------
+// GX tile encoders (big endian)
+//----------------------------------------------------
+static void EncodeTileIA4(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    for (uint32_t y = 0; y < 4; ++y)
+    {
+        for (uint32_t x = 0; x < 8; ++x)
+        {
+            const uint8_t* texel = GetTexel(job, tileX * 8 + x, tileY * 4 + y);
+            *out++ = uint8_t((Quantize(texel[3], 15) << 4) | Quantize(GetLuminance(texel), 15));
+        }
+    }
+}
+
+static void EncodeTileRGB565(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    for (uint32_t y = 0; y < 4; ++y)
+    {
+        for (uint32_t x = 0; x < 4; ++x)
+        {
+            const uint8_t* texel = GetTexel(job, tileX * 4 + x, tileY * 4 + y);
+            uint16_t value = uint16_t((Quantize(texel[0], 31) << 11) | (Quantize(texel[1], 63) << 5) | Quantize(texel[2], 31));
+            WriteUint16BE(out, value);
+            out += 2;
+        }
+    }
+}
+
+static void EncodeTileRGB5A3(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    for (uint32_t y = 0; y < 4; ++y)
+    {
+        for (uint32_t x = 0; x < 4; ++x)
+        {
+            const uint8_t* texel = GetTexel(job, tileX * 4 + x, tileY * 4 + y);
+            uint32_t alpha = Quantize(texel[3], 7);
+            uint16_t value = 0;
+
+            if (alpha == 7)
+            {
+                // Opaque texels get 5 bits per color channel.
+                value = uint16_t(0x8000 | (Quantize(texel[0], 31) << 10) | (Quantize(texel[1], 31) << 5) | Quantize(texel[2], 31));
+            }
+            else
+            {
+                value = uint16_t((alpha << 12) | (Quantize(texel[0], 15) << 8) | (Quantize(texel[1], 15) << 4) | Quantize(texel[2], 15));
+            }
+
+            WriteUint16BE(out, value);
+            out += 2;
+        }
+    }
+}
+
+static void EncodeTileRGBA8(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    // The first 32 bytes hold AR pairs, the second 32 bytes GB pairs.
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        const uint8_t* texel = GetTexel(job, tileX * 4 + (i % 4), tileY * 4 + (i / 4));
+        out[i * 2 + 0] = texel[3];
+        out[i * 2 + 1] = texel[0];
+        out[32 + i * 2 + 0] = texel[1];
+        out[32 + i * 2 + 1] = texel[2];
+    }
+}
+
+static void EncodeTileCMPR(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    // An 8x8 tile holds four DXT1 style sub-blocks in row major order.
+    for (uint32_t b = 0; b < 4; ++b)
+    {
+        uint8_t block[64];
+        GetBlock(job, tileX * 8 + (b % 2) * 4, tileY * 8 + (b / 2) * 4, block);
+
+        uint16_t color0 = 0;
+        uint16_t color1 = 0;
+        uint8_t indices[16];
+        EncodeDxtBlock(block, job.mAlpha, color0, color1, indices);
+
+        WriteUint16BE(out + 0, color0);
+        WriteUint16BE(out + 2, color1);
+
+        // One byte per row, leftmost texel in the top bits.
+        for (uint32_t y = 0; y < 4; ++y)
+        {
+            out[4 + y] = uint8_t((indices[y * 4 + 0] << 6) | (indices[y * 4 + 1] << 4) | (indices[y * 4 + 2] << 2) | indices[y * 4 + 3]);
+        }
+
+        out += 8;
+    }
+}
+
+//----------------------------------------------------
+// Citro3D tile encoders (little endian, 8x8 tiles in Z order)
+//----------------------------------------------------
+static const uint8_t* GetMortonTexel(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint32_t i)
+{
+    uint32_t x = (i & 1) | ((i >> 1) & 2) | ((i >> 2) & 4);
+    uint32_t y = ((i >> 1) & 1) | ((i >> 2) & 2) | ((i >> 3) & 4);
+    return GetTexel(job, tileX * 8 + x, tileY * 8 + y);
+}
+
+static void EncodeTileC3dRGBA8(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        const uint8_t* texel = GetMortonTexel(job, tileX, tileY, i);
+        *out++ = texel[3];
+        *out++ = texel[2];
+        *out++ = texel[1];
+        *out++ = texel[0];
+    }
+}
+
+static void EncodeTileC3dRGB565(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        const uint8_t* texel = GetMortonTexel(job, tileX, tileY, i);
+        WriteUint16LE(out, uint16_t((Quantize(texel[0], 31) << 11) | (Quantize(texel[1], 63) << 5) | Quantize(texel[2], 31)));
+        out += 2;
+    }
+}
+
+static void EncodeTileC3dRGBA5551(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        const uint8_t* texel = GetMortonTexel(job, tileX, tileY, i);
+        uint32_t alpha = (texel[3] >= 128) ? 1 : 0;
+        WriteUint16LE(out, uint16_t((Quantize(texel[0], 31) << 11) | (Quantize(texel[1], 31) << 6) | (Quantize(texel[2], 31) << 1) | alpha));
+        out += 2;
+    }
+}
+
+static void EncodeTileC3dLA4(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        const uint8_t* texel = GetMortonTexel(job, tileX, tileY, i);
+        *out++ = uint8_t((Quantize(GetLuminance(texel), 15) << 4) | Quantize(texel[3], 15));
+    }
+}
+
+static void EncodeTileC3dETC1(const TileEncodeJob& job, uint32_t tileX, uint32_t tileY, uint8_t* out)
+{
+    // An 8x8 tile holds four 4x4 blocks in row major order, each stored as a little endian 64 bit word.
+    // ETC1A4 prefixes every block with 4 bit alpha, also column major.
+    for (uint32_t b = 0; b < 4; ++b)
+    {
+        uint8_t block[64];
+        GetBlock(job, tileX * 8 + (b % 2) * 4, tileY * 8 + (b / 2) * 4, block);
+
+        if (job.mAlpha)
+        {
+            uint64_t alpha = 0;
+
+            for (uint32_t y = 0; y < 4; ++y)
+            {
+                for (uint32_t x = 0; x < 4; ++x)
+                {
+                    alpha |= uint64_t(Quantize(block[(y * 4 + x) * 4 + 3], 15)) << ((x * 4 + y) * 4);
+                }
+            }
+
+            WriteUint64LE(out, alpha);
+            out += 8;
+        }
+
+        WriteUint64LE(out, EncodeEtc1Block(block));
+        out += 8;
+    }
+}
+
+//----------------------------------------------------
+// Shared
+//----------------------------------------------------
+static void EncodeTileRow(const TileEncodeJob& job, uint32_t tileY)
+{
+    uint32_t tilesX = (job.mWidth + job.mTileWidth - 1) / job.mTileWidth;
+    uint8_t* out = job.mOut + tileY * tilesX * job.mTileSize;
+
+    for (uint32_t tileX = 0; tileX < tilesX; ++tileX)
+    {
+        job.mEncodeTile(job, tileX, tileY, out);
+        out += job.mTileSize;
+    }
+}
+
+// Encodes a mip level and appends it to outData. Runs on the calling thread. CookTexture() is already
+// called from several cook threads at once, so spawning more threads per level would only oversubscribe them.
+static void EncodeLevel(TileEncodeJob& job, std::vector<uint8_t>& outData)
+{
+    uint32_t tilesX = (job.mWidth + job.mTileWidth - 1) / job.mTileWidth;
+    uint32_t tilesY = (job.mHeight + job.mTileHeight - 1) / job.mTileHeight;
+    size_t offset = outData.size();
+    outData.resize(offset + tilesX * tilesY * job.mTileSize);
+    job.mOut = outData.data() + offset;
+
+    for (uint32_t tileY = 0; tileY < tilesY; ++tileY)
+    {
+        EncodeTileRow(job, tileY);
+    }
+
+    job.mOut = nullptr;
+}
+
+static void GenerateMip(const std::vector<uint8_t>& src, uint32_t srcWidth, uint32_t srcHeight, std::vector<uint8_t>& dst)
+{
+    uint32_t width = glm::max(srcWidth / 2, 1u);
+    uint32_t height = glm::max(srcHeight / 2, 1u);
+    dst.resize(width * height * 4);
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        uint32_t y0 = glm::min(y * 2, srcHeight - 1);
+        uint32_t y1 = glm::min(y * 2 + 1, srcHeight - 1);
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            uint32_t x0 = glm::min(x * 2, srcWidth - 1);
+            uint32_t x1 = glm::min(x * 2 + 1, srcWidth - 1);
+
+            for (uint32_t c = 0; c < 4; ++c)
+            {
+                uint32_t sum =
+                    src[(y0 * srcWidth + x0) * 4 + c] +
+                    src[(y0 * srcWidth + x1) * 4 + c] +
+                    src[(y1 * srcWidth + x0) * 4 + c] +
+                    src[(y1 * srcWidth + x1) * 4 + c];
+
+                dst[(y * width + x) * 4 + c] = uint8_t((sum + 2) / 4);
+            }
+        }
+    }
+}
+
+static void AnalyzeAlpha(const std::vector<uint8_t>& pixels, bool& outOpaque, bool& outBinaryAlpha)
+{
+    outOpaque = true;
+    outBinaryAlpha = true;
+
+    for (uint32_t i = 3; i < pixels.size(); i += 4)
+    {
+        outOpaque = outOpaque && (pixels[i] == 0xff);
+        outBinaryAlpha = outBinaryAlpha && (pixels[i] == 0xff || pixels[i] == 0x00);
+    }
+}
+
+static uint32_t NextPowerOfTwo(uint32_t value)
+{
+    uint32_t pow2 = 1;
+
+    while (pow2 < value)
+    {
+        pow2 <<= 1;
+    }
+
+    return pow2;
+}
+
+// Encodes numLevels mip levels, each generated from the previous one.
+static void EncodeMipChain(TileEncodeJob& job, const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, uint32_t numLevels, std::vector<uint8_t>& outData)
+{
+    std::vector<uint8_t> level = pixels;
+    std::vector<uint8_t> nextLevel;
+
+    for (uint32_t i = 0; i < numLevels; ++i)
+    {
+        if (i > 0)
+        {
+            GenerateMip(level, width, height, nextLevel);
+            level.swap(nextLevel);
+            width = glm::max(width / 2, 1u);
+            height = glm::max(height / 2, 1u);
+        }
+
+        job.mPixels = level.data();
+        job.mWidth = width;
+        job.mHeight = height;
+        EncodeLevel(job, outData);
+    }
+
+    job.mPixels = nullptr;
+}
+
+void CookTextureTpl(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, PixelFormat format, bool mipmapped, std::vector<uint8_t>& outData)
+{
+    OCT_ASSERT(pixels.size() == width * height * 4);
+
+    bool opaque = true;
+    bool binaryAlpha = true;
+    AnalyzeAlpha(pixels, opaque, binaryAlpha);
+
+    TileEncodeJob job;
+    uint32_t gxFormat = GX_FORMAT_RGBA8;
+
+    // CMPR only has 1 bit alpha. Textures with smooth alpha use RGB5A3 instead.
+    if (format == PixelFormat::CMPR && !binaryAlpha)
+    {
+        format = PixelFormat::RGBA5551;
+    }
+
+    switch (format)
+    {
+    case PixelFormat::LA4: gxFormat = GX_FORMAT_IA4; job.mTileWidth = 8; job.mTileHeight = 4; job.mTileSize = 32; job.mEncodeTile = EncodeTileIA4; break;
+    case PixelFormat::RGB565: gxFormat = GX_FORMAT_RGB565; job.mTileSize = 32; job.mEncodeTile = EncodeTileRGB565; break;
+    case PixelFormat::RGBA5551: gxFormat = GX_FORMAT_RGB5A3; job.mTileSize = 32; job.mEncodeTile = EncodeTileRGB5A3; break;
+    case PixelFormat::CMPR: gxFormat = GX_FORMAT_CMPR; job.mTileWidth = 8; job.mTileHeight = 8; job.mTileSize = 32; job.mEncodeTile = EncodeTileCMPR; job.mAlpha = !opaque; break;
+    case PixelFormat::RGBA8: // Fallthrough to default
+    default: gxFormat = GX_FORMAT_RGBA8; job.mTileSize = 64; job.mEncodeTile = EncodeTileRGBA8; break;
+    }
+
+    uint32_t maxLod = 0;
+
+    if (mipmapped)
+    {
+        // Same mip range gxtexconv was invoked with, the smallest level is 4 texels on the short side.
+        int32_t lod = static_cast<int32_t>(floor(log2(glm::min(width, height))) + 1) - 3;
+        maxLod = uint32_t(glm::max(lod, 0));
+    }
+
+    // Header, one texture descriptor, and one image header, padded so the texel data is 32 byte aligned.
+    const uint32_t descOffset = 12;
+    const uint32_t imageHeaderOffset = descOffset + 8;
+    const uint32_t imageHeaderSize = 36;
+    const uint32_t dataOffset = ((imageHeaderOffset + imageHeaderSize) + TPL_DATA_ALIGNMENT - 1) & ~(TPL_DATA_ALIGNMENT - 1);
+
+    outData.clear();
+    outData.resize(dataOffset, 0);
+
+    uint8_t* header = outData.data();
+    WriteUint32BE(header + 0, TPL_MAGIC_NUMBER);
+    WriteUint32BE(header + 4, 1);
+    WriteUint32BE(header + 8, descOffset);
+    WriteUint32BE(header + descOffset + 0, imageHeaderOffset);
+    WriteUint32BE(header + descOffset + 4, 0); // No palette
+
+    uint8_t* image = header + imageHeaderOffset;
+    WriteUint16BE(image + 0, uint16_t(height));
+    WriteUint16BE(image + 2, uint16_t(width));
+    WriteUint32BE(image + 4, gxFormat);
+    WriteUint32BE(image + 8, dataOffset);
+    WriteUint32BE(image + 12, 1); // Wrap S (GX_REPEAT). Graphics_GX applies the texture's wrap mode.
+    WriteUint32BE(image + 16, 1); // Wrap T
+    WriteUint32BE(image + 20, mipmapped ? 5 : 1); // Min filter (GX_LIN_MIP_LIN or GX_LINEAR)
+    WriteUint32BE(image + 24, 1); // Mag filter (GX_LINEAR)
+    WriteUint32BE(image + 28, 0); // LOD bias (0.0f)
+    image[32] = 0; // Edge LOD
+    image[33] = 0; // Min LOD
+    image[34] = uint8_t(maxLod);
+    image[35] = 0; // Unpacked
+
+    EncodeMipChain(job, pixels, width, height, maxLod + 1, outData);
+}
+
+void CookTextureT3x(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, PixelFormat format, bool mipmapped, std::vector<uint8_t>& outData)
+{
+    OCT_ASSERT(pixels.size() == width * height * 4);
+
+    // The PICA200 samples from the bottom row up, so flip the image.
+    const uint32_t rowSize = width * 4;
+    std::vector<uint8_t> flippedPixels(pixels.size());
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        memcpy(&flippedPixels[y * rowSize], &pixels[(height - 1 - y) * rowSize], rowSize);
+    }
+
+    // Citro3D textures must be a power of two between 8 and 1024 on each side.
+    uint32_t texWidth = glm::clamp<uint32_t>(NextPowerOfTwo(width), 8, 1024);
+    uint32_t texHeight = glm::clamp<uint32_t>(NextPowerOfTwo(height), 8, 1024);
+    std::vector<uint8_t> texPixels;
+
+    if (texWidth != width || texHeight != height)
+    {
+        LogWarning("Resampling %dx%d texture to %dx%d for 3DS", width, height, texWidth, texHeight);
+        texPixels.resize(texWidth * texHeight * 4);
+
+        for (uint32_t y = 0; y < texHeight; ++y)
+        {
+            for (uint32_t x = 0; x < texWidth; ++x)
+            {
+                uint32_t srcX = (x * width) / texWidth;
+                uint32_t srcY = (y * height) / texHeight;
+                memcpy(&texPixels[(y * texWidth + x) * 4], &flippedPixels[(srcY * width + srcX) * 4], 4);
+            }
+        }
+    }
+    else
+    {
+        texPixels.swap(flippedPixels);
+    }
+
+    bool opaque = true;
+    bool binaryAlpha = true;
+    AnalyzeAlpha(texPixels, opaque, binaryAlpha);
+
+    TileEncodeJob job;
+    job.mTileWidth = 8;
+    job.mTileHeight = 8;
+    uint8_t c3dFormat = C3D_FORMAT_RGBA8;
+
+    switch (format)
+    {
+    case PixelFormat::LA4: c3dFormat = C3D_FORMAT_LA4; job.mTileSize = 64; job.mEncodeTile = EncodeTileC3dLA4; break;
+    case PixelFormat::RGB565: c3dFormat = C3D_FORMAT_RGB565; job.mTileSize = 128; job.mEncodeTile = EncodeTileC3dRGB565; break;
+    case PixelFormat::RGBA5551: c3dFormat = C3D_FORMAT_RGBA5551; job.mTileSize = 128; job.mEncodeTile = EncodeTileC3dRGBA5551; break;
+    case PixelFormat::CMPR:
+        c3dFormat = opaque ? C3D_FORMAT_ETC1 : C3D_FORMAT_ETC1A4;
+        job.mTileSize = opaque ? 32 : 64;
+        job.mEncodeTile = EncodeTileC3dETC1;
+        job.mAlpha = !opaque;
+        break;
+    case PixelFormat::RGBA8: // Fallthrough to default
+    default: c3dFormat = C3D_FORMAT_RGBA8; job.mTileSize = 256; job.mEncodeTile = EncodeTileC3dRGBA8; break;
+    }
+
+    uint32_t numLevels = 1;
+
+    if (mipmapped)
+    {
+        // Mip down until the short side reaches a single 8x8 tile.
+        while ((glm::min(texWidth, texHeight) >> numLevels) >= 8)
+        {
+            ++numLevels;
+        }
+    }
+
+    std::vector<uint8_t> texData;
+    EncodeMipChain(job, texPixels, texWidth, texHeight, numLevels, texData);
+
+    // Tex3DS header, followed by one sub-texture covering the whole texture.
+    uint8_t header[17] = {};
+    uint32_t widthLog2 = uint32_t(log2(texWidth)) - 3;
+    uint32_t heightLog2 = uint32_t(log2(texHeight)) - 3;
+    WriteUint16LE(header + 0, 1);
+    header[2] = uint8_t(widthLog2 | (heightLog2 << 3)); // Type bit (6) is 0 for GPU_TEX_2D
+    header[3] = c3dFormat;
+    header[4] = uint8_t(numLevels - 1);
+    WriteUint16LE(header + 5, uint16_t(texWidth));
+    WriteUint16LE(header + 7, uint16_t(texHeight));
+    WriteUint16LE(header + 9, 0); // Left
+    WriteUint16LE(header + 11, 1024); // Top (1.0 in 10 bit fixed point)
+    WriteUint16LE(header + 13, 1024); // Right
+    WriteUint16LE(header + 15, 0); // Bottom
+
+    // The texel data goes through libctru's decompressor, so store it uncompressed.
+    uint8_t compressionHeader[8] = {};
+    uint32_t compressionHeaderSize = 4;
+    uint32_t texDataSize = uint32_t(texData.size());
+
+    if (texDataSize < (1 << 24))
+    {
+        compressionHeader[0] = 0x00; // DECOMPRESS_NONE
+        compressionHeader[1] = uint8_t(texDataSize);
+        compressionHeader[2] = uint8_t(texDataSize >> 8);
+        compressionHeader[3] = uint8_t(texDataSize >> 16);
+    }
+    else
+    {
+        // A zero 24 bit size means a 32 bit size follows.
+        compressionHeaderSize = 8;
+        compressionHeader[4] = uint8_t(texDataSize);
+        compressionHeader[5] = uint8_t(texDataSize >> 8);
+        compressionHeader[6] = uint8_t(texDataSize >> 16);
+        compressionHeader[7] = uint8_t(texDataSize >> 24);
+    }
+
+    outData.clear();
+    outData.reserve(sizeof(header) + compressionHeaderSize + texData.size());
+    outData.insert(outData.end(), header, header + sizeof(header));
+    outData.insert(outData.end(), compressionHeader, compressionHeader + compressionHeaderSize);
+    outData.insert(outData.end(), texData.begin(), texData.end());
+}
+
+#endif
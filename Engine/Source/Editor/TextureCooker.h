@@ -0,0 +1,15 @@
+#pragma once
+
+#include "EngineTypes.h"
+#include "Graphics/GraphicsTypes.h"
+
+#include <vector>
+
+// In-process replacements for gxtexconv and tex3ds. Both take RGBA8 pixels with rows ordered top to bottom,
+// build the mip chain, and encode every level into the container the platform's graphics backend loads.
+
+// Produces a single texture TPL file, as read by TPL_OpenTPLFromMemory() in Graphics_GX.
+void CookTextureTpl(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, PixelFormat format, bool mipmapped, std::vector<uint8_t>& outData);
+
+// Produces a T3X file, as read by Tex3DS_TextureImport() in Graphics_C3D.
+void CookTextureT3x(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, PixelFormat format, bool mipmapped, std::vector<uint8_t>& outData);
@@ -0,0 +1,139 @@
+#if EDITOR
+
+#include "VertexGrid.h"
+#include "Assertion.h"
+
+// Average number of vertices per cell the grid is sized for.
+#define VERTEX_GRID_TARGET_PER_CELL 8.0f
+#define VERTEX_GRID_MAX_DIM 1024
+#define VERTEX_GRID_MAX_CELLS (1 << 20)
+
+// Thin axes are treated as at least this fraction of the largest one when sizing cells, so flat
+// meshes like terrain still get a sensible cell size.
+#define VERTEX_GRID_MIN_EXTENT_RATIO 0.01f
+
+static glm::vec3 GetVertexPosition(const void* vertices, uint32_t vertexStride, uint32_t index)
+{
+    return *reinterpret_cast<const glm::vec3*>(reinterpret_cast<const uint8_t*>(vertices) + size_t(index) * vertexStride);
+}
+
+void VertexGrid::Build(const void* vertices, uint32_t vertexStride, uint32_t numVertices)
+{
+    mCellStarts.clear();
+    mCellVertices.clear();
+    mDims = glm::ivec3(0);
+
+    if (numVertices == 0)
+    {
+        return;
+    }
+
+    OCT_ASSERT(vertices != nullptr);
+
+    glm::vec3 minPos = GetVertexPosition(vertices, vertexStride, 0);
+    glm::vec3 maxPos = minPos;
+
+    for (uint32_t i = 1; i < numVertices; ++i)
+    {
+        glm::vec3 pos = GetVertexPosition(vertices, vertexStride, i);
+        minPos = glm::min(minPos, pos);
+        maxPos = glm::max(maxPos, pos);
+    }
+
+    glm::vec3 extent = maxPos - minPos;
+    float maxExtent = glm::max(glm::max(extent.x, extent.y), extent.z);
+    maxExtent = glm::max(maxExtent, 0.001f);
+
+    glm::vec3 sizingExtent = glm::max(extent, glm::vec3(maxExtent * VERTEX_GRID_MIN_EXTENT_RATIO));
+    float volume = sizingExtent.x * sizingExtent.y * sizingExtent.z;
+    float cellSize = cbrtf(volume * VERTEX_GRID_TARGET_PER_CELL / float(numVertices));
+    cellSize = glm::max(cellSize, maxExtent / VERTEX_GRID_MAX_DIM);
+
+    glm::ivec3 dims;
+
+    while (true)
+    {
+        dims = glm::max(glm::ivec3(glm::ceil(extent / cellSize)), glm::ivec3(1));
+
+        if (int64_t(dims.x) * dims.y * dims.z <= VERTEX_GRID_MAX_CELLS)
+        {
+            break;
+        }
+
+        cellSize *= 1.25f;
+    }
+
+    mMin = minPos;
+    mCellSize = cellSize;
+    mDims = dims;
+
+    uint32_t numCells = uint32_t(dims.x * dims.y * dims.z);
+    std::vector<uint32_t> vertexCells(numVertices);
+    mCellStarts.assign(numCells + 1, 0);
+
+    for (uint32_t i = 0; i < numVertices; ++i)
+    {
+        glm::ivec3 cell = CalculateCell(GetVertexPosition(vertices, vertexStride, i));
+        uint32_t cellIndex = uint32_t((cell.z * mDims.y + cell.y) * mDims.x + cell.x);
+        vertexCells[i] = cellIndex;
+        mCellStarts[cellIndex + 1]++;
+    }
+
+    for (uint32_t i = 0; i < numCells; ++i)
+    {
+        mCellStarts[i + 1] += mCellStarts[i];
+    }
+
+    std::vector<uint32_t> cellFill(mCellStarts.begin(), mCellStarts.end() - 1);
+    mCellVertices.resize(numVertices);
+
+    for (uint32_t i = 0; i < numVertices; ++i)
+    {
+        mCellVertices[cellFill[vertexCells[i]]++] = i;
+    }
+}
+
+void VertexGrid::QuerySphere(glm::vec3 center, float radius, std::vector<uint32_t>& outVertices) const
+{
+    if (mCellVertices.empty())
+    {
+        return;
+    }
+
+    glm::vec3 maxPos = mMin + glm::vec3(mDims) * mCellSize;
+
+    if (glm::any(glm::lessThan(center + radius, mMin)) ||
+        glm::any(glm::greaterThan(center - radius, maxPos)))
+    {
+        return;
+    }
+
+    glm::ivec3 minCell = CalculateCell(center - radius);
+    glm::ivec3 maxCell = CalculateCell(center + radius);
+
+    for (int32_t z = minCell.z; z <= maxCell.z; ++z)
+    {
+        for (int32_t y = minCell.y; y <= maxCell.y; ++y)
+        {
+            uint32_t rowIndex = uint32_t((z * mDims.y + y) * mDims.x);
+            uint32_t start = mCellStarts[rowIndex + minCell.x];
+            uint32_t end = mCellStarts[rowIndex + maxCell.x + 1];
+
+            // Cells along x are contiguous, so the whole row span is one range.
+            outVertices.insert(outVertices.end(), mCellVertices.begin() + start, mCellVertices.begin() + end);
+        }
+    }
+}
+
+uint32_t VertexGrid::GetNumVertices() const
+{
+    return uint32_t(mCellVertices.size());
+}
+
+glm::ivec3 VertexGrid::CalculateCell(glm::vec3 position) const
+{
+    glm::ivec3 cell = glm::ivec3(glm::floor((position - mMin) / mCellSize));
+    return glm::clamp(cell, glm::ivec3(0), mDims - 1);
+}
+
+#endif
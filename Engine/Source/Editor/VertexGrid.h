@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Maths.h"
+
+#include <stdint.h>
+#include <vector>
+
+// Uniform grid over a mesh's vertex positions (object space), used by the paint tools to find the
+// vertices under the brush without visiting the whole mesh. Each vertex must begin with a
+// glm::vec3 position. StaticMesh builds and caches one on first use.
+class VertexGrid
+{
+public:
+
+    void Build(const void* vertices, uint32_t vertexStride, uint32_t numVertices);
+
+    // Appends every vertex in a cell overlapped by the sphere's bounding box. Candidates may still
+    // lie outside the sphere, so callers do the exact test.
+    void QuerySphere(glm::vec3 center, float radius, std::vector<uint32_t>& outVertices) const;
+
+    uint32_t GetNumVertices() const;
+
+protected:
+
+    glm::ivec3 CalculateCell(glm::vec3 position) const;
+
+    glm::vec3 mMin = {};
+    float mCellSize = 1.0f;
+    glm::ivec3 mDims = {};
+
+    // Vertices of cell i are mCellVertices[mCellStarts[i] .. mCellStarts[i + 1]).
+    std::vector<uint32_t> mCellStarts;
+    std::vector<uint32_t> mCellVertices;
+};
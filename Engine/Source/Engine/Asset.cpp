@@ -58,13 +58,18 @@ Asset::Asset()
 
 Asset::~Asset()
 {
-
+    if (mResidency.mResident)
+    {
+        UpdateResidency(false);
+    }
 }
 
 void Asset::Create()
 {
     OCT_ASSERT(!mLoaded);
     mLoaded = true;
+    Touch();
+    UpdateResidency(true);
 }
 
 void Asset::Destroy()
@@ -75,6 +80,8 @@ void Asset::Destroy()
         AssetRef::EraseReferencesToAsset(this);
     }
 #endif
+
+    UpdateResidency(false);
 }
 
 void Asset::Copy(Asset* srcAsset)
@@ -130,6 +137,11 @@ bool Asset::IsEngineAsset() const
 void Asset::SetEngineAsset(bool engineAsset)
 {
     mEngineAsset = engineAsset;
+
+    if (mResidency.mResident)
+    {
+        UpdateResidency(true);
+    }
 }
 
 void Asset::SetName(const std::string& name)
@@ -147,12 +159,35 @@ void Asset::IncrementRefCount()
     //}
 
     mRefCount++;
+
+    if (mRefCount == 1 &&
+        mResidency.mResident)
+    {
+        // No longer a candidate for eviction.
+        UpdateResidency(true);
+    }
 }
 
 void Asset::DecrementRefCount()
 {
     mRefCount--;
     OCT_ASSERT(mRefCount >= 0 || AssetManager::Get()->IsPurging());
+
+    if (mRefCount == 0)
+    {
+        // Losing the last reference counts as the last use for eviction order.
+        Touch();
+
+        if (mResidency.mResident)
+        {
+            UpdateResidency(true);
+        }
+
+        if (AssetManager::Get() != nullptr)
+        {
+            AssetManager::Get()->NotifyUnreferenced(this);
+        }
+    }
 }
 
 void Asset::LoadFile(const char* path, AsyncLoadRequest* request)
@@ -174,14 +209,29 @@ void Asset::LoadFile(const char* path, AsyncLoadRequest* request)
     LogDebug("Asset loaded: %s", mName.c_str());
 }
 
-void Asset::SaveFile(const char* path, Platform platform)
+bool Asset::SaveFile(const char* path, Platform platform, std::vector<std::string>* outReferencedAssets)
 {
+    bool success = false;
+
 #if EDITOR
     Stream stream;
+    stream.SetWrittenAssetList(outReferencedAssets);
     SaveStream(stream, platform);
-    stream.WriteFile(path);
-    LogDebug("Asset saved: %s", mName.c_str());
+    stream.SetWrittenAssetList(nullptr);
+    success = stream.WriteFile(path);
+
+    if (success)
+    {
+        LogDebug("Asset saved: %s", mName.c_str());
+    }
 #endif
+
+    return success;
+}
+
+bool Asset::IsCookThreadSafe() const
+{
+    return true;
 }
 
 void Asset::LoadEmbedded(const EmbeddedFile* embeddedAsset, AsyncLoadRequest* request)
@@ -199,6 +249,32 @@ void Asset::LoadEmbedded(const EmbeddedFile* embeddedAsset, AsyncLoadRequest* re
     LogDebug("Asset loaded: %s", mName.c_str());
 }
 
+bool Asset::LoadPacked(AssetPack* pack, const AssetPackEntry* entry, AsyncLoadRequest* request)
+{
+    if (IsLoaded())
+        return true;
+
+    Stream stream;
+    stream.SetAsyncRequest(request);
+
+    // ReadEntry() logs the reason. Creating GPU resources from an unread stream isn't safe.
+    if (!pack->ReadEntry(*entry, stream))
+    {
+        return false;
+    }
+
+    LoadStream(stream, GetPlatform());
+
+    // Only "finish" the load if not async.
+    if (request == nullptr)
+    {
+        Create();
+    }
+
+    LogDebug("Asset loaded: %s", mName.c_str());
+    return true;
+}
+
 void Asset::LoadStream(Stream& stream, Platform platform)
 {
     AssetHeader header = ReadHeader(stream);
@@ -250,6 +326,76 @@ bool Asset::IsTransient() const
 void Asset::SetTransient(bool transient)
 {
     mTransient = transient;
+
+    if (mResidency.mResident)
+    {
+        UpdateResidency(true);
+    }
+}
+
+uint64_t Asset::GetCpuMemorySize() const
+{
+    return 0;
+}
+
+uint64_t Asset::GetGpuMemorySize() const
+{
+    return 0;
+}
+
+uint32_t Asset::GetLastUseFrame() const
+{
+    return mLastUseFrame;
+}
+
+void Asset::Touch()
+{
+    if (AssetManager::Get() != nullptr)
+    {
+        mLastUseFrame = AssetManager::Get()->GetFrameNumber();
+    }
+}
+
+const AssetResidency& Asset::GetResidency() const
+{
+    return mResidency;
+}
+
+void Asset::UpdateResidency(bool resident)
+{
+    AssetManager* assetManager = AssetManager::Get();
+
+    if (assetManager == nullptr ||
+        (!resident && !mResidency.mResident))
+    {
+        return;
+    }
+
+    AssetResidency residency;
+
+    if (resident)
+    {
+        residency.mCpuBytes = GetCpuMemorySize();
+        residency.mGpuBytes = GetGpuMemorySize();
+        residency.mResident = true;
+        residency.mCached = IsCached();
+    }
+
+    assetManager->UpdateMemoryStats(mType, mResidency, residency);
+    mResidency = residency;
+}
+
+bool Asset::IsCached() const
+{
+    // Loaded but unreferenced, so the AssetManager may evict it. Transient assets are never evicted.
+    bool cached = mLoaded && mEnableRefCount && mRefCount == 0 && !mTransient;
+
+#if EDITOR
+    // Same as RefSweep(), engine assets might not be saved as an OCT file yet.
+    cached = cached && !mEngineAsset;
+#endif
+
+    return cached;
 }
 
 AssetHeader Asset::ReadHeader(Stream& stream)
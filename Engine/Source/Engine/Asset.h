@@ -13,6 +13,8 @@
 class Stream;
 class Property;
 class AssetDir;
+class AssetPack;
+struct AssetPackEntry;
 
 #define ASSET_MAGIC_NUMBER 0x4f435421
 
@@ -21,8 +23,11 @@ class AssetDir;
 // ---------------------------------------------------
 #define ASSET_VERSION_BASE 1
 #define ASSET_VERSION_SCENE_EXTRA_DATA 2
+#define ASSET_VERSION_STATIC_MESH_BVH 3
+#define ASSET_VERSION_SOUND_WAVE_STREAM 4
+#define ASSET_VERSION_STATIC_MESH_LODS 5
 
-#define ASSET_VERSION_CURRENT 2
+#define ASSET_VERSION_CURRENT 5
 // ----------------------------------------------------
 
 #define DECLARE_ASSET(Base, Parent) DECLARE_FACTORY(Base, Asset); DECLARE_RTTI(Base, Parent);
@@ -46,10 +51,20 @@ struct AssetHeader
     uint8_t mEmbedded = false;
 };
 
+// What a loaded asset currently counts toward the AssetManager's memory stats.
+struct AssetResidency
+{
+    uint64_t mCpuBytes = 0;
+    uint64_t mGpuBytes = 0;
+    bool mResident = false;
+    bool mCached = false;
+};
+
 struct AssetStub
 {
     Asset* mAsset = nullptr;
     const EmbeddedFile* mEmbeddedData = nullptr;
+    const AssetPackEntry* mPackEntry = nullptr;
     std::string mPath;
     TypeId mType = INVALID_TYPE_ID;
     bool mEngineAsset = false;
@@ -104,7 +119,13 @@ public:
 
     void LoadFile(const char* path, AsyncLoadRequest* request = nullptr);
     void LoadEmbedded(const EmbeddedFile* embeddedAsset, AsyncLoadRequest* request = nullptr);
-    void SaveFile(const char* path, Platform platform);
+    bool LoadPacked(AssetPack* pack, const AssetPackEntry* entry, AsyncLoadRequest* request = nullptr);
+    // Returns false if the file couldn't be written. outReferencedAssets, if given, receives the
+    // names of the assets referenced by the saved data.
+    bool SaveFile(const char* path, Platform platform, std::vector<std::string>* outReferencedAssets = nullptr);
+
+    // Whether SaveStream() for a platform can run on a cook thread while other assets are cooked.
+    virtual bool IsCookThreadSafe() const;
 
     virtual void LoadStream(Stream& stream, Platform platform);
 	virtual void SaveStream(Stream& stream, Platform platform);
@@ -117,6 +138,15 @@ public:
     bool IsTransient() const;
     void SetTransient(bool transient);
 
+    // Approximate bytes kept resident by this asset. Used for the AssetManager's memory budget.
+    virtual uint64_t GetCpuMemorySize() const;
+    virtual uint64_t GetGpuMemorySize() const;
+
+    // AssetManager frame this asset was last loaded, fetched or released. Used to pick eviction order.
+    uint32_t GetLastUseFrame() const;
+    void Touch();
+    const AssetResidency& GetResidency() const;
+
     static AssetHeader ReadHeader(Stream& stream);
     void WriteHeader(Stream& stream);
 
@@ -128,6 +158,11 @@ public:
 
 protected:
 
+    // Re-measures this asset and updates the AssetManager's memory stats. Called when the asset is created
+    // or destroyed and when it gains or loses its last reference, so the totals never need a full recount.
+    void UpdateResidency(bool resident);
+    bool IsCached() const;
+
     uint32_t mVersion = 0;
     TypeId mType = INVALID_TYPE_ID;
     bool mEmbedded = false;
@@ -138,4 +173,6 @@ protected:
 
     std::string mName = "Asset";
     int32_t mRefCount = 0;
+    uint32_t mLastUseFrame = 0;
+    AssetResidency mResidency;
 };
\ No newline at end of file
@@ -28,12 +28,55 @@
 
 #if EDITOR
 #include "Editor/EditorState.h"
+#include "Editor/AssetDiscoveryCache.h"
 #endif
 
+#include <algorithm>
+
 #define ASYNC_REQUEUE_LIMIT 30
+#define NUM_DISCOVER_THREADS 4
+#define REF_SWEEP_BUDGET_US 2000
 
 AssetManager* AssetManager::sInstance = nullptr;
 
+static bool CanEvictAsset(const AssetStub* stub)
+{
+    Asset* asset = stub->mAsset;
+
+    if (asset == nullptr ||
+        !asset->IsLoaded() ||
+        !asset->IsRefCounted() ||
+        asset->GetRefCount() != 0)
+    {
+        return false;
+    }
+
+#if EDITOR
+    // Same as RefSweep(), engine assets might not be saved as an OCT file yet.
+    if (stub->mEngineAsset)
+        return false;
+#endif
+
+    return true;
+}
+
+static void AddResidency(AssetMemoryStats& stats, const AssetResidency& residency)
+{
+    stats.mCpuBytes += residency.mCpuBytes;
+    stats.mGpuBytes += residency.mGpuBytes;
+    stats.mCachedBytes += residency.mCached ? (residency.mCpuBytes + residency.mGpuBytes) : 0;
+    ++stats.mNumAssets;
+}
+
+static void RemoveResidency(AssetMemoryStats& stats, const AssetResidency& residency)
+{
+    OCT_ASSERT(stats.mNumAssets > 0);
+    stats.mCpuBytes -= residency.mCpuBytes;
+    stats.mGpuBytes -= residency.mGpuBytes;
+    stats.mCachedBytes -= residency.mCached ? (residency.mCpuBytes + residency.mGpuBytes) : 0;
+    --stats.mNumAssets;
+}
+
 Asset* FetchAsset(const std::string& name)
 {
     return AssetManager::Get()->GetAsset(name);
@@ -101,6 +144,18 @@ AssetManager::~AssetManager()
 
     SYS_DestroyMutex(mMutex);
     mMutex = nullptr;
+
+    SYS_DestroyMutex(mSweepMutex);
+    mSweepMutex = nullptr;
+
+    SYS_DestroyMutex(mMemoryStatsMutex);
+    mMemoryStatsMutex = nullptr;
+
+    if (mAssetPack != nullptr)
+    {
+        delete mAssetPack;
+        mAssetPack = nullptr;
+    }
 }
 
 void AssetManager::Initialize()
@@ -108,12 +163,28 @@ void AssetManager::Initialize()
     mRootDirectory = new AssetDir("Root", "", nullptr);
 
     mMutex = SYS_CreateMutex();
+    mSweepMutex = SYS_CreateMutex();
+    mMemoryStatsMutex = SYS_CreateMutex();
     mAsyncLoadThread = SYS_CreateThread(AsyncLoadThreadFunc, this);
 }
 
 void AssetManager::Update(float deltaTime)
 {
     UpdateEndLoadQueue();
+
+    if (mSweeping)
+    {
+        UpdateRefSweep(false);
+    }
+
+    // Only check the budget after assets were loaded or gained/lost their last reference.
+    if (mMemoryBudget > 0 &&
+        mBudgetCheckPending)
+    {
+        EnforceMemoryBudget();
+    }
+
+    ++mFrameNumber;
 }
 
 AssetStub* AssetManager::RegisterAsset(const std::string& filename, TypeId type, AssetDir* directory, EmbeddedFile* embeddedAsset, bool engineAsset)
@@ -258,32 +329,50 @@ bool AssetManager::IsPurging() const
     return mPurging;
 }
 
-void AssetManager::Discover(const char* directoryName, const char* directoryPath)
+ThreadFuncRet AssetManager::DiscoverThreadFunc(void* arg)
 {
-    SCOPED_STAT("DiscoverAssets")
+    DiscoverContext* context = (DiscoverContext*)arg;
 
-    // Make sure directory path ends with 
-    std::string dirPath = directoryPath;
-    if (dirPath.size() > 0 && dirPath[dirPath.size() - 1] != '/')
+    while (true)
     {
-        dirPath += '/';
-    }
+        int32_t dirIndex = -1;
+        std::string dirPath;
+        bool done = false;
 
-    AssetDir* newDir = new AssetDir(directoryName, dirPath, mRootDirectory);
-    bool isEngineDir = (strcmp(directoryName, "Engine") == 0);
-    newDir->mEngineDir = isEngineDir;
+        SYS_LockMutex(context->mMutex);
 
-    // Recursively iterate through Asset directory and find any .oct asset
-    // and register an Asset to the map. At this point, we also want to read the oct 
-    // header and determine the asset type so we can instantiate the correct Asset derived class.
+        if (context->mNextDir < context->mDirs.size())
+        {
+            dirIndex = int32_t(context->mNextDir++);
+            dirPath = context->mDirs[dirIndex].mPath;
+            context->mNumBusy++;
+        }
+        else if (context->mNumBusy == 0)
+        {
+            // No directories left and no other thread can add more.
+            done = true;
+        }
 
-    std::function<void(AssetDir*, bool)> searchDirectory = [&](AssetDir* directory, bool engineDir)
-    {
+        SYS_UnlockMutex(context->mMutex);
+
+        if (done)
+        {
+            break;
+        }
+
+        if (dirIndex == -1)
+        {
+            // Other threads are still listing directories and may add more.
+            SYS_WaitSemaphore(context->mWorkSemaphore);
+            continue;
+        }
 
         std::vector<std::string> subDirectories;
+        std::vector<DiscoveredFile> files;
+        uint32_t numHeadersRead = 0;
         DirEntry dirEntry = { };
 
-        SYS_OpenDirectory(directory->mPath, dirEntry);
+        SYS_OpenDirectory(dirPath, dirEntry);
 
         while (dirEntry.mValid)
         {
@@ -297,18 +386,34 @@ void AssetManager::Discover(const char* directoryName, const char* directoryPath
             }
             else
             {
-                // TODO: Read the asset header to check the asset type.
                 const char* extension = strrchr(dirEntry.mFilename, '.');
 
                 if (extension != nullptr &&
                     strcmp(extension, ".oct") == 0)
                 {
-                    Stream stream;
-                    std::string path = directory->mPath + dirEntry.mFilename;
-                    stream.ReadFile(path.c_str(), true, sizeof(AssetHeader));
+                    DiscoveredFile file;
+                    file.mFilename = dirEntry.mFilename;
+                    file.mDir = uint32_t(dirIndex);
+
+                    std::string path = dirPath + dirEntry.mFilename;
+                    SYS_GetFileInfo(path.c_str(), file.mModTime, file.mSize);
+
+                    bool cached = false;
+#if EDITOR
+                    cached = (context->mCache != nullptr && context->mCache->Find(path, file.mModTime, file.mSize, file.mType));
+#endif
+
+                    if (!cached)
+                    {
+                        Stream stream;
+                        stream.ReadFile(path.c_str(), true, sizeof(AssetHeader));
 
-                    AssetHeader header = Asset::ReadHeader(stream);
-                    RegisterAsset(dirEntry.mFilename, header.mType, directory, nullptr, engineDir);
+                        AssetHeader header = Asset::ReadHeader(stream);
+                        file.mType = header.mType;
+                        ++numHeadersRead;
+                    }
+
+                    files.push_back(file);
                 }
             }
 
@@ -317,16 +422,139 @@ void AssetManager::Discover(const char* directoryName, const char* directoryPath
 
         SYS_CloseDirectory(dirEntry);
 
-        // Discover assets of subdirectories.
-        for (uint32_t i = 0; i < subDirectories.size(); ++i)
         {
-            std::string dirPath = directory->mPath + subDirectories[i] + "/";
-            AssetDir* subDir = new AssetDir(subDirectories[i], dirPath, directory);
-            searchDirectory(subDir, engineDir);
+            SCOPED_LOCK(context->mMutex);
+
+            // Discover assets of subdirectories.
+            for (uint32_t i = 0; i < subDirectories.size(); ++i)
+            {
+                context->mDirs.push_back({ subDirectories[i], dirPath + subDirectories[i] + "/", dirIndex });
+            }
+
+            context->mFiles.insert(context->mFiles.end(), files.begin(), files.end());
+            context->mNumHeadersRead += numHeadersRead;
+            context->mNumBusy--;
+
+            // Wake a waiting thread for each new directory, or all of them once everything is listed.
+            bool finished = (context->mNumBusy == 0 && context->mNextDir == context->mDirs.size());
+            uint32_t numSignals = finished ? NUM_DISCOVER_THREADS : uint32_t(subDirectories.size());
+
+            for (uint32_t i = 0; i < numSignals; ++i)
+            {
+                SYS_SignalSemaphore(context->mWorkSemaphore);
+            }
         }
-    };
+    }
 
-    searchDirectory(newDir, isEngineDir);
+    THREAD_RETURN();
+}
+
+void AssetManager::Discover(const char* directoryName, const char* directoryPath)
+{
+    SCOPED_STAT("DiscoverAssets")
+
+    // Make sure directory path ends with 
+    std::string dirPath = directoryPath;
+    if (dirPath.size() > 0 && dirPath[dirPath.size() - 1] != '/')
+    {
+        dirPath += '/';
+    }
+
+    AssetDir* newDir = new AssetDir(directoryName, dirPath, mRootDirectory);
+    bool isEngineDir = (strcmp(directoryName, "Engine") == 0);
+    newDir->mEngineDir = isEngineDir;
+
+    // Recursively iterate through Asset directory and find any .oct asset
+    // and register an Asset to the map. At this point, we also want to read the oct 
+    // header and determine the asset type so we can instantiate the correct Asset derived class.
+    // Directories are listed and headers are read on worker threads. Registering happens here afterwards.
+
+    DiscoverContext context;
+    context.mMutex = SYS_CreateMutex();
+    context.mWorkSemaphore = SYS_CreateSemaphore(0);
+    context.mDirs.push_back({ directoryName, dirPath, -1 });
+
+#if EDITOR
+    // Headers of files that haven't changed since the last launch don't need to be read again.
+    AssetDiscoveryCache cache;
+    std::string cachePath;
+
+    if (GetEngineState()->mProjectDirectory != "")
+    {
+        std::string intermediateDir = GetEngineState()->mProjectDirectory + "Intermediate";
+        SYS_CreateDirectory(intermediateDir.c_str());
+        cachePath = intermediateDir + "/AssetDiscovery.bin";
+        cache.Load(cachePath);
+        context.mCache = &cache;
+    }
+#endif
+
+    ThreadObject* threads[NUM_DISCOVER_THREADS] = {};
+
+    for (uint32_t i = 0; i < NUM_DISCOVER_THREADS; ++i)
+    {
+        threads[i] = SYS_CreateThread(DiscoverThreadFunc, &context);
+    }
+
+    for (uint32_t i = 0; i < NUM_DISCOVER_THREADS; ++i)
+    {
+        SYS_JoinThread(threads[i]);
+        SYS_DestroyThread(threads[i]);
+    }
+
+    SYS_DestroySemaphore(context.mWorkSemaphore);
+    context.mWorkSemaphore = nullptr;
+    SYS_DestroyMutex(context.mMutex);
+    context.mMutex = nullptr;
+
+    // Parents are always discovered before their children, so they exist by the time a child is created.
+    std::vector<AssetDir*> assetDirs;
+    assetDirs.push_back(newDir);
+
+    for (uint32_t i = 1; i < context.mDirs.size(); ++i)
+    {
+        const DiscoveredDir& dir = context.mDirs[i];
+        assetDirs.push_back(new AssetDir(dir.mName, dir.mPath, assetDirs[dir.mParent]));
+    }
+
+    // Keep the resulting order independent of which thread finished first.
+    for (uint32_t i = 0; i < assetDirs.size(); ++i)
+    {
+        std::sort(assetDirs[i]->mChildDirs.begin(), assetDirs[i]->mChildDirs.end(),
+            [](const AssetDir* l, const AssetDir* r)
+            {
+                return l->mName < r->mName;
+            });
+    }
+
+    std::sort(context.mFiles.begin(), context.mFiles.end(),
+        [](const DiscoveredFile& l, const DiscoveredFile& r)
+        {
+            return (l.mDir != r.mDir) ? (l.mDir < r.mDir) : (l.mFilename < r.mFilename);
+        });
+
+    for (uint32_t i = 0; i < context.mFiles.size(); ++i)
+    {
+        const DiscoveredFile& file = context.mFiles[i];
+        RegisterAsset(file.mFilename, file.mType, assetDirs[file.mDir], nullptr, isEngineDir);
+    }
+
+#if EDITOR
+    if (cachePath != "")
+    {
+        cache.RemoveEntries(dirPath);
+
+        for (uint32_t i = 0; i < context.mFiles.size(); ++i)
+        {
+            const DiscoveredFile& file = context.mFiles[i];
+            cache.Update(assetDirs[file.mDir]->mPath + file.mFilename, file.mModTime, file.mSize, file.mType);
+        }
+
+        cache.Save(cachePath);
+    }
+
+    LogDebug("Discovered %d assets in %s (%d headers read)", int32_t(context.mFiles.size()), dirPath.c_str(), int32_t(context.mNumHeadersRead));
+#endif
 }
 
 void AssetManager::DiscoverAssetRegistry(const char* registryPath)
@@ -375,6 +603,37 @@ void AssetManager::DiscoverAssetRegistry(const char* registryPath)
     }
 }
 
+bool AssetManager::DiscoverAssetPack(const char* packPath)
+{
+    SCOPED_STAT("DiscoverAssetPack");
+
+    OCT_ASSERT(mAssetPack == nullptr);
+    mAssetPack = new AssetPack();
+
+    if (!mAssetPack->Open(packPath))
+    {
+        delete mAssetPack;
+        mAssetPack = nullptr;
+        return false;
+    }
+
+    // Everything needed to register the assets is in the table of contents,
+    // so no asset files are touched until they are loaded.
+    for (uint32_t i = 0; i < mAssetPack->GetNumEntries(); ++i)
+    {
+        const AssetPackEntry& entry = mAssetPack->GetEntry(i);
+        AssetStub* stub = RegisterAsset(mAssetPack->GetEntryPath(entry), entry.mType, mRootDirectory, nullptr, entry.mEngineAsset);
+
+        if (stub != nullptr)
+        {
+            stub->mPackEntry = &entry;
+            stub->mEngineAsset = entry.mEngineAsset;
+        }
+    }
+
+    return true;
+}
+
 void AssetManager::DiscoverEmbeddedAssets(EmbeddedFile* assets, uint32_t numAssets)
 {
     SCOPED_STAT("DiscoverEmbeddedAssets");
@@ -404,6 +663,14 @@ void AssetManager::Purge(bool purgeEngineAssets)
 
     mPurging = true;
 
+    // Everything queued for sweeping is about to be destroyed anyway.
+    {
+        SCOPED_LOCK(mSweepMutex);
+        mSweepQueue.clear();
+        mSweepTransients = false;
+        mSweeping = false;
+    }
+
     if (purgeEngineAssets)
     {
         for (auto it = mAssetMap.begin(); it != mAssetMap.end(); ++it)
@@ -495,53 +762,307 @@ bool AssetManager::PurgeAsset(const char* name)
     return purged;
 }
 
-void AssetManager::RefSweep()
+void AssetManager::RefSweep(bool immediate)
 {
-    // Iterate several times until no assets are unloaded.
-    uint32_t iter = 0;
-    uint32_t numAssetsUnloaded = 0;
-    uint32_t totalAssetsUnloaded = 0;
+    SCOPED_STAT("RefSweep");
 
-    while (iter == 0 || (iter < 10 && numAssetsUnloaded != 0))
     {
-        totalAssetsUnloaded += numAssetsUnloaded;
-        numAssetsUnloaded = 0;
+        SCOPED_LOCK(mSweepMutex);
 
+        // Queue everything that is currently unreferenced. Destroying those assets releases their own
+        // references, and anything that drops to zero as a result is queued by NotifyUnreferenced().
         for (auto it = mAssetMap.begin(); it != mAssetMap.end(); ++it)
         {
-#if EDITOR
-            // Don't ref sweep engine assets. They might not be saved as an OCT file yet.
-            if (it->second->mEngineAsset)
-                continue;
-#endif
-
             if (it->second->mAsset != nullptr &&
                 it->second->mAsset->IsLoaded() &&
                 it->second->mAsset->GetRefCount() == 0)
             {
-                it->second->mAsset->Destroy();
-                delete it->second->mAsset;
-                it->second->mAsset = nullptr;
-                ++numAssetsUnloaded;
+                mSweepQueue.push_back(it->first);
             }
         }
 
-        for (int32_t i = int32_t(mTransientAssets.size()) - 1; i >= 0; --i)
+        mSweepTransients = true;
+
+        if (!mSweeping)
         {
-            if (mTransientAssets[i]->GetRefCount() == 0)
+            mSweeping = true;
+            mNumSwept = 0;
+        }
+    }
+
+    if (immediate)
+    {
+        UpdateRefSweep(true);
+    }
+}
+
+bool AssetManager::IsRefSweeping() const
+{
+    return mSweeping;
+}
+
+void AssetManager::NotifyUnreferenced(Asset* asset)
+{
+    // Can be called from any thread that releases an AssetRef.
+    SCOPED_LOCK(mSweepMutex);
+
+    // Outside of a sweep, unreferenced assets stay loaded until the next RefSweep().
+    if (!mSweeping || mPurging)
+        return;
+
+    if (asset->IsTransient())
+    {
+        mSweepTransients = true;
+    }
+    else
+    {
+        mSweepQueue.push_back(asset->GetName());
+    }
+}
+
+void AssetManager::UpdateRefSweep(bool immediate)
+{
+    SCOPED_FRAME_STAT("RefSweep");
+
+    uint64_t startTime = SYS_GetTimeMicroseconds();
+    uint32_t numProcessed = 0;
+
+    while (true)
+    {
+        // Always make some progress, even if a single asset takes longer than the budget.
+        if (!immediate &&
+            numProcessed > 0 &&
+            SYS_GetTimeMicroseconds() - startTime >= REF_SWEEP_BUDGET_US)
+        {
+            return;
+        }
+
+        std::string assetName;
+        bool sweepTransients = false;
+
+        {
+            SCOPED_LOCK(mSweepMutex);
+
+            if (mSweepTransients)
+            {
+                sweepTransients = true;
+                mSweepTransients = false;
+            }
+            else if (mSweepQueue.size() > 0)
+            {
+                assetName = std::move(mSweepQueue.back());
+                mSweepQueue.pop_back();
+            }
+            else
+            {
+                mSweeping = false;
+                break;
+            }
+        }
+
+        ++numProcessed;
+
+        if (sweepTransients)
+        {
+            // Rescan instead of queueing pointers, which could be freed and reused before the sweep.
+            // Destroying a transient can release others, which flags another rescan.
+            for (int32_t i = int32_t(mTransientAssets.size()) - 1; i >= 0; --i)
             {
-                mTransientAssets[i]->Destroy();
-                delete mTransientAssets[i];
+                Asset* asset = mTransientAssets[i];
+
+                if (asset->GetRefCount() == 0)
+                {
+                    mTransientAssets[i] = mTransientAssets.back();
+                    mTransientAssets.pop_back();
+
+                    asset->Destroy();
+                    delete asset;
+                    ++mNumSwept;
+                }
+            }
+        }
+        else
+        {
+            // Assets are looked up by name since stubs can be unregistered while queued.
+            AssetStub* stub = GetAssetStub(assetName);
+
+            if (stub == nullptr ||
+                stub->mAsset == nullptr ||
+                !stub->mAsset->IsLoaded() ||
+                stub->mAsset->GetRefCount() != 0)
+            {
+                continue;
+            }
+
+#if EDITOR
+            // Don't ref sweep engine assets. They might not be saved as an OCT file yet.
+            if (stub->mEngineAsset)
+                continue;
+#endif
+
+            // GPU resources are released through the renderer's destroy queue once no frame in flight uses them.
+            stub->mAsset->Destroy();
+            delete stub->mAsset;
+            stub->mAsset = nullptr;
+            ++mNumSwept;
+        }
+    }
+
+    LogDebug("%d assets swept", mNumSwept);
+}
+
+void AssetManager::SetMemoryBudget(uint64_t budget)
+{
+    mMemoryBudget = budget;
+    mOverBudgetWarned = false;
+    mBudgetCheckPending = true;
+}
+
+uint64_t AssetManager::GetMemoryBudget() const
+{
+    return mMemoryBudget;
+}
+
+AssetMemoryStats AssetManager::GetMemoryStats()
+{
+    SCOPED_LOCK(mMemoryStatsMutex);
+    return mMemoryStats;
+}
+
+std::unordered_map<TypeId, AssetMemoryStats> AssetManager::GetTypeMemoryStats()
+{
+    SCOPED_LOCK(mMemoryStatsMutex);
+    return mTypeMemoryStats;
+}
+
+void AssetManager::UpdateMemoryStats(TypeId type, const AssetResidency& prev, const AssetResidency& next)
+{
+    SCOPED_LOCK(mMemoryStatsMutex);
+
+    AssetMemoryStats& typeStats = mTypeMemoryStats[type];
+
+    if (prev.mResident)
+    {
+        RemoveResidency(mMemoryStats, prev);
+        RemoveResidency(typeStats, prev);
+    }
 
-                mTransientAssets.erase(mTransientAssets.begin() + i);
+    if (next.mResident)
+    {
+        AddResidency(mMemoryStats, next);
+        AddResidency(typeStats, next);
+
+        // Either more memory is in use or more of it can be evicted.
+        mBudgetCheckPending = true;
+    }
+}
+
+uint32_t AssetManager::GetFrameNumber() const
+{
+    return mFrameNumber;
+}
+
+void AssetManager::EnforceMemoryBudget()
+{
+    AssetMemoryStats stats;
+
+    {
+        SCOPED_LOCK(mMemoryStatsMutex);
+        stats = mMemoryStats;
+        mBudgetCheckPending = false;
+    }
+
+    uint64_t usedBytes = stats.mCpuBytes + stats.mGpuBytes;
+
+    if (mMemoryBudget == 0 ||
+        mPurging ||
+        usedBytes <= mMemoryBudget)
+    {
+        mOverBudgetWarned = false;
+        return;
+    }
+
+    // Only scan for candidates when something can actually be evicted.
+    if (stats.mCachedBytes > 0)
+    {
+        {
+            SCOPED_LOCK(mMutex);
+
+            // Async loads can be waiting on unreferenced dependencies, so hold off until the queues drain.
+            if (mBeginLoadQueue.size() > 0 ||
+                mEndLoadQueue.size() > 0)
+            {
+                mBudgetCheckPending = true;
+                return;
             }
         }
 
-        iter++;
+        usedBytes = EvictUnreferencedAssets(usedBytes);
     }
 
-    totalAssetsUnloaded += numAssetsUnloaded;
-    LogDebug("%d assets swept", totalAssetsUnloaded);
+    // Evicted assets may have released the last reference to their dependencies, which queues another
+    // check. Only warn once nothing more can be evicted.
+    if (usedBytes > mMemoryBudget &&
+        !mBudgetCheckPending &&
+        !mOverBudgetWarned)
+    {
+        LogWarning("Referenced assets use %.2f MB, over the %.2f MB asset memory budget",
+            usedBytes / float(1024 * 1024),
+            mMemoryBudget / float(1024 * 1024));
+        mOverBudgetWarned = true;
+    }
+}
+
+uint64_t AssetManager::EvictUnreferencedAssets(uint64_t usedBytes)
+{
+    SCOPED_FRAME_STAT("AssetEvict");
+
+    std::vector<std::pair<uint32_t, AssetStub*>> candidates;
+
+    for (auto it = mAssetMap.begin(); it != mAssetMap.end(); ++it)
+    {
+        if (CanEvictAsset(it->second))
+        {
+            candidates.push_back({ it->second->mAsset->GetLastUseFrame(), it->second });
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const std::pair<uint32_t, AssetStub*>& l, const std::pair<uint32_t, AssetStub*>& r)
+        {
+            return l.first < r.first;
+        });
+
+    uint32_t numEvicted = 0;
+
+    for (uint32_t i = 0; i < candidates.size() && usedBytes > mMemoryBudget; ++i)
+    {
+        Asset* asset = candidates[i].second->mAsset;
+
+        // Re-check in case destroying an earlier candidate touched this one.
+        if (asset == nullptr ||
+            asset->GetRefCount() != 0)
+        {
+            continue;
+        }
+
+        const AssetResidency& residency = asset->GetResidency();
+        uint64_t assetBytes = residency.mCpuBytes + residency.mGpuBytes;
+        usedBytes -= glm::min(assetBytes, usedBytes);
+
+        // GPU resources are released through the renderer's destroy queue once no frame in flight uses them.
+        asset->Destroy();
+        delete asset;
+        candidates[i].second->mAsset = nullptr;
+        ++numEvicted;
+    }
+
+    if (numEvicted > 0)
+    {
+        LogDebug("%d assets evicted to stay under the asset memory budget", numEvicted);
+    }
+
+    return usedBytes;
 }
 
 void AssetManager::LoadAll()
@@ -552,6 +1073,7 @@ void AssetManager::LoadAll()
         if (stub->mAsset == nullptr)
         {
             stub->mAsset = Asset::CreateInstance(stub->mType);
+            stub->mAsset->SetEngineAsset(stub->mEngineAsset);
             stub->mAsset->LoadFile(stub->mPath.c_str());
         }
     }
@@ -721,6 +1243,12 @@ Asset* AssetManager::GetAsset(const std::string& name)
     Asset* asset = nullptr;
     auto itr = mAssetMap.find(name);
     asset = (itr != mAssetMap.end()) ? itr->second->mAsset : nullptr;
+
+    if (asset != nullptr)
+    {
+        asset->Touch();
+    }
+
     return asset;
 }
 
@@ -739,14 +1267,27 @@ Asset* AssetManager::LoadAsset(const std::string& name)
 
 Asset* AssetManager::LoadAsset(AssetStub& stub)
 {
-    if (stub.mAsset == nullptr)
+    if (stub.mAsset != nullptr)
+    {
+        stub.mAsset->Touch();
+    }
+    else
     {
         stub.mAsset = Asset::CreateInstance(stub.mType);
+        stub.mAsset->SetEngineAsset(stub.mEngineAsset);
 
         if (stub.mEmbeddedData != nullptr)
         {
             stub.mAsset->LoadEmbedded(stub.mEmbeddedData);
         }
+        else if (stub.mPackEntry != nullptr)
+        {
+            if (!stub.mAsset->LoadPacked(mAssetPack, stub.mPackEntry))
+            {
+                delete stub.mAsset;
+                stub.mAsset = nullptr;
+            }
+        }
         else
         {
             stub.mAsset->LoadFile(stub.mPath.c_str());
@@ -813,6 +1354,7 @@ void AssetManager::AsyncLoadAsset(const std::string& name, AssetRef* targetRef)
     newRequest->mPath = stub->mPath;
     newRequest->mType = stub->mType;
     newRequest->mEmbeddedData = stub->mEmbeddedData;
+    newRequest->mPackEntry = stub->mPackEntry;
 
     if (targetRef != nullptr)
     {
@@ -1080,6 +1622,11 @@ std::unordered_map<std::string, AssetStub*>& AssetManager::GetAssetMap()
     return mAssetMap;
 }
 
+AssetPack* AssetManager::GetAssetPack()
+{
+    return mAssetPack;
+}
+
 ThreadFuncRet AssetManager::AsyncLoadThreadFunc(void* in)
 {
     AssetManager& am = *((AssetManager*)in);
@@ -1118,6 +1665,15 @@ ThreadFuncRet AssetManager::AsyncLoadThreadFunc(void* in)
             {
                 newAsset->LoadEmbedded(request->mEmbeddedData, request);
             }
+            else if (request->mPackEntry != nullptr)
+            {
+                if (!newAsset->LoadPacked(am.mAssetPack, request->mPackEntry, request))
+                {
+                    // The main thread fails the request when it sees a null asset.
+                    delete newAsset;
+                    newAsset = nullptr;
+                }
+            }
             else
             {
                 newAsset->LoadFile(request->mPath.c_str(), request);
@@ -1190,12 +1746,26 @@ void AssetManager::UpdateEndLoadQueue()
                 {
                     LogWarning("AsyncLoadRequest not finished because the asset has already been loaded");
                 }
+                else if (loadRequest->mAsset == nullptr)
+                {
+                    LogError("Async load failed: %s", loadRequest->mName.c_str());
+
+                    // Leave the refs empty, but don't leave them pointing at the deleted request.
+                    for (uint32_t i = 0; i < loadRequest->mTargetRefs.size(); ++i)
+                    {
+                        if (loadRequest->mTargetRefs[i] != nullptr)
+                        {
+                            loadRequest->mTargetRefs[i]->mLoadRequest = nullptr;
+                        }
+                    }
+                }
                 else
                 {
                     LogDebug("Finished Async Loading: %s", loadRequest->mName.c_str());
 
                     // Finish the load on the main thread and assign the stub's mAsset so that it is officially "Loaded"
                     OCT_ASSERT(loadRequest->mAsset != nullptr);
+                    loadRequest->mAsset->SetEngineAsset(stub->mEngineAsset);
                     loadRequest->mAsset->Create();
                     stub->mAsset = loadRequest->mAsset;
 
@@ -2,6 +2,7 @@
 
 #include "Asset.h"
 #include "AssetRef.h"
+#include "AssetPack.h"
 #include "Log.h"
 
 #include "System/System.h"
@@ -14,6 +15,7 @@ class Asset;
 class AssetDir;
 class Material;
 class ParticleSystem;
+class AssetDiscoveryCache;
 
 struct AsyncLoadRequest
 {
@@ -22,11 +24,51 @@ struct AsyncLoadRequest
     std::vector<AssetRef*> mTargetRefs;
     std::vector<AssetStub*> mDependentAssets;
     const EmbeddedFile* mEmbeddedData = nullptr;
+    const AssetPackEntry* mPackEntry = nullptr;
     TypeId mType = INVALID_TYPE_ID;
     Asset* mAsset = nullptr;
     int32_t mRequeueCount = 0;
 };
 
+struct DiscoveredDir
+{
+    std::string mName;
+    std::string mPath;
+    int32_t mParent = -1;
+};
+
+struct DiscoveredFile
+{
+    std::string mFilename;
+    uint32_t mDir = 0;
+    uint64_t mModTime = 0;
+    uint64_t mSize = 0;
+    TypeId mType = INVALID_TYPE_ID;
+};
+
+// Shared state of the Discover() worker threads. Everything is guarded by mMutex except mCache, which is read-only.
+struct DiscoverContext
+{
+    MutexObject* mMutex = nullptr;
+    SemaphoreObject* mWorkSemaphore = nullptr;
+    std::vector<DiscoveredDir> mDirs;
+    std::vector<DiscoveredFile> mFiles;
+    uint32_t mNextDir = 0;
+    uint32_t mNumBusy = 0;
+    uint32_t mNumHeadersRead = 0;
+    const AssetDiscoveryCache* mCache = nullptr;
+};
+
+struct AssetMemoryStats
+{
+    uint64_t mCpuBytes = 0;
+    uint64_t mGpuBytes = 0;
+
+    // Bytes held by loaded assets that nothing references. These can be evicted to stay under budget.
+    uint64_t mCachedBytes = 0;
+    uint32_t mNumAssets = 0;
+};
+
 Asset* FetchAsset(const std::string& name);
 Asset* LoadAsset(const std::string& name);
 void UnloadAsset(const std::string& name);
@@ -77,10 +119,31 @@ public:
     void Update(float deltaTime);
     void Discover(const char* directoryName, const char* directoryPath);
     void DiscoverAssetRegistry(const char* registryPath);
+    bool DiscoverAssetPack(const char* packPath);
     void DiscoverEmbeddedAssets(struct EmbeddedFile* assets, uint32_t numAssets);
     void Purge(bool purgeEngineAssets);
     bool PurgeAsset(const char* name);
-    void RefSweep();
+
+    // Unloads every asset that isn't referenced anymore. By default the assets are destroyed a few at a time
+    // over the next frames (see Update()). Assets that drop to zero references while sweeping are swept too.
+    void RefSweep(bool immediate = false);
+    bool IsRefSweeping() const;
+    void NotifyUnreferenced(Asset* asset);
+
+    // Hard cap in bytes (CPU + GPU) on resident assets, 0 means unlimited. When exceeded, unreferenced assets
+    // are evicted least recently used first. Referenced assets are never evicted, so the cap can only be
+    // honored if the referenced set fits.
+    void SetMemoryBudget(uint64_t budget);
+    uint64_t GetMemoryBudget() const;
+    AssetMemoryStats GetMemoryStats();
+    std::unordered_map<TypeId, AssetMemoryStats> GetTypeMemoryStats();
+
+    // Moves an asset's contribution to the memory stats from prev to next. See Asset::UpdateResidency().
+    void UpdateMemoryStats(TypeId type, const AssetResidency& prev, const AssetResidency& next);
+
+    // Incremented once per Update(). Assets record it when used to order evictions.
+    uint32_t GetFrameNumber() const;
+
     void LoadAll();
 
     void RegisterTransientAsset(Asset* asset);
@@ -107,6 +170,7 @@ public:
     AssetDir* GetRootDirectory();
     void UnloadProjectDirectory();
     std::unordered_map<std::string, AssetStub*>& GetAssetMap();
+    AssetPack* GetAssetPack();
 
     AssetStub* RegisterAsset(const std::string& filename, TypeId type, AssetDir* directory, EmbeddedFile* embeddedAsset, bool engineAsset);
     AssetStub* CreateAndRegisterAsset(TypeId assetType, AssetDir* directory, const std::string& filename, bool engineAsset);
@@ -117,15 +181,35 @@ public:
 protected:
 
     static ThreadFuncRet AsyncLoadThreadFunc(void* in);
+    static ThreadFuncRet DiscoverThreadFunc(void* arg);
 
     static AssetManager* sInstance;
     AssetManager();
 
     void UpdateEndLoadQueue();
+    void UpdateRefSweep(bool immediate);
+    void EnforceMemoryBudget();
+    uint64_t EvictUnreferencedAssets(uint64_t usedBytes);
 
     std::unordered_map<std::string, AssetStub*> mAssetMap;
     std::vector<Asset*> mTransientAssets;
+    // The sweep state is guarded by mSweepMutex since refs can be released on the async load and cook threads.
+    // Assets are queued by name (transients by a rescan flag) so nothing freed while queued is touched.
+    std::vector<std::string> mSweepQueue;
+    bool mSweepTransients = false;
+    uint32_t mNumSwept = 0;
+    bool mSweeping = false;
+    MutexObject* mSweepMutex = nullptr;
+    // Memory stats are kept up to date by the assets themselves, possibly from other threads.
+    AssetMemoryStats mMemoryStats;
+    std::unordered_map<TypeId, AssetMemoryStats> mTypeMemoryStats;
+    MutexObject* mMemoryStatsMutex = nullptr;
+    uint64_t mMemoryBudget = 0;
+    bool mBudgetCheckPending = false;
+    bool mOverBudgetWarned = false;
+    uint32_t mFrameNumber = 1;
     AssetDir* mRootDirectory = nullptr;
+    AssetPack* mAssetPack = nullptr;
     bool mPurging = false;
     bool mDestructing = false;
     std::deque<AsyncLoadRequest*> mBeginLoadQueue;
@@ -0,0 +1,328 @@
+#include "AssetPack.h"
+#include "Asset.h"
+#include "Stream.h"
+#include "Utilities.h"
+#include "Log.h"
+
+#include "System/System.h"
+
+#include <algorithm>
+
+// Header (5 x uint32): magic, version, num entries, toc offset, toc size.
+static const uint32_t kPackHeaderSize = 20;
+
+// Toc entry: name hash, name offset, offset, size, uncompressed size, type (uint32), compression (uint8), engine asset (bool).
+static const uint32_t kPackTocEntrySize = 26;
+
+// Upper bound on the table of contents so a corrupt header can't trigger a huge allocation.
+static const uint32_t kPackMaxTocSize = 256 * 1024 * 1024;
+
+static bool CompareEntries(const AssetPackEntry& l, const AssetPackEntry& r)
+{
+    return l.mNameHash < r.mNameHash;
+}
+
+AssetPack::~AssetPack()
+{
+    Close();
+}
+
+bool AssetPack::Open(const char* path)
+{
+    Close();
+
+    mFile = SYS_OpenFile(path, true);
+
+    if (mFile == nullptr)
+    {
+        return false;
+    }
+
+    char headerData[kPackHeaderSize] = {};
+    bool success = SYS_ReadFileRange(mFile, 0, kPackHeaderSize, headerData);
+
+    Stream headerStream(headerData, kPackHeaderSize);
+    uint32_t magic = success ? headerStream.ReadUint32() : 0;
+    uint32_t version = success ? headerStream.ReadUint32() : 0;
+    uint32_t numEntries = success ? headerStream.ReadUint32() : 0;
+    uint32_t tocOffset = success ? headerStream.ReadUint32() : 0;
+    uint32_t tocSize = success ? headerStream.ReadUint32() : 0;
+
+    if (magic != ASSET_PACK_MAGIC_NUMBER ||
+        version != ASSET_PACK_VERSION)
+    {
+        LogError("Invalid asset pack: %s", path);
+        Close();
+        return false;
+    }
+
+    // The toc holds the entries followed by the string table size and the string table itself.
+    if (tocOffset < kPackHeaderSize ||
+        tocSize < sizeof(uint32_t) ||
+        tocSize > kPackMaxTocSize ||
+        numEntries > (tocSize - sizeof(uint32_t)) / kPackTocEntrySize)
+    {
+        LogError("Invalid asset pack table of contents: %s", path);
+        Close();
+        return false;
+    }
+
+    // Read the whole table of contents with a single read.
+    std::vector<char> tocData(tocSize);
+
+    if (!SYS_ReadFileRange(mFile, tocOffset, tocSize, tocData.data()))
+    {
+        LogError("Failed to read asset pack table of contents: %s", path);
+        Close();
+        return false;
+    }
+
+    Stream tocStream(tocData.data(), tocSize);
+    mEntries.resize(numEntries);
+
+    for (uint32_t i = 0; i < numEntries; ++i)
+    {
+        AssetPackEntry& entry = mEntries[i];
+        entry.mNameHash = tocStream.ReadUint32();
+        entry.mNameOffset = tocStream.ReadUint32();
+        entry.mOffset = tocStream.ReadUint32();
+        entry.mSize = tocStream.ReadUint32();
+        entry.mUncompressedSize = tocStream.ReadUint32();
+        entry.mType = (TypeId)tocStream.ReadUint32();
+        entry.mCompression = (AssetPackCompression)tocStream.ReadUint8();
+        entry.mEngineAsset = tocStream.ReadBool();
+
+        // Asset data sits between the header and the toc.
+        if (entry.mOffset < kPackHeaderSize ||
+            uint64_t(entry.mOffset) + entry.mSize > tocOffset)
+        {
+            LogError("Invalid asset pack entry %d: %s", int32_t(i), path);
+            Close();
+            return false;
+        }
+    }
+
+    uint32_t stringTableSize = tocStream.ReadUint32();
+
+    if (stringTableSize != tocSize - tocStream.GetPos())
+    {
+        LogError("Invalid asset pack string table: %s", path);
+        Close();
+        return false;
+    }
+
+    mStringTable.resize(stringTableSize);
+    tocStream.ReadBytes((uint8_t*)mStringTable.data(), stringTableSize);
+
+    // Every name must start inside the string table, and the table must end with a terminator
+    // so that GetEntryPath() never runs off the end.
+    bool validNames = (stringTableSize == 0) ? (numEntries == 0) : (mStringTable.back() == '\0');
+
+    for (uint32_t i = 0; validNames && i < numEntries; ++i)
+    {
+        validNames = (mEntries[i].mNameOffset < stringTableSize);
+    }
+
+    if (!validNames)
+    {
+        LogError("Invalid asset pack entry names: %s", path);
+        Close();
+        return false;
+    }
+
+    mMutex = SYS_CreateMutex();
+
+    LogDebug("Opened asset pack %s (%d assets)", path, numEntries);
+
+    return true;
+}
+
+void AssetPack::Close()
+{
+    if (mFile != nullptr)
+    {
+        SYS_CloseFile(mFile);
+        mFile = nullptr;
+    }
+
+    if (mMutex != nullptr)
+    {
+        SYS_DestroyMutex(mMutex);
+        mMutex = nullptr;
+    }
+
+    mEntries.clear();
+    mStringTable.clear();
+}
+
+bool AssetPack::IsOpen() const
+{
+    return (mFile != nullptr);
+}
+
+uint32_t AssetPack::GetNumEntries() const
+{
+    return uint32_t(mEntries.size());
+}
+
+const AssetPackEntry& AssetPack::GetEntry(uint32_t index) const
+{
+    OCT_ASSERT(index < mEntries.size());
+    return mEntries[index];
+}
+
+const AssetPackEntry* AssetPack::FindEntry(const std::string& name) const
+{
+    AssetPackEntry key;
+    key.mNameHash = OctHashString(name.c_str());
+
+    auto it = std::lower_bound(mEntries.begin(), mEntries.end(), key, CompareEntries);
+
+    for (; it != mEntries.end() && it->mNameHash == key.mNameHash; ++it)
+    {
+        if (Asset::GetNameFromPath(GetEntryPath(*it)) == name)
+        {
+            return &(*it);
+        }
+    }
+
+    return nullptr;
+}
+
+const char* AssetPack::GetEntryPath(const AssetPackEntry& entry) const
+{
+    OCT_ASSERT(entry.mNameOffset < mStringTable.size());
+    return &mStringTable[entry.mNameOffset];
+}
+
+bool AssetPack::ReadEntry(const AssetPackEntry& entry, Stream& outStream)
+{
+    if (entry.mCompression != AssetPackCompression::None)
+    {
+        LogError("Unsupported asset pack compression: %d", int32_t(entry.mCompression));
+        return false;
+    }
+
+    outStream.Resize(entry.mSize);
+    outStream.SetPos(0);
+
+    bool success = false;
+
+    {
+        SCOPED_LOCK(mMutex);
+        success = SYS_ReadFileRange(mFile, entry.mOffset, entry.mSize, outStream.GetData());
+    }
+
+    if (!success)
+    {
+        LogError("Failed to read %s from asset pack", GetEntryPath(entry));
+    }
+
+    return success;
+}
+
+#if EDITOR
+bool AssetPack::Write(const char* path, const std::vector<AssetPackSource>& sources)
+{
+    FILE* file = fopen(path, "wb");
+
+    if (file == nullptr)
+    {
+        LogError("Failed to create asset pack: %s", path);
+        return false;
+    }
+
+    // Reserve space for the header. It's written last once the toc location is known.
+    char emptyHeader[kPackHeaderSize] = {};
+    bool success = (fwrite(emptyHeader, kPackHeaderSize, 1, file) == 1);
+
+    std::vector<AssetPackEntry> entries;
+    std::vector<char> stringTable;
+    uint64_t offset = kPackHeaderSize;
+    entries.reserve(sources.size());
+
+    for (uint32_t i = 0; success && i < sources.size(); ++i)
+    {
+        const AssetPackSource& source = sources[i];
+
+        Stream assetStream;
+        assetStream.ReadFile(source.mFilePath.c_str(), false);
+
+        if (assetStream.GetData() == nullptr)
+        {
+            continue;
+        }
+
+        if (offset + assetStream.GetSize() > UINT32_MAX)
+        {
+            LogError("Asset pack exceeds 4 GB, %s was not added", source.mPath.c_str());
+            continue;
+        }
+
+        AssetPackEntry entry;
+        entry.mNameHash = OctHashString(Asset::GetNameFromPath(source.mPath).c_str());
+        entry.mNameOffset = uint32_t(stringTable.size());
+        entry.mOffset = uint32_t(offset);
+        entry.mSize = assetStream.GetSize();
+        entry.mUncompressedSize = assetStream.GetSize();
+        entry.mType = source.mType;
+        entry.mCompression = AssetPackCompression::None;
+        entry.mEngineAsset = source.mEngineAsset;
+        entries.push_back(entry);
+
+        stringTable.insert(stringTable.end(), source.mPath.begin(), source.mPath.end());
+        stringTable.push_back('\0');
+
+        success = (assetStream.GetSize() == 0 || fwrite(assetStream.GetData(), assetStream.GetSize(), 1, file) == 1);
+        offset += assetStream.GetSize();
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), CompareEntries);
+
+    Stream tocStream;
+
+    for (uint32_t i = 0; i < entries.size(); ++i)
+    {
+        const AssetPackEntry& entry = entries[i];
+        tocStream.WriteUint32(entry.mNameHash);
+        tocStream.WriteUint32(entry.mNameOffset);
+        tocStream.WriteUint32(entry.mOffset);
+        tocStream.WriteUint32(entry.mSize);
+        tocStream.WriteUint32(entry.mUncompressedSize);
+        tocStream.WriteUint32(uint32_t(entry.mType));
+        tocStream.WriteUint8(uint8_t(entry.mCompression));
+        tocStream.WriteBool(entry.mEngineAsset);
+    }
+
+    tocStream.WriteUint32(uint32_t(stringTable.size()));
+    tocStream.WriteBytes((const uint8_t*)stringTable.data(), uint32_t(stringTable.size()));
+
+    success = success && (fwrite(tocStream.GetData(), tocStream.GetSize(), 1, file) == 1);
+
+    Stream headerStream;
+    headerStream.WriteUint32(ASSET_PACK_MAGIC_NUMBER);
+    headerStream.WriteUint32(ASSET_PACK_VERSION);
+    headerStream.WriteUint32(uint32_t(entries.size()));
+    headerStream.WriteUint32(uint32_t(offset));
+    headerStream.WriteUint32(tocStream.GetSize());
+
+    success = success &&
+        fseek(file, 0, SEEK_SET) == 0 &&
+        fwrite(headerStream.GetData(), headerStream.GetSize(), 1, file) == 1;
+
+    success = (fclose(file) == 0) && success;
+    file = nullptr;
+
+    if (!success)
+    {
+        // Don't leave a truncated pack behind for the packaged build to pick up.
+        LogError("Failed to write asset pack: %s", path);
+        SYS_RemoveFile(path);
+        return false;
+    }
+
+    LogDebug("Asset pack written: %s (%d assets)", path, int32_t(entries.size()));
+
+    return true;
+}
+#endif
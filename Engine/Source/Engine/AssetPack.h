@@ -0,0 +1,76 @@
+#pragma once
+
+#include "EngineTypes.h"
+#include "System/SystemTypes.h"
+
+#include <string>
+#include <vector>
+
+class Stream;
+
+#define ASSET_PACK_MAGIC_NUMBER 0x4f50414b
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_FILENAME "AssetPack.opk"
+
+enum class AssetPackCompression : uint8_t
+{
+    None,
+
+    Count
+};
+
+// One entry in the pack's table of contents. Entries are sorted by name hash.
+struct AssetPackEntry
+{
+    uint32_t mNameHash = 0;
+    uint32_t mNameOffset = 0;
+    uint32_t mOffset = 0;
+    uint32_t mSize = 0;
+    uint32_t mUncompressedSize = 0;
+    TypeId mType = INVALID_TYPE_ID;
+    AssetPackCompression mCompression = AssetPackCompression::None;
+    bool mEngineAsset = false;
+};
+
+#if EDITOR
+struct AssetPackSource
+{
+    std::string mPath;
+    std::string mFilePath;
+    TypeId mType = INVALID_TYPE_ID;
+    bool mEngineAsset = false;
+};
+#endif
+
+// Single archive holding every cooked asset of a packaged build.
+// The table of contents is read once when the pack is opened, and assets
+// are then read straight from their offsets in the archive.
+class AssetPack
+{
+public:
+
+    ~AssetPack();
+
+    bool Open(const char* path);
+    void Close();
+    bool IsOpen() const;
+
+    uint32_t GetNumEntries() const;
+    const AssetPackEntry& GetEntry(uint32_t index) const;
+    const AssetPackEntry* FindEntry(const std::string& name) const;
+    const char* GetEntryPath(const AssetPackEntry& entry) const;
+
+    // Thread safe. Called from both the main thread and the async load thread.
+    bool ReadEntry(const AssetPackEntry& entry, Stream& outStream);
+
+#if EDITOR
+    static bool Write(const char* path, const std::vector<AssetPackSource>& sources);
+#endif
+
+protected:
+
+    FileObject* mFile = nullptr;
+    MutexObject* mMutex = nullptr;
+    std::vector<AssetPackEntry> mEntries;
+    std::vector<char> mStringTable;
+};
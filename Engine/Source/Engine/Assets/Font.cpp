@@ -179,6 +179,7 @@ void Font::Create()
 void Font::Destroy()
 {
     Asset::Destroy();
+    Text::ClearGlyphRunCache(this);
 }
 
 void Font::Import(const std::string& path, ImportOptions* options)
@@ -390,6 +391,8 @@ void Font::RebuildFont()
             tempBitmap = nullptr;
 
             // Dirty all text widgets 
+            Text::ClearGlyphRunCache(this);
+
             for (uint32_t i = 0; i < GetEditorState()->mEditScenes.size(); ++i)
             {
                 if (GetEditorState()->GetEditScene(i)->mRootNode != nullptr)
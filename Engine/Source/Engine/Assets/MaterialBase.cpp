@@ -185,14 +185,20 @@ void MaterialBase::Create()
         Compile();
     }
 
-    GFX_CreateMaterialResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateMaterialResource(this);
+    }
 }
 
 void MaterialBase::Destroy()
 {
     Material::Destroy();
 
-    GFX_DestroyMaterialResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyMaterialResource(this);
+    }
 }
 
 void MaterialBase::Import(const std::string& path, ImportOptions* options)
@@ -220,14 +220,20 @@ void MaterialLite::Create()
         }
     }
 
-    GFX_CreateMaterialResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateMaterialResource(this);
+    }
 }
 
 void MaterialLite::Destroy()
 {
     Material::Destroy();
 
-    GFX_DestroyMaterialResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyMaterialResource(this);
+    }
 
     for (uint32_t i = 0; i < MATERIAL_LITE_MAX_TEXTURES; ++i)
     {
@@ -101,6 +101,12 @@ void Scene::LoadStream(Stream& stream, Platform platform)
     mFogFar = stream.ReadFloat();
 }
 
+bool Scene::IsCookThreadSafe() const
+{
+    // Cooking a scene instantiates its nodes, which must happen on the main thread.
+    return false;
+}
+
 void Scene::SaveStream(Stream& stream, Platform platform)
 {
     Asset::SaveStream(stream, platform);
@@ -31,6 +31,7 @@ public:
 
     virtual void LoadStream(Stream& stream, Platform platform) override;
     virtual void SaveStream(Stream& stream, Platform platform) override;
+    virtual bool IsCookThreadSafe() const override;
     virtual void Create() override;
     virtual void Destroy() override;
 
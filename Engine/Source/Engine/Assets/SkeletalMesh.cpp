@@ -8,6 +8,7 @@
 #include "Graphics/Graphics.h"
 
 #if EDITOR
+#include "MeshOptimizer.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -94,29 +95,20 @@ void SkeletalMesh::LoadStream(Stream& stream, Platform platform)
             Channel& channel = animation.mChannels[chanIndex];
             channel.mBoneIndex = stream.ReadInt32();
 
+            // Keys are stored as tightly packed floats in member order, so each track is one bulk copy.
+            static_assert(sizeof(PositionKey) == 16 && sizeof(ScaleKey) == 16 && sizeof(AnimEventKey) == 16, "Key layout no longer matches serialized layout");
+            static_assert(sizeof(RotationKey) == 20, "Key layout no longer matches serialized layout");
             uint32_t numPositionKeys = stream.ReadUint32();
             channel.mPositionKeys.resize(numPositionKeys);
-            for (uint32_t i = 0; i < numPositionKeys; ++i)
-            {
-                channel.mPositionKeys[i].mTime = stream.ReadFloat();
-                channel.mPositionKeys[i].mValue = stream.ReadVec3();
-            }
+            stream.ReadArray32(channel.mPositionKeys.data(), numPositionKeys * sizeof(PositionKey) / sizeof(float));
 
             uint32_t numRotationKeys = stream.ReadUint32();
             channel.mRotationKeys.resize(numRotationKeys);
-            for (uint32_t i = 0; i < numRotationKeys; ++i)
-            {
-                channel.mRotationKeys[i].mTime = stream.ReadFloat();
-                channel.mRotationKeys[i].mValue = stream.ReadQuat();
-            }
+            stream.ReadArray32(channel.mRotationKeys.data(), numRotationKeys * sizeof(RotationKey) / sizeof(float));
 
             uint32_t numScaleKeys = stream.ReadUint32();
             channel.mScaleKeys.resize(numScaleKeys);
-            for (uint32_t i = 0; i < numScaleKeys; ++i)
-            {
-                channel.mScaleKeys[i].mTime = stream.ReadFloat();
-                channel.mScaleKeys[i].mValue = stream.ReadVec3();
-            }
+            stream.ReadArray32(channel.mScaleKeys.data(), numScaleKeys * sizeof(ScaleKey) / sizeof(float));
         }
 
         uint32_t numEventTracks = stream.ReadUint32();
@@ -130,37 +122,24 @@ void SkeletalMesh::LoadStream(Stream& stream, Platform platform)
             uint32_t numEventKeys = stream.ReadUint32();
             track.mEventKeys.resize(numEventKeys);
 
-            for (uint32_t k = 0; k < numEventKeys; ++k)
-            {
-                AnimEventKey& key = track.mEventKeys[k];
-                key.mTime = stream.ReadFloat();
-                key.mValue = stream.ReadVec3();
-            }
+            stream.ReadArray32(track.mEventKeys.data(), numEventKeys * sizeof(AnimEventKey) / sizeof(float));
         }
     }
 
+    // Skinned vertices are serialized without mTexcoord1, so copy the contiguous runs of each vertex.
     mVertices.resize(mNumVertices);
     for (uint32_t i = 0; i < mNumVertices; ++i)
     {
-        mVertices[i].mPosition = stream.ReadVec3();
-        mVertices[i].mTexcoord0 = stream.ReadVec2();
-        mVertices[i].mTexcoord1 = { 0.0f, 0.0f };// stream.ReadVec2();
-        mVertices[i].mNormal = stream.ReadVec3();
-        mVertices[i].mBoneIndices[0] = stream.ReadUint8();
-        mVertices[i].mBoneIndices[1] = stream.ReadUint8();
-        mVertices[i].mBoneIndices[2] = stream.ReadUint8();
-        mVertices[i].mBoneIndices[3] = stream.ReadUint8();
-        mVertices[i].mBoneWeights[0] = stream.ReadFloat();
-        mVertices[i].mBoneWeights[1] = stream.ReadFloat();
-        mVertices[i].mBoneWeights[2] = stream.ReadFloat();
-        mVertices[i].mBoneWeights[3] = stream.ReadFloat();
+        VertexSkinned& vertex = mVertices[i];
+        stream.ReadArray32(&vertex.mPosition, 5); // mPosition + mTexcoord0
+        vertex.mTexcoord1 = { 0.0f, 0.0f };
+        stream.ReadArray32(&vertex.mNormal, 3);
+        stream.ReadBytes(vertex.mBoneIndices, MAX_BONE_INFLUENCES);
+        stream.ReadArray32(vertex.mBoneWeights, MAX_BONE_INFLUENCES);
     }
 
     mIndices.resize(mNumIndices);
-    for (uint32_t i = 0; i < mNumIndices; ++i)
-    {
-        mIndices[i] = (IndexType) stream.ReadUint32();
-    }
+    stream.ReadUint32Array(mIndices.data(), mNumIndices);
 
     mBounds.mCenter = stream.ReadVec3();
     mBounds.mRadius = stream.ReadFloat();
@@ -205,25 +184,13 @@ void SkeletalMesh::SaveStream(Stream& stream, Platform platform)
 
 
             stream.WriteUint32((uint32_t)channel.mPositionKeys.size());
-            for (uint32_t i = 0; i < uint32_t(channel.mPositionKeys.size()); ++i)
-            {
-                stream.WriteFloat(channel.mPositionKeys[i].mTime);
-                stream.WriteVec3(channel.mPositionKeys[i].mValue);
-            }
+            stream.WriteArray32(channel.mPositionKeys.data(), uint32_t(channel.mPositionKeys.size() * sizeof(PositionKey) / sizeof(float)));
 
             stream.WriteUint32((uint32_t)channel.mRotationKeys.size());
-            for (uint32_t i = 0; i < uint32_t(channel.mRotationKeys.size()); ++i)
-            {
-                stream.WriteFloat(channel.mRotationKeys[i].mTime);
-                stream.WriteQuat(channel.mRotationKeys[i].mValue);
-            }
+            stream.WriteArray32(channel.mRotationKeys.data(), uint32_t(channel.mRotationKeys.size() * sizeof(RotationKey) / sizeof(float)));
 
             stream.WriteUint32((uint32_t)channel.mScaleKeys.size());
-            for (uint32_t i = 0; i < uint32_t(channel.mScaleKeys.size()); ++i)
-            {
-                stream.WriteFloat(channel.mScaleKeys[i].mTime);
-                stream.WriteVec3(channel.mScaleKeys[i].mValue);
-            }
+            stream.WriteArray32(channel.mScaleKeys.data(), uint32_t(channel.mScaleKeys.size() * sizeof(ScaleKey) / sizeof(float)));
         }
 
         uint32_t numEventTracks = (uint32_t)animation.mEventTracks.size();
@@ -237,37 +204,22 @@ void SkeletalMesh::SaveStream(Stream& stream, Platform platform)
             uint32_t numEventKeys = (uint32_t)track.mEventKeys.size();
             stream.WriteUint32(numEventKeys);
 
-            for (uint32_t k = 0; k < numEventKeys; ++k)
-            {
-                AnimEventKey& key = track.mEventKeys[k];
-                stream.WriteFloat(key.mTime);
-                stream.WriteVec3(key.mValue);
-            }
+            stream.WriteArray32(track.mEventKeys.data(), numEventKeys * sizeof(AnimEventKey) / sizeof(float));
         }
     }
 
     OCT_ASSERT(mNumVertices == mVertices.size());
     for (uint32_t i = 0; i < mNumVertices; ++i)
     {
-        stream.WriteVec3(mVertices[i].mPosition);
-        stream.WriteVec2(mVertices[i].mTexcoord0);
-        //stream.WriteVec2(mVertices[i].mTexcoord1);
-        stream.WriteVec3(mVertices[i].mNormal);
-        stream.WriteUint8(mVertices[i].mBoneIndices[0]);
-        stream.WriteUint8(mVertices[i].mBoneIndices[1]);
-        stream.WriteUint8(mVertices[i].mBoneIndices[2]);
-        stream.WriteUint8(mVertices[i].mBoneIndices[3]);
-        stream.WriteFloat(mVertices[i].mBoneWeights[0]);
-        stream.WriteFloat(mVertices[i].mBoneWeights[1]);
-        stream.WriteFloat(mVertices[i].mBoneWeights[2]);
-        stream.WriteFloat(mVertices[i].mBoneWeights[3]);
+        const VertexSkinned& vertex = mVertices[i];
+        stream.WriteArray32(&vertex.mPosition, 5); // mPosition + mTexcoord0
+        stream.WriteArray32(&vertex.mNormal, 3);
+        stream.WriteBytes(vertex.mBoneIndices, MAX_BONE_INFLUENCES);
+        stream.WriteArray32(vertex.mBoneWeights, MAX_BONE_INFLUENCES);
     }
 
     OCT_ASSERT(mNumIndices == mIndices.size());
-    for (uint32_t i = 0; i < mNumIndices; ++i)
-    {
-        stream.WriteUint32(mIndices[i]);
-    }
+    stream.WriteUint32Array(mIndices.data(), mNumIndices);
 
     stream.WriteVec3(mBounds.mCenter);
     stream.WriteFloat(mBounds.mRadius);
@@ -281,7 +233,10 @@ void SkeletalMesh::Create()
 
     OCT_ASSERT(mNumVertices <= MAX_MESH_VERTEX_COUNT); // Vertex index must fit into IndexType width.
 
-    GFX_CreateSkeletalMeshResource(this, mNumVertices, mVertices.data(), mNumIndices, mIndices.data());
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateSkeletalMeshResource(this, mNumVertices, mVertices.data(), mNumIndices, mIndices.data());
+    }
 
     InitBindPose();
 }
@@ -290,7 +245,10 @@ void SkeletalMesh::Destroy()
 {
     Asset::Destroy();
 
-    GFX_DestroySkeletalMeshResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroySkeletalMeshResource(this);
+    }
     mMaterial = nullptr;
 }
 
@@ -356,6 +314,32 @@ const char* SkeletalMesh::GetTypeImportExt()
     return ".glb";
 }
 
+uint64_t SkeletalMesh::GetCpuMemorySize() const
+{
+    uint64_t size = mVertices.capacity() * sizeof(VertexSkinned) + mIndices.capacity() * sizeof(IndexType);
+    size += mBones.capacity() * sizeof(Bone) + mBindPoseMatrices.capacity() * sizeof(glm::mat4);
+
+    for (uint32_t i = 0; i < mAnimations.size(); ++i)
+    {
+        const Animation& anim = mAnimations[i];
+
+        for (uint32_t c = 0; c < anim.mChannels.size(); ++c)
+        {
+            const Channel& channel = anim.mChannels[c];
+            size += channel.mPositionKeys.capacity() * sizeof(PositionKey);
+            size += channel.mRotationKeys.capacity() * sizeof(RotationKey);
+            size += channel.mScaleKeys.capacity() * sizeof(ScaleKey);
+        }
+    }
+
+    return size;
+}
+
+uint64_t SkeletalMesh::GetGpuMemorySize() const
+{
+    return uint64_t(mNumVertices) * sizeof(VertexSkinned) + uint64_t(mNumIndices) * sizeof(IndexType);
+}
+
 
 uint32_t SkeletalMesh::GetNumIndices()
 {
@@ -955,6 +939,10 @@ void SkeletalMesh::SetupResource(const aiMesh& meshData,
         mIndices[i * 3 + 2] = faces[i].mIndices[2];
     }
 
+    // Reorder for the vertex cache and fetch locality. Bone influences live in the vertex, so they move with it.
+    mNumVertices = OptimizeMesh(mVertices.data(), sizeof(VertexSkinned), mNumVertices, mIndices.data(), mNumIndices);
+    mVertices.resize(mNumVertices);
+
     Create();
 }
 #endif // EDITOR
@@ -103,6 +103,8 @@ public:
     virtual glm::vec4 GetTypeColor() override;
     virtual const char* GetTypeName() override;
     virtual const char* GetTypeImportExt() override;
+    virtual uint64_t GetCpuMemorySize() const override;
+    virtual uint64_t GetGpuMemorySize() const override;
 
     class Material* GetMaterial();
     void SetMaterial(class Material* newMaterial);
@@ -51,6 +51,11 @@ void SoundWave::LoadStream(Stream& stream, Platform platform)
     mCompress = stream.ReadBool();
     mCompressInternal = stream.ReadBool();
 
+    if (mVersion >= ASSET_VERSION_SOUND_WAVE_STREAM)
+    {
+        mStream = stream.ReadBool();
+    }
+
     // Waveform Format
     mNumChannels = stream.ReadUint32();
     mBitsPerSample = stream.ReadUint32();
@@ -68,34 +73,51 @@ void SoundWave::LoadStream(Stream& stream, Platform platform)
 #if EDITOR
         // In Editor, we want to keep the compressed data around so in case we save the file again,
         // we won't be recompressing the sound a second time (adding more artifacts / distortion).
-        mCompressedData = new uint8_t[compressedSize];
-        mCompressedSize = compressedSize;
-        memcpy(mCompressedData, stream.GetData() + stream.GetPos(), compressedSize);
+        bool keepCompressed = true;
+        bool decode = true;
+#else
+        // Streaming sounds (usually music) only keep the compressed data and decode it while playing.
+        bool keepCompressed = mStream;
+        bool decode = !mStream;
 #endif
 
-        Stream outStream;
-        PcmFormat format;
-        format.mBytesPerSample = (mBitsPerSample / 8);
-        format.mNumChannels = mNumChannels;
-        format.mSampleRate = mSampleRate;
-        AUD_DecodeVorbis(stream, outStream, format);
+        if (keepCompressed)
+        {
+            mCompressedData = new uint8_t[compressedSize];
+            mCompressedSize = compressedSize;
+            memcpy(mCompressedData, stream.GetData() + stream.GetPos(), compressedSize);
+        }
 
-        mWaveDataSize = outStream.GetSize();
-        mWaveData = AUD_AllocWaveBuffer(mWaveDataSize);
-        memcpy(mWaveData, outStream.GetData(), mWaveDataSize);
+        if (decode)
+        {
+            Stream outStream;
+            PcmFormat format;
+            format.mBytesPerSample = (mBitsPerSample / 8);
+            format.mNumChannels = mNumChannels;
+            format.mSampleRate = mSampleRate;
+            AUD_DecodeVorbis(stream, outStream, format);
+
+            mWaveDataSize = outStream.GetSize();
+            mWaveData = AUD_AllocWaveBuffer(mWaveDataSize);
+            memcpy(mWaveData, outStream.GetData(), mWaveDataSize);
+        }
+        else
+        {
+            stream.SetPos(stream.GetPos() + compressedSize);
+        }
     }
     else
     {
         // Waveform
         mWaveDataSize = stream.ReadUint32();
         mWaveData = AUD_AllocWaveBuffer(mWaveDataSize);
-        for (uint32_t i = 0; i < mWaveDataSize; ++i)
-        {
-            mWaveData[i] = stream.ReadUint8();
-        }
+        stream.ReadBytes(mWaveData, mWaveDataSize);
     }
 
-    AUD_ProcessWaveBuffer(this);
+    if (mWaveData != nullptr)
+    {
+        AUD_ProcessWaveBuffer(this);
+    }
 }
 
 void SoundWave::SaveStream(Stream& stream, Platform platform)
@@ -108,6 +130,7 @@ void SoundWave::SaveStream(Stream& stream, Platform platform)
     stream.WriteInt8(mAudioClass);
     stream.WriteBool(mCompress);
     stream.WriteBool(mCompressInternal);
+    stream.WriteBool(mStream);
 
     uint32_t numChannels = mNumChannels;
     uint32_t bitsPerSample = mBitsPerSample;
@@ -264,10 +287,7 @@ void SoundWave::SaveStream(Stream& stream, Platform platform)
     {
         // Waveform
         stream.WriteUint32(waveDataSize);
-        for (uint32_t i = 0; i < waveDataSize; ++i)
-        {
-            stream.WriteUint8(waveData[i]);
-        }
+        stream.WriteBytes(waveData, waveDataSize);
     }
 
     if (lqWaveData != nullptr)
@@ -286,20 +306,24 @@ void SoundWave::Destroy()
 {
     Asset::Destroy();
 
-    if (mWaveData != nullptr)
+    if (mWaveData != nullptr ||
+        mCompressedData != nullptr)
     {
+        // Stopping also destroys any stream that is decoding mCompressedData.
         AudioManager::StopSounds(this);
+    }
+
+    if (mWaveData != nullptr)
+    {
         AUD_FreeWaveBuffer(mWaveData);
         mWaveData = nullptr;
     }
 
     if (mCompressedData != nullptr)
     {
-#if !EDITOR
-        // We should only have compressed data in EDITOR.
-        OCT_ASSERT(0);
-#endif
-        delete mCompressedData;
+        delete [] mCompressedData;
+        mCompressedData = nullptr;
+        mCompressedSize = 0;
     }
 }
 
@@ -375,6 +399,7 @@ void SoundWave::GatherProperties(std::vector<Property>& outProps)
     outProps.push_back(Property(DatumType::Byte, "Audio Class", this, &mAudioClass));
     outProps.push_back(Property(DatumType::Bool, "Compress", this, &mCompress));
     outProps.push_back(Property(DatumType::Bool, "Compress Internal", this, &mCompressInternal));
+    outProps.push_back(Property(DatumType::Bool, "Stream", this, &mStream));
 }
 
 glm::vec4 SoundWave::GetTypeColor()
@@ -392,6 +417,16 @@ const char* SoundWave::GetTypeImportExt()
     return ".wav";
 }
 
+uint64_t SoundWave::GetCpuMemorySize() const
+{
+    return uint64_t(mWaveData ? mWaveDataSize : 0) + uint64_t(mCompressedData ? mCompressedSize : 0);
+}
+
+uint64_t SoundWave::GetGpuMemorySize() const
+{
+    return 0;
+}
+
 void SoundWave::SetPitchMultiplier(float pitch)
 {
     mPitchMultiplier = pitch;
@@ -445,6 +480,16 @@ uint32_t SoundWave::GetWaveDataSize() const
     return mWaveDataSize;
 }
 
+const uint8_t* SoundWave::GetCompressedData() const
+{
+    return mCompressedData;
+}
+
+uint32_t SoundWave::GetCompressedSize() const
+{
+    return mCompressedSize;
+}
+
 uint32_t SoundWave::GetNumChannels() const
 {
     return mNumChannels;
@@ -470,6 +515,11 @@ float SoundWave::GetDuration() const
     return float(mNumSamples) / mSampleRate;
 }
 
+bool SoundWave::IsStreaming() const
+{
+    return (mWaveData == nullptr && mCompressedData != nullptr);
+}
+
 uint32_t SoundWave::GetBlockAlign() const
 {
     return mBlockAlign;
@@ -20,6 +20,8 @@ public:
     virtual glm::vec4 GetTypeColor() override;
     virtual const char* GetTypeName() override;
     virtual const char* GetTypeImportExt() override;
+    virtual uint64_t GetCpuMemorySize() const override;
+    virtual uint64_t GetGpuMemorySize() const override;
 
     void SetPcmData(uint8_t* data, uint32_t size, uint32_t numSamples, uint32_t bitsPerSample, uint32_t numChannels, uint32_t sampleRate);
 
@@ -34,6 +36,8 @@ public:
 
     uint8_t* GetWaveData() const;
     uint32_t GetWaveDataSize() const;
+    const uint8_t* GetCompressedData() const;
+    uint32_t GetCompressedSize() const;
     uint32_t GetNumChannels() const;
     uint32_t GetBitsPerSample() const;
     uint32_t GetSampleRate() const;
@@ -43,6 +47,9 @@ public:
 
     float GetDuration() const;
 
+    // Streaming waves keep their Ogg data resident and are decoded while playing.
+    bool IsStreaming() const;
+
 protected:
 
     static bool HandlePreviewPropChange(Datum* datum, uint32_t index, const void* newValue);
@@ -59,6 +66,7 @@ protected:
     int8_t mAudioClass = 0;
     bool mCompress = false;
     bool mCompressInternal = false;
+    bool mStream = false;
 
     // Soundwave Format
     uint32_t mNumChannels = 1;
@@ -8,6 +8,9 @@
 #include "Graphics/Graphics.h"
 
 #if EDITOR
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include "VertexGrid.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -15,12 +18,184 @@
 
 #include "btBulletDynamicsCommon.h"
 #include "BulletCollision/CollisionDispatch/btInternalEdgeUtility.h"
+#include "BulletCollision/CollisionShapes/btOptimizedBvh.h"
 
 using namespace std;
 
 FORCE_LINK_DEF(StaticMesh);
 DEFINE_ASSET(StaticMesh);
 
+// Triangle collision BVH that can be cooked into the mesh asset so it doesn't have to be
+// rebuilt at load time. Only quantized trees are serialized (that's all StaticMesh builds).
+class TriangleBvh : public btOptimizedBvh
+{
+public:
+
+    void SaveStream(Stream& stream) const
+    {
+        OCT_ASSERT(m_useQuantization);
+
+        stream.WriteVec3(BulletToGlm(mLocalAabbMin));
+        stream.WriteVec3(BulletToGlm(mLocalAabbMax));
+        stream.WriteVec3(BulletToGlm(m_bvhAabbMin));
+        stream.WriteVec3(BulletToGlm(m_bvhAabbMax));
+        stream.WriteVec3(BulletToGlm(m_bvhQuantization));
+        stream.WriteUint32(uint32_t(m_traversalMode));
+
+        // Nodes past m_curNodeIndex are scratch space left over from the build.
+        uint32_t numNodes = uint32_t(m_curNodeIndex);
+        stream.WriteUint32(numNodes);
+        for (uint32_t i = 0; i < numNodes; ++i)
+        {
+            const btQuantizedBvhNode& node = m_quantizedContiguousNodes[i];
+            WriteQuantizedAabb(stream, node.m_quantizedAabbMin, node.m_quantizedAabbMax);
+            stream.WriteInt32(node.m_escapeIndexOrTriangleIndex);
+        }
+
+        uint32_t numSubtrees = uint32_t(m_SubtreeHeaders.size());
+        stream.WriteUint32(numSubtrees);
+        for (uint32_t i = 0; i < numSubtrees; ++i)
+        {
+            const btBvhSubtreeInfo& subtree = m_SubtreeHeaders[i];
+            WriteQuantizedAabb(stream, subtree.m_quantizedAabbMin, subtree.m_quantizedAabbMax);
+            stream.WriteInt32(subtree.m_rootNodeIndex);
+            stream.WriteInt32(subtree.m_subtreeSize);
+        }
+    }
+
+    void LoadStream(Stream& stream)
+    {
+        m_useQuantization = true;
+
+        mLocalAabbMin = GlmToBullet(stream.ReadVec3());
+        mLocalAabbMax = GlmToBullet(stream.ReadVec3());
+        m_bvhAabbMin = GlmToBullet(stream.ReadVec3());
+        m_bvhAabbMax = GlmToBullet(stream.ReadVec3());
+        m_bvhQuantization = GlmToBullet(stream.ReadVec3());
+        m_traversalMode = btTraversalMode(stream.ReadUint32());
+
+        uint32_t numNodes = stream.ReadUint32();
+        m_curNodeIndex = int(numNodes);
+        m_quantizedContiguousNodes.resize(int(numNodes));
+        for (uint32_t i = 0; i < numNodes; ++i)
+        {
+            btQuantizedBvhNode& node = m_quantizedContiguousNodes[i];
+            ReadQuantizedAabb(stream, node.m_quantizedAabbMin, node.m_quantizedAabbMax);
+            node.m_escapeIndexOrTriangleIndex = stream.ReadInt32();
+        }
+
+        uint32_t numSubtrees = stream.ReadUint32();
+        m_SubtreeHeaders.resize(int(numSubtrees));
+        for (uint32_t i = 0; i < numSubtrees; ++i)
+        {
+            btBvhSubtreeInfo& subtree = m_SubtreeHeaders[i];
+            ReadQuantizedAabb(stream, subtree.m_quantizedAabbMin, subtree.m_quantizedAabbMax);
+            subtree.m_rootNodeIndex = stream.ReadInt32();
+            subtree.m_subtreeSize = stream.ReadInt32();
+        }
+
+        m_subtreeHeaderCount = int(numSubtrees);
+    }
+
+    // Tight bounds of the source triangles. Handed to the mesh interface as a premade AABB
+    // so the shape doesn't walk every triangle to recompute it.
+    btVector3 mLocalAabbMin = btVector3(0, 0, 0);
+    btVector3 mLocalAabbMax = btVector3(0, 0, 0);
+
+private:
+
+    static void WriteQuantizedAabb(Stream& stream, const unsigned short* aabbMin, const unsigned short* aabbMax)
+    {
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            stream.WriteUint16(aabbMin[c]);
+        }
+
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            stream.WriteUint16(aabbMax[c]);
+        }
+    }
+
+    static void ReadQuantizedAabb(Stream& stream, unsigned short* aabbMin, unsigned short* aabbMax)
+    {
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            aabbMin[c] = stream.ReadUint16();
+        }
+
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            aabbMax[c] = stream.ReadUint16();
+        }
+    }
+};
+
+static void SaveTriangleInfoMap(Stream& stream, const btTriangleInfoMap& infoMap)
+{
+    stream.WriteFloat(infoMap.m_convexEpsilon);
+    stream.WriteFloat(infoMap.m_planarEpsilon);
+    stream.WriteFloat(infoMap.m_equalVertexThreshold);
+    stream.WriteFloat(infoMap.m_edgeDistanceThreshold);
+    stream.WriteFloat(infoMap.m_maxEdgeAngleThreshold);
+    stream.WriteFloat(infoMap.m_zeroAreaThreshold);
+
+    uint32_t numInfos = uint32_t(infoMap.size());
+    stream.WriteUint32(numInfos);
+    for (uint32_t i = 0; i < numInfos; ++i)
+    {
+        const btTriangleInfo* info = infoMap.getAtIndex(int(i));
+        stream.WriteInt32(infoMap.getKeyAtIndex(int(i)).getUid1());
+        stream.WriteInt32(info->m_flags);
+        stream.WriteFloat(info->m_edgeV0V1Angle);
+        stream.WriteFloat(info->m_edgeV1V2Angle);
+        stream.WriteFloat(info->m_edgeV2V0Angle);
+    }
+}
+
+static void LoadTriangleInfoMap(Stream& stream, btTriangleInfoMap& infoMap)
+{
+    infoMap.m_convexEpsilon = stream.ReadFloat();
+    infoMap.m_planarEpsilon = stream.ReadFloat();
+    infoMap.m_equalVertexThreshold = stream.ReadFloat();
+    infoMap.m_edgeDistanceThreshold = stream.ReadFloat();
+    infoMap.m_maxEdgeAngleThreshold = stream.ReadFloat();
+    infoMap.m_zeroAreaThreshold = stream.ReadFloat();
+
+    uint32_t numInfos = stream.ReadUint32();
+    for (uint32_t i = 0; i < numInfos; ++i)
+    {
+        int32_t key = stream.ReadInt32();
+
+        btTriangleInfo info;
+        info.m_flags = stream.ReadInt32();
+        info.m_edgeV0V1Angle = stream.ReadFloat();
+        info.m_edgeV1V2Angle = stream.ReadFloat();
+        info.m_edgeV2V0Angle = stream.ReadFloat();
+
+        infoMap.insert(btHashInt(key), info);
+    }
+}
+
+// Builds a quantized BVH and internal edge info for the mesh interface. The returned shape uses
+// the BVH but doesn't own it or the info map, so the caller is responsible for deleting all three.
+static btBvhTriangleMeshShape* BuildTriangleCollision(btTriangleIndexVertexArray* meshInterface, TriangleBvh*& outBvh, btTriangleInfoMap*& outInfoMap)
+{
+    bool useQuantizedAabbCompression = true;
+    btBvhTriangleMeshShape* shape = new btBvhTriangleMeshShape(meshInterface, useQuantizedAabbCompression, false);
+
+    outBvh = new TriangleBvh();
+    outBvh->mLocalAabbMin = shape->getLocalAabbMin();
+    outBvh->mLocalAabbMax = shape->getLocalAabbMax();
+    outBvh->build(meshInterface, useQuantizedAabbCompression, outBvh->mLocalAabbMin, outBvh->mLocalAabbMax);
+    shape->setOptimizedBvh(outBvh);
+
+    outInfoMap = new btTriangleInfoMap();
+    btGenerateInternalEdgeInfo(shape, outInfoMap);
+
+    return shape;
+}
+
 bool StaticMesh::HandlePropChange(Datum* datum, uint32_t index, const void* newValue)
 {
     Property* prop = static_cast<Property*>(datum);
@@ -34,6 +209,20 @@ bool StaticMesh::HandlePropChange(Datum* datum, uint32_t index, const void* newV
         mesh->SetGenerateTriangleCollisionMesh(*((bool*)newValue));
         handled = true;
     }
+#if EDITOR
+    else if (prop->mName == "LOD Count")
+    {
+        mesh->mNumLods = glm::clamp(*((int32_t*)newValue), 0, MAX_MESH_LODS - 1);
+        mesh->GenerateLods();
+        handled = true;
+    }
+    else if (prop->mName == "LOD Reduction")
+    {
+        mesh->mLodReduction = glm::clamp(*((float*)newValue), 0.05f, 0.95f);
+        mesh->GenerateLods();
+        handled = true;
+    }
+#endif
 
     return handled;
 }
@@ -48,9 +237,13 @@ StaticMesh::StaticMesh() :
     mCollisionShape(nullptr),
     mTriangleCollisionShape(nullptr),
     mTriangleIndexVertexArray(nullptr),
+    mTriangleBvh(nullptr),
     mTriangleInfoMap(nullptr),
     mGenerateTriangleCollisionMesh(false),
-    mHasVertexColor(false)
+    mHasVertexColor(false),
+    mNumLods(0),
+    mLodReduction(0.5f),
+    mLodScreenSize(0.5f)
 {
     mType = StaticMesh::GetStaticType();
 }
@@ -113,35 +306,21 @@ void StaticMesh::LoadStream(Stream& stream, Platform platform)
 
     ResizeVertexArray(mNumVertices);
 
+    // Vertices are serialized field by field in declaration order, which matches
+    // their memory layout, so they can be read as one block.
+    static_assert(sizeof(Vertex) == 40, "Vertex layout no longer matches serialized layout");
+    static_assert(sizeof(VertexColor) == 44, "VertexColor layout no longer matches serialized layout");
     if (mHasVertexColor)
     {
-        VertexColor* vertices = GetColorVertices();
-        for (uint32_t i = 0; i < mNumVertices; ++i)
-        {
-            vertices[i].mPosition = stream.ReadVec3();
-            vertices[i].mTexcoord0 = stream.ReadVec2();
-            vertices[i].mTexcoord1 = stream.ReadVec2();
-            vertices[i].mNormal = stream.ReadVec3();
-            vertices[i].mColor = stream.ReadUint32();
-        }
+        stream.ReadArray32(GetColorVertices(), mNumVertices * sizeof(VertexColor) / sizeof(uint32_t));
     }
     else
     {
-        Vertex* vertices = GetVertices();
-        for (uint32_t i = 0; i < mNumVertices; ++i)
-        {
-            vertices[i].mPosition = stream.ReadVec3();
-            vertices[i].mTexcoord0 = stream.ReadVec2();
-            vertices[i].mTexcoord1 = stream.ReadVec2();
-            vertices[i].mNormal = stream.ReadVec3();
-        }
+        stream.ReadArray32(GetVertices(), mNumVertices * sizeof(Vertex) / sizeof(uint32_t));
     }
 
     ResizeIndexArray(mNumIndices);
-    for (uint32_t i = 0; i < mNumIndices; ++i)
-    {
-        mIndices[i] = (IndexType) stream.ReadUint32();
-    }
+    stream.ReadUint32Array(mIndices, mNumIndices);
 
     // Collision shapes
     bool compound = stream.ReadBool();
@@ -176,13 +355,8 @@ void StaticMesh::LoadStream(Stream& stream, Platform platform)
         case CollisionShape::ConvexHull:
         {
             uint32_t numPoints = stream.ReadUint32();
-            std::vector<glm::vec3> points;
-            points.reserve(numPoints);
-
-            for (uint32_t i = 0; i < numPoints; ++i)
-            {
-                points.push_back(stream.ReadVec3());
-            }
+            std::vector<glm::vec3> points(numPoints);
+            stream.ReadArray32(points.data(), numPoints * 3);
 
             collisionShapes[i] = new btConvexHullShape(
                 reinterpret_cast<float*>(points.data()),
@@ -217,6 +391,42 @@ void StaticMesh::LoadStream(Stream& stream, Platform platform)
 
     mBounds.mCenter = stream.ReadVec3();
     mBounds.mRadius = stream.ReadFloat();
+
+    if (mVersion >= ASSET_VERSION_STATIC_MESH_BVH)
+    {
+        bool cookedTriangleCollision = stream.ReadBool();
+
+        if (cookedTriangleCollision)
+        {
+            OCT_ASSERT(mTriangleBvh == nullptr && mTriangleInfoMap == nullptr);
+
+            TriangleBvh* bvh = new TriangleBvh();
+            bvh->LoadStream(stream);
+            mTriangleBvh = bvh;
+
+            mTriangleInfoMap = new btTriangleInfoMap();
+            LoadTriangleInfoMap(stream, *mTriangleInfoMap);
+        }
+    }
+
+    if (mVersion >= ASSET_VERSION_STATIC_MESH_LODS)
+    {
+        mNumLods = stream.ReadInt32();
+        mLodReduction = stream.ReadFloat();
+        mLodScreenSize = stream.ReadFloat();
+
+        OCT_ASSERT(mLods.size() == 0);
+        uint32_t numLodMeshes = stream.ReadUint32();
+        for (uint32_t i = 0; i < numLodMeshes; ++i)
+        {
+            uint32_t numLodVertices = stream.ReadUint32();
+            uint32_t numLodIndices = stream.ReadUint32();
+            StaticMesh* lod = AddLod(numLodVertices, numLodIndices);
+
+            stream.ReadArray32(lod->mVertices, numLodVertices * GetVertexSize() / sizeof(uint32_t));
+            stream.ReadUint32Array(lod->mIndices, numLodIndices);
+        }
+    }
 }
 
 void StaticMesh::SaveStream(Stream& stream, Platform platform)
@@ -234,32 +444,14 @@ void StaticMesh::SaveStream(Stream& stream, Platform platform)
 
     if (mHasVertexColor)
     {
-        VertexColor* vertices = GetColorVertices();
-        for (uint32_t i = 0; i < mNumVertices; ++i)
-        {
-            stream.WriteVec3(vertices[i].mPosition);
-            stream.WriteVec2(vertices[i].mTexcoord0);
-            stream.WriteVec2(vertices[i].mTexcoord1);
-            stream.WriteVec3(vertices[i].mNormal);
-            stream.WriteUint32(vertices[i].mColor);
-        }
+        stream.WriteArray32(GetColorVertices(), mNumVertices * sizeof(VertexColor) / sizeof(uint32_t));
     }
     else
     {
-        Vertex* vertices = GetVertices();
-        for (uint32_t i = 0; i < mNumVertices; ++i)
-        {
-            stream.WriteVec3(vertices[i].mPosition);
-            stream.WriteVec2(vertices[i].mTexcoord0);
-            stream.WriteVec2(vertices[i].mTexcoord1);
-            stream.WriteVec3(vertices[i].mNormal);
-        }
+        stream.WriteArray32(GetVertices(), mNumVertices * sizeof(Vertex) / sizeof(uint32_t));
     }
 
-    for (uint32_t i = 0; i < mNumIndices; ++i)
-    {
-        stream.WriteUint32(mIndices[i]);
-    }
+    stream.WriteUint32Array(mIndices, mNumIndices);
 
     // Collision shapes
     uint32_t numCollisionShapes = 0;
@@ -355,6 +547,52 @@ void StaticMesh::SaveStream(Stream& stream, Platform platform)
 
     stream.WriteVec3(mBounds.mCenter);
     stream.WriteFloat(mBounds.mRadius);
+
+    // Cook the triangle collision BVH and internal edge info so they can be used as-is on load.
+    // Saving can happen on a cook thread, so if the mesh doesn't have them yet they are built
+    // into temporaries rather than into the live collision data.
+    TriangleBvh* triangleBvh = static_cast<TriangleBvh*>(mTriangleBvh);
+    btTriangleInfoMap* triangleInfoMap = mTriangleInfoMap;
+    btTriangleIndexVertexArray* tempMeshInterface = nullptr;
+    btBvhTriangleMeshShape* tempShape = nullptr;
+
+    if (mGenerateTriangleCollisionMesh &&
+        mNumIndices > 0 &&
+        (triangleBvh == nullptr || triangleInfoMap == nullptr))
+    {
+        tempMeshInterface = CreateTriangleIndexVertexArray();
+        tempShape = BuildTriangleCollision(tempMeshInterface, triangleBvh, triangleInfoMap);
+    }
+
+    bool cookTriangleCollision = mGenerateTriangleCollisionMesh && triangleBvh != nullptr && triangleInfoMap != nullptr;
+    stream.WriteBool(cookTriangleCollision);
+
+    if (cookTriangleCollision)
+    {
+        triangleBvh->SaveStream(stream);
+        SaveTriangleInfoMap(stream, *triangleInfoMap);
+    }
+
+    if (tempShape != nullptr)
+    {
+        delete tempShape;
+        delete triangleBvh;
+        delete triangleInfoMap;
+        delete tempMeshInterface;
+    }
+
+    stream.WriteInt32(mNumLods);
+    stream.WriteFloat(mLodReduction);
+    stream.WriteFloat(mLodScreenSize);
+
+    stream.WriteUint32(uint32_t(mLods.size()));
+    for (StaticMesh* lod : mLods)
+    {
+        stream.WriteUint32(lod->mNumVertices);
+        stream.WriteUint32(lod->mNumIndices);
+        stream.WriteArray32(lod->mVertices, lod->mNumVertices * GetVertexSize() / sizeof(uint32_t));
+        stream.WriteUint32Array(lod->mIndices, lod->mNumIndices);
+    }
 #endif
 }
 
@@ -362,14 +600,22 @@ void StaticMesh::Create()
 {
     Asset::Create();
 
+#if EDITOR
+    // Vertices may have been rewritten in place since the grid was built.
+    DestroyVertexGrid();
+#endif
+
     OCT_ASSERT(mNumVertices <= MAX_MESH_VERTEX_COUNT); // Vertex index must fit into IndexType width.
-    GFX_CreateStaticMeshResource(
-        this,
-        mHasVertexColor,
-        mNumVertices,
-        mHasVertexColor ? (void*)GetColorVertices() : (void*)GetVertices(),
-        mNumIndices,
-        mIndices);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateStaticMeshResource(
+            this,
+            mHasVertexColor,
+            mNumVertices,
+            mHasVertexColor ? (void*)GetColorVertices() : (void*)GetVertices(),
+            mNumIndices,
+            mIndices);
+    }
 
     if (ShouldGenerateTriangleCollision())
     {
@@ -377,6 +623,7 @@ void StaticMesh::Create()
     }
 
     ComputeBounds();
+    CreateLodResources();
 }
 
 void StaticMesh::Destroy()
@@ -391,7 +638,11 @@ void StaticMesh::Destroy()
     mCollisionMeshes.clear();
 #endif
 
-    GFX_DestroyStaticMeshResource(this);
+    DestroyLods();
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyStaticMeshResource(this);
+    }
 
     if (mCollisionShape != nullptr)
     {
@@ -427,6 +678,15 @@ void StaticMesh::Import(const std::string& path, ImportOptions* options)
             return;
         }
 
+        mNumLods = DEFAULT_IMPORT_MESH_LODS;
+
+        if (options != nullptr &&
+            options->HasOption("lodCount"))
+        {
+            int32_t lodCount = options->GetOptionValue("lodCount");
+            mNumLods = glm::clamp(lodCount, 0, MAX_MESH_LODS - 1);
+        }
+
         if (scene->mNumMeshes < 1)
         {
             LogError("Failed to find any meshes in dae file");
@@ -461,6 +721,7 @@ void StaticMesh::Import(const std::string& path, ImportOptions* options)
         }
 
         Create(scene, *mainMesh, (uint32_t)collisionMeshes.size(), collisionMeshes.data());
+        GenerateLods();
     }
 #endif
 }
@@ -470,6 +731,9 @@ void StaticMesh::GatherProperties(std::vector<Property>& outProps)
     Asset::GatherProperties(outProps);
     outProps.push_back(Property(DatumType::Asset, "Material", this, &mMaterial, 1, nullptr, int32_t(Material::GetStaticType())));
     outProps.push_back(Property(DatumType::Bool, "Generate Triangle Collision Mesh", this, &mGenerateTriangleCollisionMesh, 1, HandlePropChange));
+    outProps.push_back(Property(DatumType::Integer, "LOD Count", this, &mNumLods, 1, HandlePropChange));
+    outProps.push_back(Property(DatumType::Float, "LOD Reduction", this, &mLodReduction, 1, HandlePropChange));
+    outProps.push_back(Property(DatumType::Float, "LOD Screen Size", this, &mLodScreenSize));
 }
 
 glm::vec4 StaticMesh::GetTypeColor()
@@ -487,6 +751,37 @@ const char* StaticMesh::GetTypeImportExt()
     return ".dae";
 }
 
+uint64_t StaticMesh::GetCpuMemorySize() const
+{
+    // Vertices and indices stay resident for collision and cooking.
+    uint64_t size = uint64_t(mNumVertices) * GetVertexSize() + uint64_t(mNumIndices) * sizeof(IndexType);
+
+    if (mTriangleBvh != nullptr)
+    {
+        // Rough cost of the quantized nodes, two per triangle.
+        size += uint64_t(mNumIndices / 3) * 2 * sizeof(btQuantizedBvhNode);
+    }
+
+    for (StaticMesh* lod : mLods)
+    {
+        size += lod->GetCpuMemorySize();
+    }
+
+    return size;
+}
+
+uint64_t StaticMesh::GetGpuMemorySize() const
+{
+    uint64_t size = uint64_t(mNumVertices) * GetVertexSize() + uint64_t(mNumIndices) * sizeof(IndexType);
+
+    for (StaticMesh* lod : mLods)
+    {
+        size += lod->GetGpuMemorySize();
+    }
+
+    return size;
+}
+
 uint32_t StaticMesh::GetNumIndices() const
 {
     return mNumIndices;
@@ -616,6 +911,41 @@ uint32_t StaticMesh::GetVertexSize() const
     return mHasVertexColor ? sizeof(VertexColor) : sizeof(Vertex);
 }
 
+uint32_t StaticMesh::GetNumLods() const
+{
+    return uint32_t(mLods.size()) + 1;
+}
+
+StaticMesh* StaticMesh::GetLod(uint32_t lodIndex)
+{
+    OCT_ASSERT(lodIndex < GetNumLods());
+    return (lodIndex == 0) ? this : mLods[lodIndex - 1];
+}
+
+uint32_t StaticMesh::SelectLod(float screenSize, uint32_t currentLod) const
+{
+    // mLodScreenSize is where LOD 1 takes over, and each following LOD switches in at half the
+    // size of the previous one. Moving back to a finer LOD needs a little extra screen size
+    // so that a mesh sitting on a threshold doesn't flicker between levels.
+    uint32_t lod = 0;
+    float threshold = mLodScreenSize;
+
+    while (lod < mLods.size())
+    {
+        float switchSize = (lod < currentLod) ? threshold * (1.0f + MESH_LOD_HYSTERESIS) : threshold;
+
+        if (screenSize >= switchSize)
+        {
+            break;
+        }
+
+        ++lod;
+        threshold *= 0.5f;
+    }
+
+    return lod;
+}
+
 bool StaticMesh::ShouldGenerateTriangleCollision() const
 {
 #if EDITOR
@@ -627,49 +957,75 @@ bool StaticMesh::ShouldGenerateTriangleCollision() const
 #endif
 }
 
-void StaticMesh::CreateTriangleCollisionShape()
+btTriangleIndexVertexArray* StaticMesh::CreateTriangleIndexVertexArray() const
 {
     OCT_ASSERT(mNumIndices % 3 == 0);
 
+    btTriangleIndexVertexArray* meshInterface = new btTriangleIndexVertexArray();
+
+    btIndexedMesh mesh;
+    mesh.m_numTriangles = mNumIndices / 3;
+    mesh.m_triangleIndexBase = (const unsigned char*)mIndices;
+    mesh.m_triangleIndexStride = sizeof(IndexType) * 3;
+    mesh.m_numVertices = mNumVertices;
+    mesh.m_vertexBase = (const unsigned char*)mVertices;
+    mesh.m_vertexStride = GetVertexSize();
+
+    meshInterface->addIndexedMesh(mesh, sizeof(IndexType) == 2 ? PHY_SHORT : PHY_INTEGER);
+
+    return meshInterface;
+}
+
+void StaticMesh::CreateTriangleCollisionShape()
+{
     // Don't do anything if we already have triangle collision data generated
     // Note: In EDITOR, we always generate triangle collision data even if it's disabled.
     if (mTriangleIndexVertexArray == nullptr &&
         mTriangleCollisionShape == nullptr)
     {
-        mTriangleIndexVertexArray = new btTriangleIndexVertexArray();
+        mTriangleIndexVertexArray = CreateTriangleIndexVertexArray();
 
-        btIndexedMesh mesh;
-        mesh.m_numTriangles = mNumIndices / 3;
-        mesh.m_triangleIndexBase = (const unsigned char*)mIndices;
-        mesh.m_triangleIndexStride = sizeof(IndexType) * 3;
-        mesh.m_numVertices = mNumVertices;
-        mesh.m_vertexBase = (const unsigned char*)mVertices;
-        mesh.m_vertexStride = GetVertexSize();
+        TriangleBvh* bvh = static_cast<TriangleBvh*>(mTriangleBvh);
 
-        mTriangleIndexVertexArray->addIndexedMesh(mesh, sizeof(IndexType) == 2 ? PHY_SHORT : PHY_INTEGER);
-
-        bool useQuantizedAabbCompression = true;
-
-        mTriangleCollisionShape = new btBvhTriangleMeshShape(mTriangleIndexVertexArray, useQuantizedAabbCompression);
-        mTriangleInfoMap = new btTriangleInfoMap();
-        btGenerateInternalEdgeInfo(mTriangleCollisionShape, mTriangleInfoMap);
+        if (bvh != nullptr && mTriangleInfoMap != nullptr)
+        {
+            // BVH and edge info were cooked into the asset, skip rebuilding them.
+            mTriangleIndexVertexArray->setPremadeAabb(bvh->mLocalAabbMin, bvh->mLocalAabbMax);
+            mTriangleCollisionShape = new btBvhTriangleMeshShape(mTriangleIndexVertexArray, true, false);
+            mTriangleCollisionShape->setOptimizedBvh(bvh);
+            mTriangleCollisionShape->setTriangleInfoMap(mTriangleInfoMap);
+        }
+        else
+        {
+            // The BVH is owned by the mesh rather than the shape so that it can be cooked in SaveStream().
+            delete bvh;
+            delete mTriangleInfoMap;
+            mTriangleCollisionShape = BuildTriangleCollision(mTriangleIndexVertexArray, bvh, mTriangleInfoMap);
+            mTriangleBvh = bvh;
+        }
     }
 }
 
 void StaticMesh::DestroyTriangleCollisionShape()
 {
-    if (mTriangleInfoMap != nullptr)
-    {
-        delete mTriangleInfoMap;
-        mTriangleInfoMap = nullptr;
-    }
-
     if (mTriangleCollisionShape != nullptr)
     {
         delete mTriangleCollisionShape;
         mTriangleCollisionShape = nullptr;
     }
 
+    if (mTriangleBvh != nullptr)
+    {
+        delete static_cast<TriangleBvh*>(mTriangleBvh);
+        mTriangleBvh = nullptr;
+    }
+
+    if (mTriangleInfoMap != nullptr)
+    {
+        delete mTriangleInfoMap;
+        mTriangleInfoMap = nullptr;
+    }
+
     if (mTriangleIndexVertexArray != nullptr)
     {
         delete mTriangleIndexVertexArray;
@@ -679,6 +1035,10 @@ void StaticMesh::DestroyTriangleCollisionShape()
 
 void StaticMesh::ResizeVertexArray(uint32_t newSize)
 {
+#if EDITOR
+    DestroyVertexGrid();
+#endif
+
     if (mVertices != nullptr)
     {
         free(mVertices);
@@ -755,6 +1115,55 @@ void StaticMesh::ComputeBounds()
     mBounds.mRadius = maxDist;
 }
 
+StaticMesh* StaticMesh::AddLod(uint32_t numVertices, uint32_t numIndices)
+{
+    StaticMesh* lod = new StaticMesh();
+    lod->SetName(GetName() + "_LOD" + std::to_string(mLods.size() + 1));
+    lod->mHasVertexColor = mHasVertexColor;
+    lod->mNumUvMaps = mNumUvMaps;
+    lod->mNumVertices = numVertices;
+    lod->mNumIndices = numIndices;
+    lod->ResizeVertexArray(numVertices);
+    lod->ResizeIndexArray(numIndices);
+    mLods.push_back(lod);
+    return lod;
+}
+
+void StaticMesh::CreateLodResources()
+{
+    // LOD meshes only carry render data. They share the bounds, material and collision of this mesh.
+    for (StaticMesh* lod : mLods)
+    {
+        lod->mBounds = mBounds;
+        if (!GFX_IsHeadless())
+        {
+            GFX_CreateStaticMeshResource(
+                lod,
+                lod->mHasVertexColor,
+                lod->mNumVertices,
+                lod->mVertices,
+                lod->mNumIndices,
+                lod->mIndices);
+        }
+    }
+}
+
+void StaticMesh::DestroyLods()
+{
+    for (StaticMesh* lod : mLods)
+    {
+        if (!GFX_IsHeadless())
+        {
+            GFX_DestroyStaticMeshResource(lod);
+        }
+        lod->ResizeVertexArray(0);
+        lod->ResizeIndexArray(0);
+        delete lod;
+    }
+
+    mLods.clear();
+}
+
 #if EDITOR
 
 const aiNode* FindMeshNode(const aiNode* node, const aiMesh* mesh)
@@ -853,6 +1262,11 @@ void StaticMesh::Create(
         mIndices[i * 3 + 2] = (IndexType) faces[i].mIndices[2];
     }
 
+    // Reorder for the vertex cache and fetch locality. Vertices that no face uses are dropped.
+    float srcAcmr = ComputeAcmr(mIndices, mNumIndices, mNumVertices, 16);
+    mNumVertices = OptimizeMesh(mVertices, GetVertexSize(), mNumVertices, mIndices, mNumIndices);
+    LogDebug("Optimized mesh %s: ACMR %.2f -> %.2f", GetName().c_str(), srcAcmr, ComputeAcmr(mIndices, mNumIndices, mNumVertices, 16));
+
     // Next, create collision objects for the collision meshes.
     uint32_t numCollisionShapes = 0;
     std::vector<btCollisionShape*> collisionShapes;
@@ -933,6 +1347,97 @@ void StaticMesh::Create(
     Create();
 }
 
+void StaticMesh::GenerateLods()
+{
+    DestroyLods();
+
+    if (mNumIndices == 0)
+    {
+        return;
+    }
+
+    uint32_t vertexSize = GetVertexSize();
+    const uint8_t* srcVertices = reinterpret_cast<const uint8_t*>(mVertices);
+    uint32_t prevNumIndices = mNumIndices;
+    float ratio = 1.0f;
+
+    std::vector<IndexType> lodIndices;
+    std::vector<uint32_t> vertexRemap;
+
+    int32_t numLods = glm::min(mNumLods, MAX_MESH_LODS - 1);
+
+    for (int32_t i = 0; i < numLods; ++i)
+    {
+        // Every level simplifies the full mesh so that error doesn't compound from level to level.
+        ratio *= mLodReduction;
+        uint32_t targetNumIndices = uint32_t(mNumIndices * ratio) / 3 * 3;
+        SimplifyMesh(mVertices, vertexSize, mNumVertices, mIndices, mNumIndices, targetNumIndices, lodIndices);
+
+        // Stop once the simplifier runs out of room (e.g. what's left is all seams and borders).
+        if (lodIndices.size() == 0 ||
+            lodIndices.size() > prevNumIndices * 9 / 10)
+        {
+            break;
+        }
+
+        prevNumIndices = uint32_t(lodIndices.size());
+
+        // Keep only the vertices this level still references.
+        vertexRemap.assign(mNumVertices, UINT32_MAX);
+        uint32_t numLodVertices = 0;
+        for (IndexType index : lodIndices)
+        {
+            if (vertexRemap[index] == UINT32_MAX)
+            {
+                vertexRemap[index] = numLodVertices++;
+            }
+        }
+
+        StaticMesh* lod = AddLod(numLodVertices, uint32_t(lodIndices.size()));
+        uint8_t* dstVertices = reinterpret_cast<uint8_t*>(lod->mVertices);
+
+        for (uint32_t v = 0; v < mNumVertices; ++v)
+        {
+            if (vertexRemap[v] != UINT32_MAX)
+            {
+                memcpy(dstVertices + size_t(vertexRemap[v]) * vertexSize, srcVertices + size_t(v) * vertexSize, vertexSize);
+            }
+        }
+
+        for (uint32_t idx = 0; idx < lodIndices.size(); ++idx)
+        {
+            lod->mIndices[idx] = IndexType(vertexRemap[lodIndices[idx]]);
+        }
+
+        lod->mNumVertices = OptimizeMesh(lod->mVertices, vertexSize, lod->mNumVertices, lod->mIndices, lod->mNumIndices);
+    }
+
+    CreateLodResources();
+}
+
+const VertexGrid* StaticMesh::GetVertexGrid()
+{
+    if (mVertexGrid == nullptr)
+    {
+        mVertexGrid = new VertexGrid();
+        mVertexGrid->Build(
+            mVertices,
+            mHasVertexColor ? sizeof(VertexColor) : sizeof(Vertex),
+            (mVertices != nullptr) ? mNumVertices : 0);
+    }
+
+    return mVertexGrid;
+}
+
+void StaticMesh::DestroyVertexGrid()
+{
+    if (mVertexGrid != nullptr)
+    {
+        delete mVertexGrid;
+        mVertexGrid = nullptr;
+    }
+}
+
 #endif // EDITOR
 
 
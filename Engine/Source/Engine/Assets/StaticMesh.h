@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Assets/Material.h"
 #include "Asset.h"
@@ -41,6 +42,8 @@ public:
     virtual glm::vec4 GetTypeColor() override;
     virtual const char* GetTypeName() override;
     virtual const char* GetTypeImportExt() override;
+    virtual uint64_t GetCpuMemorySize() const override;
+    virtual uint64_t GetGpuMemorySize() const override;
 
     class Material* GetMaterial();
     void SetMaterial(class Material* newMaterial);
@@ -65,12 +68,18 @@ public:
     bool IsTriangleCollisionMeshEnabled() const;
     uint32_t GetVertexSize() const;
 
+    // LOD 0 is this mesh. Higher LODs are reduced copies generated at import.
+    uint32_t GetNumLods() const;
+    StaticMesh* GetLod(uint32_t lodIndex);
+    uint32_t SelectLod(float screenSize, uint32_t currentLod) const;
+
     static bool HandlePropChange(Datum* datum, uint32_t index, const void* newValue);
 
 private:
 
     bool ShouldGenerateTriangleCollision() const;
 
+    btTriangleIndexVertexArray* CreateTriangleIndexVertexArray() const;
     void CreateTriangleCollisionShape();
     void DestroyTriangleCollisionShape();
 
@@ -79,6 +88,10 @@ private:
 
     void ComputeBounds();
 
+    StaticMesh* AddLod(uint32_t numVertices, uint32_t numIndices);
+    void CreateLodResources();
+    void DestroyLods();
+
     MaterialRef mMaterial;
     uint32_t mNumVertices;
     uint32_t mNumIndices;
@@ -92,10 +105,16 @@ private:
     btCollisionShape* mCollisionShape;
     btBvhTriangleMeshShape* mTriangleCollisionShape;
     btTriangleIndexVertexArray* mTriangleIndexVertexArray;
+    btOptimizedBvh* mTriangleBvh;
     btTriangleInfoMap* mTriangleInfoMap;
     bool mGenerateTriangleCollisionMesh;
     bool mHasVertexColor;
 
+    std::vector<StaticMesh*> mLods;
+    int32_t mNumLods;
+    float mLodReduction;
+    float mLodScreenSize;
+
     // Graphics Resource
     StaticMeshResource mResource;
 
@@ -106,6 +125,17 @@ public:
         const aiMesh& meshData,
         uint32_t numCollisionMeshes,
         const aiMesh** collisionMeshes);
+
+    void GenerateLods();
+
+    // Spatial index over the vertex positions for the paint tools. Built on first use and dropped
+    // whenever the vertex array is reallocated or the mesh is recreated.
+    const class VertexGrid* GetVertexGrid();
+
+private:
+    void DestroyVertexGrid();
+
+    class VertexGrid* mVertexGrid = nullptr;
 #endif
 
 #if CREATE_CONVEX_COLLISION_MESH
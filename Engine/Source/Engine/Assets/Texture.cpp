@@ -8,7 +8,7 @@
 
 #if EDITOR
 #include <stb_image.h>
-#include <stb_image_write.h>
+#include "Editor/TextureCooker.h"
 #endif
 
 using namespace std;
@@ -104,143 +104,18 @@ bool UseCookedTextures(Platform platform)
 void CookTexture(Texture* texture, Platform platform, const std::vector<uint8_t>& srcPixels, std::vector<uint8_t>& outData)
 {
 #if EDITOR
-    // (1) Save a temporary PNG in the Intermediate directory.
-    std::string tempDir = GetEngineState()->mProjectDirectory + "Intermediate";
-    const char* tempPng = "Temp.png";
-    const char* tempOut = "Temp.tex";
-
-    std::string pngPath = tempDir + "/" + tempPng;
-    std::string outPath = tempDir + "/" + tempOut;
-    if (!DoesDirExist(tempDir.c_str()))
-    {
-        CreateDir(tempDir.c_str());
-    }
-
-    // Check if texture is fully opaque
-    bool opaque = true;
-    for (uint32_t i = 0; i < srcPixels.size(); i += 4)
-    {
-        if (srcPixels[i + 3] != 0xff)
-        {
-            opaque = false;
-            break;
-        }
-    }
-
-    const uint32_t comps = 4;
-    stbi_flip_vertically_on_write(platform == Platform::N3DS);
-    stbi_write_png(pngPath.c_str(), texture->GetWidth(), texture->GetHeight(), comps, srcPixels.data(), texture->GetWidth() * 4);
-
-    // (2) Exec platform-specific texture converter with relevant args, and output to another temp file in Intermediate.
-    std::string cookCmd = "";
-
     switch (platform)
     {
     case Platform::GameCube:
     case Platform::Wii:
-    {
-#if PLATFORM_WINDOWS
-        cookCmd += "gxtexconv.exe";
-#else
-        cookCmd += "$DEVKITPRO/tools/bin/gxtexconv";
-#endif
-
-        cookCmd += " -i ";
-        cookCmd += pngPath.c_str();
-        cookCmd += " -o ";
-        cookCmd += outPath.c_str();
-        cookCmd += " colfmt=";
-
-        PixelFormat format = texture->GetFormat();
-
-        // Alpha doesn't seem to be working with CMPR textures with gxtexconv, but I think
-        // the CMPR does support 1 bit alpha. So I'm not sure what the problem is, but for now we can use a slightly
-        // more compressed format for these.
-        if (format == PixelFormat::CMPR && !opaque)
-        {
-            format = PixelFormat::RGBA5551;
-        }
-
-        switch (format)
-        {
-        case PixelFormat::LA4: cookCmd += "2"; break;
-        case PixelFormat::RGB565: cookCmd += "4"; break;
-        case PixelFormat::RGBA5551: cookCmd += "5"; break;
-        case PixelFormat::CMPR: cookCmd += "14"; break;
-        case PixelFormat::RGBA8: // Fallthrough to default
-        default: cookCmd += "6"; break;
-        }
-
-        if (texture->IsMipmapped())
-        {
-            //int32_t maxLod = int32_t(texture->GetMipLevels()) - 1;
-            int32_t maxLod = static_cast<int32_t>(floor(log2(std::min(texture->GetWidth(), texture->GetHeight()))) + 1) - 3;
-
-            maxLod = glm::max(maxLod, 0);
-            cookCmd += " mipmap=yes ";
-            cookCmd += "minlod=0 ";
-            cookCmd += "maxLod=";
-            cookCmd += to_string(maxLod);
-            cookCmd += " ";
-        }
-        else
-        {
-            cookCmd += " mipmap=no ";
-        }
-
-        cookCmd += "width=" + std::to_string(texture->GetWidth());
-        cookCmd += " height=" + std::to_string(texture->GetHeight()) + " ";
-
+        CookTextureTpl(srcPixels, texture->GetWidth(), texture->GetHeight(), texture->GetFormat(), texture->IsMipmapped(), outData);
         break;
-    }
     case Platform::N3DS:
-    {
-#if PLATFORM_WINDOWS
-        // Need to add devkitpro/tools/bin to your path. Sorry, couldn't access the directory in commandline using the env variable
-        // since "/opt" doesn't exist. Not sure if I can replace "/opt/" with "C:/" ? ... Oh but it could be installed on a different drive...
-        cookCmd += "tex3ds.exe";
-#else
-        cookCmd += "$DEVKITPRO/tools/bin/tex3ds";
-#endif
-
-        cookCmd += " -o ";
-        cookCmd += outPath.c_str();
-        cookCmd += " -f ";
-
-        switch (texture->GetFormat())
-        {
-        case PixelFormat::LA4: cookCmd += "la4"; break;
-        case PixelFormat::RGB565: cookCmd += "rgb565"; break;
-        case PixelFormat::RGBA5551: cookCmd += "rgba5551"; break;
-        case PixelFormat::CMPR: opaque ? (cookCmd += "etc1") : (cookCmd += "etc1a4"); break;
-        case PixelFormat::RGBA8: // Fallthrough to default
-        default: cookCmd += "rgba8"; break;
-        }
-
-        if (texture->IsMipmapped())
-        {
-            cookCmd += " -m triangle ";
-        }
-        else
-        {
-            cookCmd += " ";
-        }
-
-        cookCmd += pngPath.c_str();
-        
+        CookTextureT3x(srcPixels, texture->GetWidth(), texture->GetHeight(), texture->GetFormat(), texture->IsMipmapped(), outData);
         break;
-    }
 
     default: OCT_ASSERT(0); break;
     }
-
-    SYS_Exec(cookCmd.c_str());
-
-    // (3) Use a stream to read the converted file, and copy all the data into outData
-    Stream stream;
-    stream.ReadFile(outPath.c_str(), false);
-    outData.resize(stream.GetSize());
-    memcpy(outData.data(), stream.GetData(), stream.GetSize());
 #endif
 }
 
@@ -296,11 +171,7 @@ void Texture::LoadStream(Stream& stream, Platform platform)
     {
         int32_t size = (mWidth * mHeight * RGBA8_SIZE);
         mPixels.resize(size);
-
-        for (int32_t i = 0; i < size; ++i)
-        {
-            mPixels[i] = stream.ReadUint8();
-        }
+        stream.ReadBytes(mPixels.data(), size);
     }
 }
 
@@ -335,10 +206,7 @@ void Texture::SaveStream(Stream& stream, Platform platform)
     {
         // If not using an custom formats, just write out the raw RGBA8 pixels, uncompressed.
         OCT_ASSERT(mPixels.size() == (mWidth * mHeight * RGBA8_SIZE));
-        for (int32_t i = 0; i < int32_t(mPixels.size()); ++i)
-        {
-            stream.WriteUint8(mPixels[i]);
-        }
+        stream.WriteBytes(mPixels.data(), uint32_t(mPixels.size()));
     }
 #endif
 }
@@ -347,7 +215,10 @@ void Texture::Create()
 {
     Asset::Create();
 
-    GFX_CreateTextureResource(this, mPixels);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateTextureResource(this, mPixels);
+    }
 
 #if !EDITOR
     // This pixel data is transferred to the GPU resource in GFX_CreateTextureResource(), so now 
@@ -362,7 +233,10 @@ void Texture::Destroy()
 {
     Asset::Destroy();
 
-    GFX_DestroyTextureResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyTextureResource(this);
+    }
 }
 
 void Texture::Import(const std::string& path, ImportOptions* options)
@@ -441,6 +315,39 @@ const char* Texture::GetTypeImportExt()
     return ".png";
 }
 
+uint64_t Texture::GetCpuMemorySize() const
+{
+    return mPixels.capacity();
+}
+
+uint64_t Texture::GetGpuMemorySize() const
+{
+    uint32_t bitsPerPixel = 32;
+
+    switch (mFormat)
+    {
+    case PixelFormat::CMPR: bitsPerPixel = 4; break;
+    case PixelFormat::LA4:
+    case PixelFormat::R8: bitsPerPixel = 8; break;
+    case PixelFormat::RGB565:
+    case PixelFormat::RGBA5551:
+    case PixelFormat::Depth16: bitsPerPixel = 16; break;
+    case PixelFormat::RGBA16F:
+    case PixelFormat::Depth32FStencil8: bitsPerPixel = 64; break;
+    default: break;
+    }
+
+    uint64_t size = (uint64_t(mWidth) * mHeight * mLayers * bitsPerPixel) / 8;
+
+    // A full mip chain adds roughly a third.
+    if (mMipmapped && mMipLevels > 1)
+    {
+        size += size / 3;
+    }
+
+    return size;
+}
+
 void Texture::Init(uint32_t width, uint32_t height, uint8_t* data)
 {
     OCT_ASSERT(width > 0);
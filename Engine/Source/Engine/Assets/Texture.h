@@ -28,6 +28,8 @@ public:
     virtual glm::vec4 GetTypeColor() override;
     virtual const char* GetTypeName() override;
     virtual const char* GetTypeImportExt() override;
+    virtual uint64_t GetCpuMemorySize() const override;
+    virtual uint64_t GetGpuMemorySize() const override;
 
     void Init(uint32_t width, uint32_t height, uint8_t* data);
 
@@ -1,4 +1,5 @@
 #include "AudioManager.h"
+#include "AudioStream.h"
 #include "Assets/SoundWave.h"
 #include "Asset.h"
 #include "Log.h"
@@ -13,9 +14,15 @@
 #include "Audio/Audio.h"
 #include "Audio/AudioConstants.h"
 
+#include <algorithm>
+
 // TODO: define max audio sources as AUDIO_MAX_VOICES
 #define MAX_AUDIO_SOURCES AUDIO_MAX_VOICES
 #define MAX_AUDIO_CLASSES 16
+#define MAX_VIRTUAL_SOUNDS 1024
+
+// Sounds that already own a voice rank as if slightly louder, so two similar sounds don't trade voices every frame.
+#define BOUND_VOICE_BIAS 1.25f
 
 struct AudioClassData
 {
@@ -35,6 +42,8 @@ struct AudioSource
     float mOuterRadius;
     AttenuationFunc mAttenuationFunc;
     int8_t mAudioClass;
+    AudioStream* mStream;
+    uint32_t mSoundId;
 
     AudioSource()
     {
@@ -77,7 +86,34 @@ struct AudioSource
         mOuterRadius = -1.0f;
         mAttenuationFunc = AttenuationFunc::Count;
         mAudioClass = 0;
+        mStream = nullptr;
+        mSoundId = 0;
+    }
+
+    bool IsSpatial() const
+    {
+        return (mInnerRadius >= 0.0f && mOuterRadius > 0.0f);
     }
+};
+
+// Sounds started with PlaySound2D/3D. Only the most audible ones are bound to a voice (mVoice),
+// the rest keep advancing their play time so they can resume at the right offset.
+struct VirtualSound
+{
+    SoundWaveRef mSoundWave;
+    float mVolumeMult = 1.0f;
+    float mPitchMult = 1.0f;
+    int32_t mPriority = 0;
+    glm::vec3 mPosition = { 0.0f, 0.0f, 0.0f };
+    float mInnerRadius = -1.0f;
+    float mOuterRadius = -1.0f;
+    AttenuationFunc mAttenuationFunc = AttenuationFunc::Count;
+    int8_t mAudioClass = 0;
+    bool mLoop = false;
+    bool mSelected = false;
+    float mPlayTime = 0.0f;
+    uint32_t mId = 0;
+    uint32_t mVoice = MAX_AUDIO_SOURCES;
 
     bool IsSpatial() const
     {
@@ -85,8 +121,20 @@ struct AudioSource
     }
 };
 
+// Either a virtual sound (mSoundIndex) or a playing Audio3D (mComponent) that wants a voice this frame.
+struct VoiceCandidate
+{
+    float mAudibility = 0.0f;
+    int32_t mPriority = 0;
+    uint32_t mSoundIndex = 0;
+    Audio3D* mComponent = nullptr;
+};
+
 static AudioClassData sAudioClassData[MAX_AUDIO_CLASSES];
 static AudioSource sAudioSources[MAX_AUDIO_SOURCES];
+static std::vector<VirtualSound> sVirtualSounds;
+static std::vector<VoiceCandidate> sCandidates;
+static uint32_t sNextSoundId = 1;
 static float sMasterVolume = 1.0f;
 static float sMasterPitch = 1.0f;
 
@@ -159,6 +207,35 @@ void CalcVolumeAttenuationLR(
 }
 
 
+static int8_t ClampAudioClass(int32_t audioClass)
+{
+    return int8_t(glm::clamp<int32_t>(audioClass, 0, MAX_AUDIO_CLASSES - 1));
+}
+
+static float CalcAudibility(
+    SoundWave* soundWave,
+    float volumeMult,
+    int8_t audioClass,
+    bool spatial,
+    glm::vec3 position,
+    float innerRadius,
+    float outerRadius,
+    AttenuationFunc attenFunc,
+    glm::vec3 listenerPos)
+{
+    float audibility = volumeMult * soundWave->GetVolumeMultiplier() * sAudioClassData[audioClass].mVolume * sMasterVolume;
+
+    if (spatial)
+    {
+        float dist = glm::distance(listenerPos, position);
+        audibility = (dist < outerRadius) ?
+            audibility * CalcVolumeAttenuation(attenFunc, innerRadius, outerRadius, dist) :
+            0.0f;
+    }
+
+    return audibility;
+}
+
 void PlayAudio(
     uint32_t sourceIndex,
     SoundWave* soundWave,
@@ -177,7 +254,7 @@ void PlayAudio(
     OCT_ASSERT(sourceIndex < MAX_AUDIO_SOURCES);
     OCT_ASSERT(soundWave != nullptr);
 
-    audioClass = glm::clamp<int8_t>(audioClass, 0, MAX_AUDIO_CLASSES - 1);
+    audioClass = ClampAudioClass(audioClass);
 
     sAudioSources[sourceIndex].Set(
         soundWave,
@@ -204,14 +281,32 @@ void PlayAudio(
 
     bool spatial = sAudioSources[sourceIndex].IsSpatial();
 
-    AUD_Play(
-        sourceIndex,
-        soundWave,
-        volume,
-        pitch,
-        loop,
-        startTime,
-        spatial);
+    if (soundWave->IsStreaming())
+    {
+        AudioStream* stream = AudioStream::Create(soundWave, loop, startTime);
+        sAudioSources[sourceIndex].mStream = stream;
+
+        if (stream != nullptr)
+        {
+            AUD_PlayStream(
+                sourceIndex,
+                stream->GetFormat(),
+                volume,
+                pitch,
+                spatial);
+        }
+    }
+    else
+    {
+        AUD_Play(
+            sourceIndex,
+            soundWave,
+            volume,
+            pitch,
+            loop,
+            startTime,
+            spatial);
+    }
 }
 
 void StopAudio(uint32_t sourceIndex)
@@ -223,169 +318,287 @@ void StopAudio(uint32_t sourceIndex)
 
     AUD_Stop(sourceIndex);
 
+    // The voice no longer references the stream's buffers once stopped.
+    AudioStream::Destroy(sAudioSources[sourceIndex].mStream);
+    sAudioSources[sourceIndex].mStream = nullptr;
+
     sAudioSources[sourceIndex].Reset();
 }
 
-uint32_t FindAvailableAudioSourceIndex(int32_t inPriority)
+uint32_t FindFreeAudioSourceIndex()
 {
-    uint32_t availableIndex = MAX_AUDIO_SOURCES;
-    int32_t lowestPriority = 0x7fffffff;
-    uint32_t lowestPriorityIndex = 0;
+    uint32_t freeIndex = MAX_AUDIO_SOURCES;
 
     for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
     {
         if (sAudioSources[i].mSoundWave.Get() == nullptr)
         {
-            availableIndex = i;
+            freeIndex = i;
             break;
         }
+    }
+
+    return freeIndex;
+}
+
+static void BindVirtualSound(VirtualSound& sound, uint32_t sourceIndex)
+{
+    OCT_ASSERT(sound.mVoice == MAX_AUDIO_SOURCES);
 
-        if (sAudioSources[i].mPriority < lowestPriority)
+    PlayAudio(
+        sourceIndex,
+        sound.mSoundWave.Get<SoundWave>(),
+        nullptr,
+        sound.mVolumeMult,
+        sound.mPitchMult,
+        sound.mPriority,
+        sound.mPosition,
+        sound.mInnerRadius,
+        sound.mOuterRadius,
+        sound.mAttenuationFunc,
+        sound.mAudioClass,
+        sound.mLoop,
+        sound.mPlayTime);
+
+    sAudioSources[sourceIndex].mSoundId = sound.mId;
+    sound.mVoice = sourceIndex;
+}
+
+static void RemoveVirtualSound(uint32_t index)
+{
+    OCT_ASSERT(index < sVirtualSounds.size());
+
+    if (sVirtualSounds[index].mVoice != MAX_AUDIO_SOURCES)
+    {
+        StopAudio(sVirtualSounds[index].mVoice);
+    }
+
+    sVirtualSounds[index] = sVirtualSounds.back();
+    sVirtualSounds.pop_back();
+}
+
+static void AddVirtualSound(
+    SoundWave* soundWave,
+    float volumeMult,
+    float pitchMult,
+    int32_t priority,
+    glm::vec3 position,
+    float innerRadius,
+    float outerRadius,
+    AttenuationFunc attenFunc,
+    int32_t audioClass,
+    bool loop,
+    float startTime)
+{
+    if (sVirtualSounds.size() >= MAX_VIRTUAL_SOUNDS)
+    {
+        // Make room by dropping the lowest priority sound that isn't currently audible.
+        uint32_t lowestIndex = UINT32_MAX;
+        int32_t lowestPriority = priority;
+
+        for (uint32_t i = 0; i < sVirtualSounds.size(); ++i)
+        {
+            if (sVirtualSounds[i].mVoice == MAX_AUDIO_SOURCES &&
+                sVirtualSounds[i].mPriority < lowestPriority)
+            {
+                lowestPriority = sVirtualSounds[i].mPriority;
+                lowestIndex = i;
+            }
+        }
+
+        if (lowestIndex == UINT32_MAX)
         {
-            lowestPriority = sAudioSources[i].mPriority;
-            lowestPriorityIndex = i;
+            LogWarning("Too many virtual sounds, dropping %s", soundWave->GetName().c_str());
+            return;
         }
+
+        RemoveVirtualSound(lowestIndex);
     }
 
-    // All sources are being used. But see if we can evict one with lower priority
-    if (availableIndex == MAX_AUDIO_SOURCES &&
-        lowestPriority < inPriority)
+    sVirtualSounds.push_back(VirtualSound());
+    VirtualSound& sound = sVirtualSounds.back();
+    sound.mSoundWave = soundWave;
+    sound.mVolumeMult = volumeMult;
+    sound.mPitchMult = pitchMult;
+    sound.mPriority = priority;
+    sound.mPosition = position;
+    sound.mInnerRadius = innerRadius;
+    sound.mOuterRadius = outerRadius;
+    sound.mAttenuationFunc = attenFunc;
+    sound.mAudioClass = ClampAudioClass(audioClass);
+    sound.mLoop = loop;
+    sound.mPlayTime = startTime;
+    sound.mId = sNextSoundId++;
+
+    if (sNextSoundId == 0)
     {
-        LogWarning("Evicting lower priority sound");
-        StopAudio(lowestPriorityIndex);
-        availableIndex = lowestPriorityIndex;
+        sNextSoundId = 1;
     }
 
-    return availableIndex;
+    // Start right away if there is a spare voice, otherwise it competes for one on the next Update().
+    uint32_t sourceIndex = FindFreeAudioSourceIndex();
+
+    if (sourceIndex < MAX_AUDIO_SOURCES)
+    {
+        World* world = GetWorld(0);
+        Node3D* listener = world ? world->GetAudioReceiver() : nullptr;
+        glm::vec3 listenerPos = listener ? listener->GetWorldPosition() : glm::vec3(0, 0, 0);
+
+        float audibility = CalcAudibility(
+            soundWave,
+            sound.mVolumeMult,
+            sound.mAudioClass,
+            sound.IsSpatial(),
+            sound.mPosition,
+            sound.mInnerRadius,
+            sound.mOuterRadius,
+            sound.mAttenuationFunc,
+            listenerPos);
+
+        if (audibility > 0.0f)
+        {
+            BindVirtualSound(sound, sourceIndex);
+        }
+    }
 }
 
-void AudioManager::Initialize()
+static bool CompareVoiceCandidates(const VoiceCandidate& l, const VoiceCandidate& r)
 {
+    if (l.mPriority != r.mPriority)
+    {
+        return l.mPriority > r.mPriority;
+    }
 
+    return l.mAudibility > r.mAudibility;
 }
 
-void AudioManager::Shutdown()
+void AudioManager::Initialize()
 {
+    AudioStream::Initialize();
+}
 
+void AudioManager::Shutdown()
+{
+    StopAllSounds();
+    AudioStream::Shutdown();
 }
 
 void AudioManager::Update(float deltaTime)
 {
     SCOPED_FRAME_STAT("Audio");
 
-    // TODO:
-    // (1) -- Update Active Sources --
-    //     Iterate through audio sources and update volume for any 3D sounds (including components)
-    //     If an source has finished playing, Reset the source (and notify the component if applicable).
-    //     Do not evict 3D sounds that are out of range. We want to hear them when we return.
-    //     Evict components if out of hearing range.
-    // (2) -- Play New Sounds --
-    //     Iterate over Audio3D list. If any component is playing and in range, but has no audio source active,
-    //     then find an available audio source and Play(). Use component's mPlayTime var to start at correct time.
-
+    // (1) -- Retire Voices --
+    //     Release voices that finished playing or whose component was stopped.
+    // (2) -- Advance Virtual Sounds --
+    //     Every logical sound keeps its play time so it can resume at the right offset. Unbound sounds
+    //     that run past their end are dropped.
+    // (3) -- Rank --
+    //     Estimate the audibility of every virtual sound and playing Audio3D and pick the best
+    //     MAX_AUDIO_SOURCES by priority, then audibility.
+    // (4) -- Virtualize / Bind --
+    //     Bound sounds that were outranked give up their voice. Selected sounds without a voice get one.
+    // (5) -- Update Bound 3D Sounds --
+    //     Refresh attenuation and pitch of the spatial voices.
 
-    // (1) Update Active Sources
     Node3D* listener = GetWorld(0)->GetAudioReceiver();
     glm::vec3 listenerPos = listener ? listener->GetWorldPosition() : glm::vec3(0,0,0);
     glm::vec3 listenerRight = listener ? listener->GetRightVector() : glm::vec3(1.0f, 0.0f, 0.0f);
 
+    // (1) Retire Voices
     for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
     {
-        int8_t audioClass = sAudioSources[i].mAudioClass;
-        float classVolume = sAudioClassData[audioClass].mVolume;
-        float classPitch = sAudioClassData[audioClass].mPitch;
+        if (sAudioSources[i].mSoundWave.Get() == nullptr)
+            continue;
 
-        if (sAudioSources[i].mSoundWave.Get() != nullptr)
+        AudioStream* stream = sAudioSources[i].mStream;
+
+        if (stream != nullptr)
         {
-            SoundWave* soundWave = sAudioSources[i].mSoundWave.Get<SoundWave>();
-            bool stopped = false;
+            // Hand any newly decoded buffers to the voice.
+            stream->Update(i);
+        }
 
+        if (sAudioSources[i].mComponent != nullptr &&
+            !sAudioSources[i].mComponent->IsPlaying())
+        {
+            // If the component has been stopped, then stop the source!
+            StopAudio(i);
+        }
+        else if (stream != nullptr ? stream->IsFinished() : !AUD_IsPlaying(i))
+        {
+            // If the audio engine has finished the sound wave, then stop it.
             if (sAudioSources[i].mComponent != nullptr &&
-                !sAudioSources[i].mComponent->IsPlaying())
+                !sAudioSources[i].mComponent->GetLoop())
             {
-                // If the component has been stopped, then stop the source!
-                StopAudio(i);
-                stopped = true;
+                sAudioSources[i].mComponent->StopAudio();
             }
-            else if (!AUD_IsPlaying(i))
-            {
-                // If the audio engine has finished the sound wave, then stop it.
-                if (sAudioSources[i].mComponent != nullptr &&
-                    !sAudioSources[i].mComponent->GetLoop())
-                {
-                    sAudioSources[i].mComponent->StopAudio();
-                }
 
-                StopAudio(i);
-                stopped = true;
-            }
-            else if (sAudioSources[i].IsSpatial())
+            for (uint32_t s = 0; s < sVirtualSounds.size(); ++s)
             {
-                // Update attenuation of the 3D sound
-                if (sAudioSources[i].mComponent != nullptr)
+                if (sVirtualSounds[s].mVoice == i)
                 {
-                    Audio3D* comp = sAudioSources[i].mComponent;
-                    sAudioSources[i].mPosition = comp->GetWorldPosition();
-                    sAudioSources[i].mVolumeMult = comp->GetVolume();
+                    RemoveVirtualSound(s);
+                    break;
                 }
+            }
 
-                float dist = glm::distance(listenerPos, sAudioSources[i].mPosition);
+            StopAudio(i);
+        }
+    }
 
-                if (sAudioSources[i].mComponent != nullptr && 
-                    dist > sAudioSources[i].mOuterRadius)
-                {
-                    // Sound is no longer in hearing range.
-                    // If this belongs to a component, StopAudio() the sound.
-                    StopAudio(i);
-                    stopped = true;
-                }
-                else
-                {
+    // (2) Advance Virtual Sounds
+    for (int32_t s = int32_t(sVirtualSounds.size()) - 1; s >= 0; --s)
+    {
+        VirtualSound& sound = sVirtualSounds[s];
+        SoundWave* soundWave = sound.mSoundWave.Get<SoundWave>();
+        OCT_ASSERT(soundWave != nullptr);
 
-#if 0
-                    // Otherwise update the new volume
-                    float volume = CalcVolumeAttenuation(
-                        sAudioSources[i].mAttenuationFunc,
-                        sAudioSources[i].mInnerRadius,
-                        sAudioSources[i].mOuterRadius,
-                        dist);
-
-                    volume = volume * sAudioSources[i].mVolumeMult * soundWave->GetVolumeMultiplier() * classVolume * sMasterVolume;
-                    AUD_SetVolume(i, volume, volume);
-#else
-                    float volLeft = 1.0f;
-                    float volRight = 1.0f;
-
-                    CalcVolumeAttenuationLR(sAudioSources[i].mAttenuationFunc,
-                        sAudioSources[i].mInnerRadius,
-                        sAudioSources[i].mOuterRadius,
-                        sAudioSources[i].mPosition,
-                        listenerPos,
-                        listenerRight,
-                        dist,
-                        volLeft,
-                        volRight);
-
-                    volLeft = volLeft * sAudioSources[i].mVolumeMult * soundWave->GetVolumeMultiplier() * classVolume * sMasterVolume;
-                    volRight = volRight * sAudioSources[i].mVolumeMult * soundWave->GetVolumeMultiplier() * classVolume * sMasterVolume;
-                    AUD_SetVolume(i, volLeft, volRight);
-#endif
-                }
+        float pitch = sound.mPitchMult * soundWave->GetPitchMultiplier() * sAudioClassData[sound.mAudioClass].mPitch * sMasterPitch;
+        float duration = soundWave->GetDuration();
+        sound.mPlayTime += deltaTime * pitch;
 
-                if (!stopped &&
-                    sAudioSources[i].mComponent != nullptr)
-                {
-                    if (sAudioSources[i].mPitchMult != sAudioSources[i].mComponent->GetPitch())
-                    {
-                        sAudioSources[i].mPitchMult = sAudioSources[i].mComponent->GetPitch();
-                        AUD_SetPitch(i, sAudioSources[i].mPitchMult);
-                    }
-                }
+        if (sound.mPlayTime >= duration)
+        {
+            if (sound.mLoop && duration > 0.0f)
+            {
+                sound.mPlayTime = glm::mod(sound.mPlayTime, duration);
             }
+            else if (sound.mVoice == MAX_AUDIO_SOURCES)
+            {
+                RemoveVirtualSound(uint32_t(s));
+            }
+        }
+    }
+
+    // (3) Rank
+    sCandidates.clear();
+
+    for (uint32_t s = 0; s < sVirtualSounds.size(); ++s)
+    {
+        VirtualSound& sound = sVirtualSounds[s];
+        sound.mSelected = false;
+
+        float audibility = CalcAudibility(
+            sound.mSoundWave.Get<SoundWave>(),
+            sound.mVolumeMult,
+            sound.mAudioClass,
+            sound.IsSpatial(),
+            sound.mPosition,
+            sound.mInnerRadius,
+            sound.mOuterRadius,
+            sound.mAttenuationFunc,
+            listenerPos);
+
+        if (audibility > 0.0f)
+        {
+            VoiceCandidate candidate;
+            candidate.mAudibility = (sound.mVoice != MAX_AUDIO_SOURCES) ? audibility * BOUND_VOICE_BIAS : audibility;
+            candidate.mPriority = sound.mPriority;
+            candidate.mSoundIndex = s;
+            sCandidates.push_back(candidate);
         }
     }
 
-    // (2) Play New Sounds
     World* world = GetWorld(0);
     if (world != nullptr)
     {
@@ -395,49 +608,168 @@ void AudioManager::Update(float deltaTime)
         {
             Audio3D* node = audioNodes[i];
 
-            // In the case that the node is playing, but it is inaudible (not a current sound source)
-            // Then we need to check if it should be audible
             if (node->IsPlaying() &&
-                !node->IsAudible() &&
                 node->GetVolume() > 0.0f &&
                 node->GetSoundWave() != nullptr)
             {
-                // We need to check the distance to the listener. Should it be audible?
-                glm::vec3 nodePosition = node->GetWorldPosition();
-                float dist = glm::distance(listenerPos, nodePosition);
-                float outerRadius = glm::max(0.0f, node->GetOuterRadius());
+                float audibility = CalcAudibility(
+                    node->GetSoundWave(),
+                    node->GetVolume(),
+                    ClampAudioClass(node->GetAudioClass()),
+                    true,
+                    node->GetWorldPosition(),
+                    node->GetInnerRadius(),
+                    glm::max(0.0f, node->GetOuterRadius()),
+                    node->GetAttenuationFunc(),
+                    listenerPos);
+
+                if (audibility > 0.0f)
+                {
+                    VoiceCandidate candidate;
+                    candidate.mAudibility = node->IsAudible() ? audibility * BOUND_VOICE_BIAS : audibility;
+                    candidate.mPriority = node->GetPriority();
+                    candidate.mComponent = node;
+                    sCandidates.push_back(candidate);
+                }
+            }
+        }
+    }
+
+    uint32_t numSelected = glm::min<uint32_t>(uint32_t(sCandidates.size()), MAX_AUDIO_SOURCES);
+    std::partial_sort(sCandidates.begin(), sCandidates.begin() + numSelected, sCandidates.end(), CompareVoiceCandidates);
+
+    for (uint32_t c = 0; c < numSelected; ++c)
+    {
+        if (sCandidates[c].mComponent == nullptr)
+        {
+            sVirtualSounds[sCandidates[c].mSoundIndex].mSelected = true;
+        }
+    }
+
+    // (4) Virtualize / Bind
+    for (uint32_t s = 0; s < sVirtualSounds.size(); ++s)
+    {
+        VirtualSound& sound = sVirtualSounds[s];
+
+        if (sound.mVoice != MAX_AUDIO_SOURCES &&
+            !sound.mSelected)
+        {
+            StopAudio(sound.mVoice);
+            sound.mVoice = MAX_AUDIO_SOURCES;
+        }
+    }
+
+    for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
+    {
+        Audio3D* comp = sAudioSources[i].mComponent;
 
-                if (dist < outerRadius)
+        if (comp != nullptr)
+        {
+            bool selected = false;
+
+            for (uint32_t c = 0; c < numSelected; ++c)
+            {
+                if (sCandidates[c].mComponent == comp)
                 {
-                    // It should be audible, so attempt to add it as a sound source.
-                    uint32_t sourceIndex = FindAvailableAudioSourceIndex(node->GetPriority());
-
-                    float soundDuration = node->GetSoundWave()->GetDuration();
-                    float startTime = glm::mod(node->GetStartOffset() + node->GetPlayTime(), soundDuration);
-                    if (startTime >= soundDuration)
-                    {
-                        startTime = 0.0f;
-                    }
-
-                    if (sourceIndex < MAX_AUDIO_SOURCES)
-                    {
-                        PlayAudio(
-                            sourceIndex,
-                            node->GetSoundWave(),
-                            node,
-                            node->GetVolume(),
-                            node->GetPitch(),
-                            node->GetPriority(),
-                            nodePosition,
-                            node->GetInnerRadius(),
-                            node->GetOuterRadius(),
-                            node->GetAttenuationFunc(),
-                            node->GetAudioClass(),
-                            node->GetLoop(),
-                            startTime);
-                    }
+                    selected = true;
+                    break;
                 }
             }
+
+            if (!selected)
+            {
+                // The component keeps its play time, so it resumes where it should when audible again.
+                StopAudio(i);
+            }
+        }
+    }
+
+    for (uint32_t c = 0; c < numSelected; ++c)
+    {
+        const VoiceCandidate& candidate = sCandidates[c];
+        Audio3D* node = candidate.mComponent;
+
+        if (node != nullptr ? node->IsAudible() : (sVirtualSounds[candidate.mSoundIndex].mVoice != MAX_AUDIO_SOURCES))
+            continue;
+
+        uint32_t sourceIndex = FindFreeAudioSourceIndex();
+        OCT_ASSERT(sourceIndex < MAX_AUDIO_SOURCES);
+
+        if (node != nullptr)
+        {
+            float soundDuration = node->GetSoundWave()->GetDuration();
+            float startTime = glm::mod(node->GetStartOffset() + node->GetPlayTime(), soundDuration);
+            if (startTime >= soundDuration)
+            {
+                startTime = 0.0f;
+            }
+
+            PlayAudio(
+                sourceIndex,
+                node->GetSoundWave(),
+                node,
+                node->GetVolume(),
+                node->GetPitch(),
+                node->GetPriority(),
+                node->GetWorldPosition(),
+                node->GetInnerRadius(),
+                node->GetOuterRadius(),
+                node->GetAttenuationFunc(),
+                node->GetAudioClass(),
+                node->GetLoop(),
+                startTime);
+        }
+        else
+        {
+            BindVirtualSound(sVirtualSounds[candidate.mSoundIndex], sourceIndex);
+        }
+    }
+
+    // (5) Update Bound 3D Sounds
+    for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
+    {
+        if (sAudioSources[i].mSoundWave.Get() == nullptr ||
+            !sAudioSources[i].IsSpatial())
+        {
+            continue;
+        }
+
+        SoundWave* soundWave = sAudioSources[i].mSoundWave.Get<SoundWave>();
+        float classVolume = sAudioClassData[sAudioSources[i].mAudioClass].mVolume;
+
+        if (sAudioSources[i].mComponent != nullptr)
+        {
+            Audio3D* comp = sAudioSources[i].mComponent;
+            sAudioSources[i].mPosition = comp->GetWorldPosition();
+            sAudioSources[i].mVolumeMult = comp->GetVolume();
+        }
+
+        float dist = glm::distance(listenerPos, sAudioSources[i].mPosition);
+
+        float volLeft = 1.0f;
+        float volRight = 1.0f;
+
+        CalcVolumeAttenuationLR(sAudioSources[i].mAttenuationFunc,
+            sAudioSources[i].mInnerRadius,
+            sAudioSources[i].mOuterRadius,
+            sAudioSources[i].mPosition,
+            listenerPos,
+            listenerRight,
+            dist,
+            volLeft,
+            volRight);
+
+        volLeft = volLeft * sAudioSources[i].mVolumeMult * soundWave->GetVolumeMultiplier() * classVolume * sMasterVolume;
+        volRight = volRight * sAudioSources[i].mVolumeMult * soundWave->GetVolumeMultiplier() * classVolume * sMasterVolume;
+        AUD_SetVolume(i, volLeft, volRight);
+
+        if (sAudioSources[i].mComponent != nullptr)
+        {
+            if (sAudioSources[i].mPitchMult != sAudioSources[i].mComponent->GetPitch())
+            {
+                sAudioSources[i].mPitchMult = sAudioSources[i].mComponent->GetPitch();
+                AUD_SetPitch(i, sAudioSources[i].mPitchMult);
+            }
         }
     }
 }
@@ -450,15 +782,11 @@ void AudioManager::PlaySound2D(
     bool loop,
     int32_t priority)
 {
-    uint32_t sourceIndex = FindAvailableAudioSourceIndex(priority);
-
-    if (soundWave != nullptr && 
-        sourceIndex < MAX_AUDIO_SOURCES)
+    // Servers have no audio device. Nothing would retire these sounds since Update() isn't called.
+    if (soundWave != nullptr && !IsDedicatedServer())
     {
-        PlayAudio(
-            sourceIndex,
+        AddVirtualSound(
             soundWave,
-            nullptr,
             volumeMult,
             pitchMult,
             priority,
@@ -484,15 +812,10 @@ void AudioManager::PlaySound3D(
     bool loop,
     int32_t priority)
 {
-    uint32_t sourceIndex = FindAvailableAudioSourceIndex(priority);
-
-    if (soundWave != nullptr && 
-        sourceIndex != MAX_AUDIO_SOURCES)
+    if (soundWave != nullptr && !IsDedicatedServer())
     {
-        PlayAudio(
-            sourceIndex,
+        AddVirtualSound(
             soundWave,
-            nullptr,
             volumeMult,
             pitchMult,
             priority,
@@ -515,6 +838,19 @@ void AudioManager::UpdateSound(
 {
     if (soundWave != nullptr)
     {
+        for (uint32_t s = 0; s < sVirtualSounds.size(); ++s)
+        {
+            if (sVirtualSounds[s].mSoundWave == soundWave)
+            {
+                // Takes effect on the voice below if the sound is currently bound.
+                sVirtualSounds[s].mVolumeMult = volume;
+                sVirtualSounds[s].mPitchMult = pitch;
+                sVirtualSounds[s].mLoop = loop;
+                sVirtualSounds[s].mPriority = priority;
+                break;
+            }
+        }
+
         for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
         {
             if (sAudioSources[i].mSoundWave == soundWave)
@@ -557,6 +893,14 @@ void AudioManager::StopSounds(SoundWave* soundWave)
     if (soundWave == nullptr)
         return;
 
+    for (int32_t s = int32_t(sVirtualSounds.size()) - 1; s >= 0; --s)
+    {
+        if (sVirtualSounds[s].mSoundWave.Get() == soundWave)
+        {
+            RemoveVirtualSound(uint32_t(s));
+        }
+    }
+
     for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
     {
         if (sAudioSources[i].mSoundWave.Get() == soundWave)
@@ -568,6 +912,16 @@ void AudioManager::StopSounds(SoundWave* soundWave)
 
 void AudioManager::StopSound(const std::string& name)
 {
+    for (int32_t s = int32_t(sVirtualSounds.size()) - 1; s >= 0; --s)
+    {
+        SoundWave* soundWave = sVirtualSounds[s].mSoundWave.Get<SoundWave>();
+
+        if (soundWave && soundWave->GetName() == name)
+        {
+            RemoveVirtualSound(uint32_t(s));
+        }
+    }
+
     for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
     {
         SoundWave* soundWave = sAudioSources[i].mSoundWave.Get<SoundWave>();
@@ -581,6 +935,8 @@ void AudioManager::StopSound(const std::string& name)
 
 void AudioManager::StopAllSounds()
 {
+    sVirtualSounds.clear();
+
     for (uint32_t i = 0; i < MAX_AUDIO_SOURCES; ++i)
     {
         if (sAudioSources[i].mSoundWave.Get() != nullptr)
@@ -605,11 +961,25 @@ bool AudioManager::IsSoundPlaying(SoundWave* soundWave)
                 break;
             }
         }
+
+        for (uint32_t s = 0; !playing && s < sVirtualSounds.size(); ++s)
+        {
+            if (sVirtualSounds[s].mSoundWave == soundWave)
+            {
+                // Virtual sounds are still playing, they just aren't audible at the moment.
+                playing = true;
+            }
+        }
     }
 
     return playing;
 }
 
+uint32_t AudioManager::GetNumVirtualSounds()
+{
+    return uint32_t(sVirtualSounds.size());
+}
+
 static void RefreshAudioVolume()
 {
     // Refresh volume for 2D sounds (3D sounds will naturally adjust their volume on Update()).
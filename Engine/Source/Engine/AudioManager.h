@@ -46,6 +46,7 @@ public:
     static void StopAllSounds();
 
     static bool IsSoundPlaying(SoundWave* soundWave);
+    static uint32_t GetNumVirtualSounds();
 
     static void SetAudioClassVolume(int8_t audioClass, float volume);
     static void SetAudioClassPitch(int8_t audioClass, float pitch);
@@ -0,0 +1,353 @@
+#include "AudioStream.h"
+#include "Assets/SoundWave.h"
+#include "Log.h"
+
+#include "System/System.h"
+
+static ThreadObject* sDecodeThread = nullptr;
+static MutexObject* sMutex = nullptr;
+static SemaphoreObject* sWorkSemaphore = nullptr;
+static SemaphoreObject* sDecodeDoneSemaphore = nullptr;
+static bool sWaitingForDecode = false;
+static std::vector<AudioStream*> sStreams;
+static uint32_t sNextStream = 0;
+static bool sRunning = false;
+
+ThreadFuncRet AudioStream::DecodeThreadFunc(void* arg)
+{
+    while (true)
+    {
+        AudioStream* stream = nullptr;
+        AudioStreamSlot* slot = nullptr;
+
+        SYS_LockMutex(sMutex);
+
+        if (!sRunning)
+        {
+            SYS_UnlockMutex(sMutex);
+            break;
+        }
+
+        // Round-robin between streams so a single stream can't starve the others.
+        for (uint32_t i = 0; i < sStreams.size(); ++i)
+        {
+            AudioStream* candidate = sStreams[(sNextStream + i) % sStreams.size()];
+
+            if (!candidate->mEndOfStream &&
+                candidate->mSlots[candidate->mDecodeSlot].mState == AudioStreamSlotState::Empty)
+            {
+                stream = candidate;
+                slot = &candidate->mSlots[candidate->mDecodeSlot];
+                stream->mDecoding = true;
+                sNextStream = (sNextStream + i + 1) % sStreams.size();
+                break;
+            }
+        }
+
+        SYS_UnlockMutex(sMutex);
+
+        if (stream != nullptr)
+        {
+            // An Empty slot isn't touched by the main thread, so it can be filled without the lock.
+            bool endOfStream = false;
+            stream->DecodeSlot(*slot, endOfStream);
+
+            SCOPED_LOCK(sMutex);
+
+            if (slot->mSize > 0)
+            {
+                slot->mState = AudioStreamSlotState::Ready;
+                stream->mDecodeSlot = (stream->mDecodeSlot + 1) % AUDIO_STREAM_BUFFERS;
+            }
+
+            stream->mEndOfStream = endOfStream;
+            stream->mDecoding = false;
+
+            if (sWaitingForDecode)
+            {
+                SYS_SignalSemaphore(sDecodeDoneSemaphore);
+            }
+        }
+        else
+        {
+            // Nothing to decode until a stream is created, a slot finishes playing, or we shut down.
+            SYS_WaitSemaphore(sWorkSemaphore);
+        }
+    }
+
+    THREAD_RETURN();
+}
+
+void AudioStream::Initialize()
+{
+    OCT_ASSERT(sDecodeThread == nullptr);
+
+    sMutex = SYS_CreateMutex();
+    sWorkSemaphore = SYS_CreateSemaphore(0);
+    sDecodeDoneSemaphore = SYS_CreateSemaphore(0);
+    sRunning = true;
+    sDecodeThread = SYS_CreateThread(DecodeThreadFunc, nullptr);
+}
+
+void AudioStream::Shutdown()
+{
+    if (sDecodeThread == nullptr)
+        return;
+
+    SYS_LockMutex(sMutex);
+    sRunning = false;
+    SYS_UnlockMutex(sMutex);
+
+    SYS_SignalSemaphore(sWorkSemaphore);
+    SYS_JoinThread(sDecodeThread);
+    SYS_DestroyThread(sDecodeThread);
+    sDecodeThread = nullptr;
+
+    if (sStreams.size() > 0)
+    {
+        LogWarning("%d audio streams were not destroyed before shutdown", int32_t(sStreams.size()));
+
+        for (uint32_t i = 0; i < sStreams.size(); ++i)
+        {
+            delete sStreams[i];
+        }
+
+        sStreams.clear();
+    }
+
+    SYS_DestroySemaphore(sWorkSemaphore);
+    sWorkSemaphore = nullptr;
+    SYS_DestroySemaphore(sDecodeDoneSemaphore);
+    sDecodeDoneSemaphore = nullptr;
+
+    SYS_DestroyMutex(sMutex);
+    sMutex = nullptr;
+}
+
+AudioStream* AudioStream::Create(SoundWave* soundWave, bool loop, float startTime)
+{
+    OCT_ASSERT(soundWave != nullptr && soundWave->IsStreaming());
+
+    if (sDecodeThread == nullptr)
+    {
+        LogError("AudioStream::Create() called before AudioStream::Initialize()");
+        return nullptr;
+    }
+
+    uint32_t numChannels = soundWave->GetNumChannels();
+    uint32_t sampleRate = soundWave->GetSampleRate();
+    uint32_t rateScale = 1;
+
+#if AUDIO_STREAM_44100_ONLY
+    if (sampleRate == 22050)
+    {
+        rateScale = 2;
+    }
+    else if (sampleRate != 44100)
+    {
+        LogWarning("Cannot stream sound %s with sample rate %d", soundWave->GetName().c_str(), sampleRate);
+        return nullptr;
+    }
+#endif
+
+    VorbisStream* decoder = AUD_OpenVorbisStream(soundWave->GetCompressedData(), soundWave->GetCompressedSize());
+
+    if (decoder == nullptr)
+    {
+        return nullptr;
+    }
+
+    uint32_t startFrame = uint32_t(glm::max(startTime, 0.0f) * sampleRate);
+
+    if (startFrame > 0 &&
+        !AUD_SeekVorbisStream(decoder, startFrame))
+    {
+        LogWarning("Failed to seek audio stream %s", soundWave->GetName().c_str());
+    }
+
+    AudioStream* stream = new AudioStream();
+    stream->mDecoder = decoder;
+    stream->mLoop = loop;
+    stream->mSourceChannels = numChannels;
+    stream->mRateScale = rateScale;
+    stream->mFormat.mBytesPerSample = 2;
+    stream->mFormat.mNumChannels = AUDIO_STREAM_STEREO_ONLY ? 2 : numChannels;
+    stream->mFormat.mSampleRate = sampleRate * rateScale;
+
+    for (uint32_t i = 0; i < AUDIO_STREAM_BUFFERS; ++i)
+    {
+        stream->mSlots[i].mData = AUD_AllocWaveBuffer(AUDIO_STREAM_BUFFER_SIZE);
+    }
+
+    {
+        SCOPED_LOCK(sMutex);
+        sStreams.push_back(stream);
+    }
+
+    SYS_SignalSemaphore(sWorkSemaphore);
+
+    return stream;
+}
+
+void AudioStream::Destroy(AudioStream* stream)
+{
+    if (stream == nullptr)
+        return;
+
+    while (true)
+    {
+        SYS_LockMutex(sMutex);
+
+        if (!stream->mDecoding)
+        {
+            for (uint32_t i = 0; i < sStreams.size(); ++i)
+            {
+                if (sStreams[i] == stream)
+                {
+                    sStreams.erase(sStreams.begin() + i);
+                    break;
+                }
+            }
+
+            sWaitingForDecode = false;
+            SYS_UnlockMutex(sMutex);
+            break;
+        }
+
+        sWaitingForDecode = true;
+        SYS_UnlockMutex(sMutex);
+
+        // The decoder reads from the SoundWave's data, so let the current buffer finish.
+        // The decode thread signals after every buffer, which may belong to another stream.
+        SYS_WaitSemaphore(sDecodeDoneSemaphore);
+    }
+
+    delete stream;
+}
+
+AudioStream::~AudioStream()
+{
+    AUD_CloseVorbisStream(mDecoder);
+    mDecoder = nullptr;
+
+    for (uint32_t i = 0; i < AUDIO_STREAM_BUFFERS; ++i)
+    {
+        AUD_FreeWaveBuffer(mSlots[i].mData);
+        mSlots[i].mData = nullptr;
+    }
+}
+
+void AudioStream::Update(uint32_t voiceIndex)
+{
+    SCOPED_LOCK(sMutex);
+
+    // Voices play their buffers in order, so anything no longer queued has finished.
+    uint32_t numPending = AUD_GetNumQueuedStreamBuffers(voiceIndex);
+
+    if (mNumQueued > numPending)
+    {
+        // Freed slots are new work for the decode thread.
+        SYS_SignalSemaphore(sWorkSemaphore);
+    }
+
+    while (mNumQueued > numPending)
+    {
+        mSlots[mPlaySlot].mState = AudioStreamSlotState::Empty;
+        mPlaySlot = (mPlaySlot + 1) % AUDIO_STREAM_BUFFERS;
+        --mNumQueued;
+    }
+
+    while (mSlots[mQueueSlot].mState == AudioStreamSlotState::Ready)
+    {
+        AudioStreamSlot& slot = mSlots[mQueueSlot];
+
+        if (!AUD_QueueStreamBuffer(voiceIndex, slot.mData, slot.mSize))
+        {
+            // Voice can't accept another buffer yet. Try again next frame.
+            break;
+        }
+
+        slot.mState = AudioStreamSlotState::Queued;
+        mQueueSlot = (mQueueSlot + 1) % AUDIO_STREAM_BUFFERS;
+        ++mNumQueued;
+    }
+}
+
+bool AudioStream::IsFinished() const
+{
+    SCOPED_LOCK(sMutex);
+
+    bool finished = mEndOfStream && !mDecoding;
+
+    for (uint32_t i = 0; finished && i < AUDIO_STREAM_BUFFERS; ++i)
+    {
+        finished = (mSlots[i].mState == AudioStreamSlotState::Empty);
+    }
+
+    return finished;
+}
+
+PcmFormat AudioStream::GetFormat() const
+{
+    return mFormat;
+}
+
+void AudioStream::DecodeSlot(AudioStreamSlot& slot, bool& outEndOfStream)
+{
+    uint32_t outChannels = mFormat.mNumChannels;
+    uint32_t scale = (outChannels / mSourceChannels) * mRateScale;
+    uint32_t frameSize = mSourceChannels * sizeof(int16_t);
+    uint32_t srcCapacity = ((AUDIO_STREAM_BUFFER_SIZE / scale) / frameSize) * frameSize;
+
+    uint32_t srcSize = 0;
+    bool rewound = false;
+
+    while (srcSize < srcCapacity)
+    {
+        uint32_t bytes = AUD_ReadVorbisStream(mDecoder, slot.mData + srcSize, srcCapacity - srcSize);
+
+        if (bytes > 0)
+        {
+            srcSize += bytes;
+            rewound = false;
+        }
+        else if (mLoop && !rewound && AUD_SeekVorbisStream(mDecoder, 0))
+        {
+            // Guard against spinning on a stream that decodes nothing.
+            rewound = true;
+        }
+        else
+        {
+            outEndOfStream = true;
+            break;
+        }
+    }
+
+    uint32_t numFrames = srcSize / frameSize;
+
+    if (scale > 1)
+    {
+        // Expand to the voice format in place. Working backwards never overwrites unread samples.
+        int16_t* samples = (int16_t*)slot.mData;
+
+        for (int32_t f = int32_t(numFrames) - 1; f >= 0; --f)
+        {
+            for (int32_t r = int32_t(mRateScale) - 1; r >= 0; --r)
+            {
+                for (int32_t c = int32_t(outChannels) - 1; c >= 0; --c)
+                {
+                    uint32_t srcChannel = (mSourceChannels == 1) ? 0 : c;
+                    samples[(f * mRateScale + r) * outChannels + c] = samples[f * mSourceChannels + srcChannel];
+                }
+            }
+        }
+    }
+
+    // DMA based voices want buffers in 32 byte multiples. Pad the tail with silence.
+    uint32_t size = srcSize * scale;
+    uint32_t paddedSize = (size + 31) & ~31;
+    OCT_ASSERT(paddedSize <= AUDIO_STREAM_BUFFER_SIZE);
+    memset(slot.mData + size, 0, paddedSize - size);
+
+    slot.mSize = paddedSize;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "EngineTypes.h"
+#include "System/SystemTypes.h"
+
+#include "Audio/Audio.h"
+#include "Audio/AudioConstants.h"
+
+#include <vector>
+
+class SoundWave;
+
+enum class AudioStreamSlotState : uint8_t
+{
+    Empty,
+    Ready,
+    Queued,
+
+    Count
+};
+
+struct AudioStreamSlot
+{
+    uint8_t* mData = nullptr;
+    uint32_t mSize = 0;
+    AudioStreamSlotState mState = AudioStreamSlotState::Empty;
+};
+
+// Plays a compressed SoundWave without decoding it up front. A background thread decodes
+// the resident Ogg data a few buffers ahead of the voice, and Update() hands the decoded
+// buffers to the platform voice on the main thread.
+class AudioStream
+{
+public:
+
+    static void Initialize();
+    static void Shutdown();
+
+    static AudioStream* Create(SoundWave* soundWave, bool loop, float startTime);
+
+    // The voice must be stopped before destroying the stream it was playing.
+    static void Destroy(AudioStream* stream);
+
+    void Update(uint32_t voiceIndex);
+    bool IsFinished() const;
+    PcmFormat GetFormat() const;
+
+protected:
+
+    AudioStream() {}
+    ~AudioStream();
+
+    static ThreadFuncRet DecodeThreadFunc(void* arg);
+
+    void DecodeSlot(AudioStreamSlot& slot, bool& outEndOfStream);
+
+    VorbisStream* mDecoder = nullptr;
+    PcmFormat mFormat;
+    uint32_t mSourceChannels = 1;
+    uint32_t mRateScale = 1;
+
+    // Slots are filled, queued and played in ring order.
+    AudioStreamSlot mSlots[AUDIO_STREAM_BUFFERS];
+    uint32_t mDecodeSlot = 0;
+    uint32_t mQueueSlot = 0;
+    uint32_t mPlaySlot = 0;
+    uint32_t mNumQueued = 0;
+
+    bool mLoop = false;
+    bool mEndOfStream = false;
+    bool mDecoding = false;
+};
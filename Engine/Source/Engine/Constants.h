@@ -17,12 +17,21 @@
 
 #define DEFAULT_TEXTURE_SIZE 4
 #define MATERIAL_LITE_MAX_TEXTURES 4
-#define MAX_LIGHTS_PER_FRAME 32
+#define MAX_LIGHTS_PER_FRAME 128
 #define MAX_LIGHTS_PER_DRAW 8
+#define LIGHT_GRID_X 16
+#define LIGHT_GRID_Y 8
+#define LIGHT_GRID_Z 16
 #define MAX_BONE_INFLUENCES 4
 #define MAX_BONES 128
 #define MAX_UV_MAPS 2
+#define MAX_MESH_LODS 4
+#define DEFAULT_IMPORT_MESH_LODS 2
+#define MESH_LOD_HYSTERESIS 0.1f
 #define LIGHT_BAKE_SCALE 4.0f
+#define MAX_FIXED_TICKS_PER_FRAME 4
+#define DEFAULT_SERVER_TICK_RATE 30.0f
+#define QUERY_BATCH_GRAIN_SIZE 64
 
 #define DEFAULT_AMBIENT_LIGHT_COLOR glm::vec4(0.1f, 0.1f, 0.1f, 1.0f)
 #define DEFAULT_SHADOW_COLOR glm::vec4(0.0f, 0.0f, 0.0f, 0.8f)
@@ -48,6 +48,7 @@ static EngineConfig sEngineConfig;
 
 static std::vector<World*> sWorlds;
 static Clock sClock;
+static uint64_t sNextServerTickUs = 0;
 
 void ForceLinkage()
 {
@@ -141,6 +142,34 @@ void ReadCommandLineArgs(int32_t argc, char** argv)
             sEngineConfig.mValidateGraphics = (validate != 0);
             ++i;
         }
+        else if (strcmp(argv[i], "-asyncPipelines") == 0)
+        {
+            OCT_ASSERT(i + 1 < argc);
+            int32_t asyncPipelines = atoi(argv[i + 1]);
+            sEngineConfig.mAsyncPipelines = (asyncPipelines != 0);
+            ++i;
+        }
+        else if (strcmp(argv[i], "-assetBudget") == 0)
+        {
+            OCT_ASSERT(i + 1 < argc);
+            int32_t assetBudget = atoi(argv[i + 1]);
+            sEngineConfig.mAssetMemoryBudget = uint32_t(glm::max(assetBudget, 0));
+            ++i;
+        }
+        else if (strcmp(argv[i], "-multithreadedPhysics") == 0)
+        {
+            sEngineConfig.mMultithreadedPhysics = true;
+        }
+        else if (strcmp(argv[i], "-fixedTickRate") == 0)
+        {
+            OCT_ASSERT(i + 1 < argc);
+            sEngineConfig.mFixedTickRate = glm::max(float(atof(argv[i + 1])), 0.0f);
+            ++i;
+        }
+        else if (strcmp(argv[i], "-dedicated") == 0)
+        {
+            sEngineConfig.mDedicatedServer = true;
+        }
         else if (strcmp(argv[i], "-packageForSteam"))
         {
             sEngineConfig.mPackageForSteam = true;
@@ -163,6 +192,39 @@ bool Initialize(InitOptions& initOptions)
         initOptions.mHeight = sEngineConfig.mWindowHeight;
     }
 
+    if (sEngineConfig.mAssetMemoryBudget > 0)
+    {
+        initOptions.mAssetMemoryBudget = sEngineConfig.mAssetMemoryBudget;
+    }
+
+    if (sEngineConfig.mMultithreadedPhysics)
+    {
+        initOptions.mMultithreadedPhysics = true;
+    }
+
+    if (sEngineConfig.mFixedTickRate > 0.0f)
+    {
+        initOptions.mFixedTickRate = sEngineConfig.mFixedTickRate;
+    }
+
+    if (sEngineConfig.mDedicatedServer)
+    {
+        initOptions.mDedicatedServer = true;
+    }
+
+#if DEDICATED_SERVER
+    initOptions.mDedicatedServer = true;
+#elif EDITOR
+    initOptions.mDedicatedServer = false;
+#endif
+
+    if (initOptions.mDedicatedServer &&
+        initOptions.mFixedTickRate <= 0.0f)
+    {
+        // Nothing is presented, so there is no vsync to pace the loop. Always run servers at a fixed rate.
+        initOptions.mFixedTickRate = DEFAULT_SERVER_TICK_RATE;
+    }
+
     if (GetPlatform() == Platform::Android ||
         GetPlatform() == Platform::GameCube ||
         GetPlatform() == Platform::Wii ||
@@ -197,6 +259,8 @@ bool Initialize(InitOptions& initOptions)
     sEngineState.mProjectName = (initOptions.mProjectName != "") ? initOptions.mProjectName : DEFAULT_GAME_NAME;
     sEngineState.mGameCode = initOptions.mGameCode;
     sEngineState.mVersion = initOptions.mVersion;
+    sEngineState.mDedicatedServer = initOptions.mDedicatedServer;
+    sEngineState.mServerTickRate = initOptions.mDedicatedServer ? initOptions.mFixedTickRate : 0.0f;
 
     {
         SCOPED_STAT("SYS_Initialize");
@@ -209,6 +273,7 @@ bool Initialize(InitOptions& initOptions)
     }
 
     AssetManager::Get()->Initialize();
+    AssetManager::Get()->SetMemoryBudget(uint64_t(initOptions.mAssetMemoryBudget) * 1024 * 1024);
 
     if (sEngineConfig.mProjectPath != "")
     {
@@ -234,7 +299,14 @@ bool Initialize(InitOptions& initOptions)
     if (GetEngineState()->mProjectDirectory != "" &&
         initOptions.mUseAssetRegistry)
     {
-        AssetManager::Get()->DiscoverAssetRegistry((GetEngineState()->mProjectDirectory + "AssetRegistry.txt").c_str());
+        // Prefer the single-file asset pack. Fall back to the registry of loose .oct files.
+        std::string packPath = GetEngineState()->mProjectDirectory + ASSET_PACK_FILENAME;
+
+        if (!SYS_DoesFileExist(packPath.c_str(), true) ||
+            !AssetManager::Get()->DiscoverAssetPack(packPath.c_str()))
+        {
+            AssetManager::Get()->DiscoverAssetRegistry((GetEngineState()->mProjectDirectory + "AssetRegistry.txt").c_str());
+        }
     }
 #endif
 
@@ -260,6 +332,7 @@ bool Initialize(InitOptions& initOptions)
     }
 #endif
 
+    if (!GFX_IsHeadless())
     {
         SCOPED_STAT("GFX_Initialize");
         GFX_Initialize();
@@ -268,9 +341,11 @@ bool Initialize(InitOptions& initOptions)
         SCOPED_STAT("INP_Initialize");
         INP_Initialize();
     }
+    if (!IsDedicatedServer())
     {
         SCOPED_STAT("AUD_Initialize");
         AUD_Initialize();
+        AudioManager::Initialize();
     }
     {
         SCOPED_STAT("NET_Initialize");
@@ -289,6 +364,16 @@ bool Initialize(InitOptions& initOptions)
     sWorlds.push_back(new World());
 #endif
 
+    for (uint32_t i = 0; i < sWorlds.size(); ++i)
+    {
+        if (initOptions.mMultithreadedPhysics)
+        {
+            sWorlds[i]->EnableMultithreadedPhysics(true);
+        }
+
+        sWorlds[i]->SetFixedTickRate(initOptions.mFixedTickRate);
+    }
+
 
     Maths::SeedRand((uint32_t)SYS_GetTimeMicroseconds());
 
@@ -339,6 +424,26 @@ bool Initialize(InitOptions& initOptions)
     return true;
 }
 
+static void WaitForNextServerTick()
+{
+    uint64_t tickUs = uint64_t(1000000.0f / sEngineState.mServerTickRate);
+    uint64_t nowUs = SYS_GetTimeMicroseconds();
+
+    if (sNextServerTickUs == 0 ||
+        nowUs > sNextServerTickUs + tickUs)
+    {
+        // First tick, or more than a whole tick behind. Don't try to catch up.
+        sNextServerTickUs = nowUs;
+    }
+
+    sNextServerTickUs += tickUs;
+
+    if (sNextServerTickUs > nowUs)
+    {
+        SYS_Sleep(uint32_t((sNextServerTickUs - nowUs) / 1000));
+    }
+}
+
 bool Update()
 {
     if (sEngineState.mSuspended)
@@ -351,6 +456,7 @@ bool Update()
 
     BEGIN_FRAME_STAT("Frame");
 
+    if (!IsDedicatedServer())
     {
         SCOPED_FRAME_STAT("Audio");
         AUD_Update();
@@ -365,7 +471,11 @@ bool Update()
     }
 
     sClock.Update();
-    AudioManager::Update(sClock.DeltaTime());
+
+    if (!IsDedicatedServer())
+    {
+        AudioManager::Update(sClock.DeltaTime());
+    }
 
     NetworkManager::Get()->PreTickUpdate(sClock.DeltaTime());
 
@@ -409,7 +519,10 @@ bool Update()
         sWorlds[i]->Update(gameDeltaTime);
     }
 
-    TextField::StaticUpdate();
+    if (!IsDedicatedServer())
+    {
+        TextField::StaticUpdate();
+    }
 
     NetworkManager::Get()->PostTickUpdate(realDeltaTime);
 
@@ -417,9 +530,12 @@ bool Update()
     EditorImguiDraw();
 #endif
 
-    for (int32_t i = 0; i < int32_t(sWorlds.size()); ++i)
+    if (!IsDedicatedServer())
     {
-        Renderer::Get()->Render(sWorlds[i], i);
+        for (int32_t i = 0; i < int32_t(sWorlds.size()); ++i)
+        {
+            Renderer::Get()->Render(sWorlds[i], i);
+        }
     }
 
     AssetManager::Get()->Update(realDeltaTime);
@@ -433,6 +549,12 @@ bool Update()
         sEngineState.mFrameStep = false;
     }
 
+    if (IsDedicatedServer())
+    {
+        // Nothing is presented, so sleep off the rest of the tick instead of waiting on vsync.
+        WaitForNextServerTick();
+    }
+
     return !sEngineState.mQuit;
 }
 
@@ -448,6 +570,7 @@ void Shutdown()
     }
 
     sWorlds.clear();
+    World::ShutdownPhysicsThreads();
 
 #if LUA_ENABLED
     lua_close(sEngineState.mLua);
@@ -462,10 +585,24 @@ void Shutdown()
     Renderer::Destroy();
     AssetManager::Destroy();
 
+    if (!IsDedicatedServer())
+    {
+        AudioManager::Shutdown();
+    }
+
     NET_Shutdown();
-    AUD_Shutdown();
+
+    if (!IsDedicatedServer())
+    {
+        AUD_Shutdown();
+    }
     INP_Shutdown();
-    GFX_Shutdown();
+
+    if (!GFX_IsHeadless())
+    {
+        GFX_Shutdown();
+    }
+
     SYS_Shutdown();
 
 #if EDITOR
@@ -649,6 +786,15 @@ bool IsGameTickEnabled()
 #endif
 }
 
+bool IsDedicatedServer()
+{
+#if DEDICATED_SERVER
+    return true;
+#else
+    return sEngineState.mDedicatedServer;
+#endif
+}
+
 void ReloadAllScripts(bool restartComponents)
 {
 #if LUA_ENABLED
@@ -42,6 +42,10 @@ bool IsPlaying();
 
 bool IsGameTickEnabled();
 
+// True when running headless as a dedicated server (DEDICATED_SERVER build or -dedicated).
+// Rendering, audio and widget updates are skipped, but nodes still tick and replicate.
+bool IsDedicatedServer();
+
 void ReloadAllScripts(bool restartComponents = true);
 
 void SetPaused(bool paused);
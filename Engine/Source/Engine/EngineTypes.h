@@ -39,6 +39,7 @@ class btRigidBody;
 class btCollisionShape;
 class btBvhTriangleMeshShape;
 class btTriangleIndexVertexArray;
+class btOptimizedBvh;
 struct btTriangleInfoMap;
 
 enum class CollisionShape : uint32_t
@@ -248,6 +249,10 @@ struct InitOptions
     uint32_t mGameCode = 0;
     uint32_t mVersion = 0;
     std::string mDefaultScene;
+    uint32_t mAssetMemoryBudget = 0; // MB, 0 = unlimited
+    bool mMultithreadedPhysics = false;
+    float mFixedTickRate = 0.0f; // Hz, 0 = step physics with the frame delta
+    bool mDedicatedServer = false; // No rendering, audio or UI. Forced on by DEDICATED_SERVER builds.
 };
 
 struct EngineConfig
@@ -264,8 +269,13 @@ struct EngineConfig
     int32_t mWindowWidth = 0;
     int32_t mWindowHeight = 0;
     bool mValidateGraphics = false;
+    bool mAsyncPipelines = true;
     bool mFullscreen = false;
     bool mPackageForSteam = false;
+    uint32_t mAssetMemoryBudget = 0;
+    bool mMultithreadedPhysics = false;
+    float mFixedTickRate = 0.0f;
+    bool mDedicatedServer = false;
 };
 
 enum class ConsoleMode
@@ -309,6 +319,8 @@ struct EngineState
     bool mQuit = false;
     bool mWindowMinimized = false;
     bool mStandalone = false;
+    bool mDedicatedServer = false;
+    float mServerTickRate = 0.0f;
 
     SystemState mSystem;
     GraphicsState mGraphics;
@@ -336,6 +348,19 @@ struct RayTestMultiResult
     std::vector<float> mHitFractions;
 };
 
+struct RayTestQuery
+{
+    glm::vec3 mStart = {};
+    glm::vec3 mEnd = {};
+};
+
+struct SweepTestQuery
+{
+    glm::vec3 mStart = {};
+    glm::vec3 mEnd = {};
+    glm::quat mRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+};
+
 struct SweepTestResult
 {
     glm::vec3 mStart = {};
@@ -466,6 +491,15 @@ enum class ReplicationRate : uint8_t
     Count
 };
 
+enum class TickGroup : uint8_t
+{
+    PrePhysics,
+    PostPhysics,
+    Late,
+
+    Count
+};
+
 enum class Platform
 {
     Windows,
@@ -0,0 +1,272 @@
+#include "LightGrid.h"
+#include "Constants.h"
+#include "Profiler.h"
+
+#include "Nodes/3D/Camera3d.h"
+
+static const uint32_t kNumClusters = LIGHT_GRID_X * LIGHT_GRID_Y * LIGHT_GRID_Z;
+
+void LightGrid::Build(const std::vector<LightData>& lights, Camera3D* camera)
+{
+    SCOPED_FRAME_STAT("LightGrid");
+
+    Clear();
+
+    // Only the lights that are uploaded for the frame can be referenced by draws.
+    mNumLights = glm::min<uint32_t>(uint32_t(lights.size()), MAX_LIGHTS_PER_FRAME);
+
+    if (camera == nullptr)
+        return;
+
+    mViewMatrix = camera->GetViewMatrix();
+    mNearZ = camera->GetNearZ();
+    mFarZ = camera->GetFarZ();
+    mOrtho = (camera->GetProjectionMode() == ProjectionMode::ORTHOGRAPHIC);
+
+    if (mOrtho)
+    {
+        mTanHalfX = camera->GetOrthoWidth();
+        mTanHalfY = camera->GetOrthoHeight();
+        mSliceScale = (mFarZ > mNearZ) ? (LIGHT_GRID_Z / (mFarZ - mNearZ)) : 0.0f;
+    }
+    else
+    {
+        mTanHalfY = tanf(camera->GetFieldOfViewY() * DEGREES_TO_RADIANS * 0.5f);
+        mTanHalfX = mTanHalfY * camera->GetAspectRatio();
+        mSliceScale = (mNearZ > 0.0f && mFarZ > mNearZ) ? (LIGHT_GRID_Z / logf(mFarZ / mNearZ)) : 0.0f;
+    }
+
+    if (mSliceScale <= 0.0f ||
+        mTanHalfX <= 0.0f ||
+        mTanHalfY <= 0.0f)
+    {
+        return;
+    }
+
+    mLightRanges.resize(mNumLights);
+    mLightStamps.resize(mNumLights, 0);
+    mClusterOffsets.resize(kNumClusters + 1, 0);
+
+    // Pass 1 - Find the cluster range of each light and count entries per cluster.
+    for (uint32_t i = 0; i < mNumLights; ++i)
+    {
+        const LightData& light = lights[i];
+        ClusterRange& range = mLightRanges[i];
+
+        if (light.mType == LightType::Directional)
+        {
+            mDirectionalLights.push_back(i);
+            range.mMinX = 1;
+            range.mMaxX = 0;
+            continue;
+        }
+
+        if (!ComputeClusterRange(light.mPosition, light.mRadius, range))
+        {
+            // Light is outside of the view volume, mark the range as empty.
+            range.mMinX = 1;
+            range.mMaxX = 0;
+            continue;
+        }
+
+        for (uint32_t z = range.mMinZ; z <= range.mMaxZ; ++z)
+        {
+            for (uint32_t y = range.mMinY; y <= range.mMaxY; ++y)
+            {
+                for (uint32_t x = range.mMinX; x <= range.mMaxX; ++x)
+                {
+                    mClusterOffsets[GetClusterIndex(x, y, z) + 1]++;
+                }
+            }
+        }
+    }
+
+    // Pass 2 - Prefix sum the counts into offsets.
+    for (uint32_t c = 0; c < kNumClusters; ++c)
+    {
+        mClusterOffsets[c + 1] += mClusterOffsets[c];
+    }
+
+    mClusterLights.resize(mClusterOffsets[kNumClusters]);
+
+    // Pass 3 - Scatter light indices into their clusters.
+    std::vector<uint32_t> writePos(mClusterOffsets.begin(), mClusterOffsets.end() - 1);
+
+    for (uint32_t i = 0; i < mNumLights; ++i)
+    {
+        const ClusterRange& range = mLightRanges[i];
+
+        if (range.mMinX > range.mMaxX)
+            continue;
+
+        for (uint32_t z = range.mMinZ; z <= range.mMaxZ; ++z)
+        {
+            for (uint32_t y = range.mMinY; y <= range.mMaxY; ++y)
+            {
+                for (uint32_t x = range.mMinX; x <= range.mMaxX; ++x)
+                {
+                    uint32_t cluster = GetClusterIndex(x, y, z);
+                    mClusterLights[writePos[cluster]++] = uint16_t(i);
+                }
+            }
+        }
+    }
+
+    mValid = true;
+}
+
+void LightGrid::Clear()
+{
+    mValid = false;
+    mNumLights = 0;
+    mStamp = 0;
+    mDirectionalLights.clear();
+    mClusterOffsets.clear();
+    mClusterLights.clear();
+    mLightRanges.clear();
+    mLightStamps.clear();
+}
+
+void LightGrid::GatherLights(const Bounds& bounds, std::vector<uint32_t>& outIndices)
+{
+    ClusterRange range;
+
+    if (!mValid ||
+        !ComputeClusterRange(bounds.mCenter, bounds.mRadius, range))
+    {
+        // Not covered by the grid (or no grid this frame). Consider every light.
+        for (uint32_t i = 0; i < mNumLights; ++i)
+        {
+            outIndices.push_back(i);
+        }
+        return;
+    }
+
+    outIndices.insert(outIndices.end(), mDirectionalLights.begin(), mDirectionalLights.end());
+
+    // A light can be binned into many of the touched clusters. Stamp lights as they are
+    // added so each one is only returned once.
+    ++mStamp;
+    if (mStamp == 0)
+    {
+        std::fill(mLightStamps.begin(), mLightStamps.end(), 0);
+        mStamp = 1;
+    }
+
+    for (uint32_t z = range.mMinZ; z <= range.mMaxZ; ++z)
+    {
+        for (uint32_t y = range.mMinY; y <= range.mMaxY; ++y)
+        {
+            for (uint32_t x = range.mMinX; x <= range.mMaxX; ++x)
+            {
+                uint32_t cluster = GetClusterIndex(x, y, z);
+                uint32_t start = mClusterOffsets[cluster];
+                uint32_t end = mClusterOffsets[cluster + 1];
+
+                for (uint32_t e = start; e < end; ++e)
+                {
+                    uint32_t lightIndex = mClusterLights[e];
+
+                    if (mLightStamps[lightIndex] != mStamp)
+                    {
+                        mLightStamps[lightIndex] = mStamp;
+                        outIndices.push_back(lightIndex);
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool LightGrid::IsValid() const
+{
+    return mValid;
+}
+
+uint32_t LightGrid::GetNumLights() const
+{
+    return mNumLights;
+}
+
+uint32_t LightGrid::GetNumClusterEntries() const
+{
+    return uint32_t(mClusterLights.size());
+}
+
+bool LightGrid::ComputeClusterRange(glm::vec3 worldCenter, float radius, ClusterRange& outRange) const
+{
+    glm::vec3 viewPos = glm::vec3(mViewMatrix * glm::vec4(worldCenter, 1.0f));
+    float depth = -viewPos.z;
+
+    float minDepth = glm::max(depth - radius, mNearZ);
+    float maxDepth = glm::min(depth + radius, mFarZ);
+
+    if (minDepth > maxDepth)
+    {
+        return false;
+    }
+
+    // Screen-space extents of the sphere's view-space bounding box. For perspective, x/z over the box
+    // reaches its extremes at the min/max depth, so checking both ends is conservative.
+    float minX, maxX, minY, maxY;
+
+    if (mOrtho)
+    {
+        minX = (viewPos.x - radius) / mTanHalfX;
+        maxX = (viewPos.x + radius) / mTanHalfX;
+        minY = (viewPos.y - radius) / mTanHalfY;
+        maxY = (viewPos.y + radius) / mTanHalfY;
+    }
+    else
+    {
+        float invNearX = 1.0f / (minDepth * mTanHalfX);
+        float invFarX = 1.0f / (maxDepth * mTanHalfX);
+        float invNearY = 1.0f / (minDepth * mTanHalfY);
+        float invFarY = 1.0f / (maxDepth * mTanHalfY);
+
+        float lowX = viewPos.x - radius;
+        float highX = viewPos.x + radius;
+        float lowY = viewPos.y - radius;
+        float highY = viewPos.y + radius;
+
+        minX = glm::min(lowX * invNearX, lowX * invFarX);
+        maxX = glm::max(highX * invNearX, highX * invFarX);
+        minY = glm::min(lowY * invNearY, lowY * invFarY);
+        maxY = glm::max(highY * invNearY, highY * invFarY);
+    }
+
+    if (maxX < -1.0f || minX > 1.0f ||
+        maxY < -1.0f || minY > 1.0f)
+    {
+        return false;
+    }
+
+    outRange.mMinX = GetTile(minX, LIGHT_GRID_X);
+    outRange.mMaxX = GetTile(maxX, LIGHT_GRID_X);
+    outRange.mMinY = GetTile(minY, LIGHT_GRID_Y);
+    outRange.mMaxY = GetTile(maxY, LIGHT_GRID_Y);
+    outRange.mMinZ = GetSlice(minDepth);
+    outRange.mMaxZ = GetSlice(maxDepth);
+
+    return true;
+}
+
+uint32_t LightGrid::GetSlice(float depth) const
+{
+    float slice = mOrtho ?
+        ((depth - mNearZ) * mSliceScale) :
+        (logf(glm::max(depth, mNearZ) / mNearZ) * mSliceScale);
+
+    return uint32_t(glm::clamp(slice, 0.0f, float(LIGHT_GRID_Z - 1)));
+}
+
+uint32_t LightGrid::GetTile(float ndc, uint32_t numTiles) const
+{
+    float tile = (ndc * 0.5f + 0.5f) * numTiles;
+    return uint32_t(glm::clamp(tile, 0.0f, float(numTiles - 1)));
+}
+
+uint32_t LightGrid::GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) const
+{
+    return x + LIGHT_GRID_X * (y + LIGHT_GRID_Y * z);
+}
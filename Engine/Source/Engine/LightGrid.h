@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+
+#include "EngineTypes.h"
+#include "Maths.h"
+
+class Camera3D;
+
+// View-space cluster (froxel) grid used to bin local lights each frame.
+// X/Y tiles are uniform in screen space. Z slices are exponential in view depth
+// (linear for orthographic cameras) so that near slices stay thin.
+class LightGrid
+{
+public:
+
+    void Build(const std::vector<LightData>& lights, Camera3D* camera);
+    void Clear();
+
+    // Appends the indices of every light that may affect the given world-space bounds.
+    // Directional lights are always included. Indices refer to the light array passed to Build().
+    void GatherLights(const Bounds& bounds, std::vector<uint32_t>& outIndices);
+
+    bool IsValid() const;
+    uint32_t GetNumLights() const;
+    uint32_t GetNumClusterEntries() const;
+
+protected:
+
+    struct ClusterRange
+    {
+        uint32_t mMinX = 0;
+        uint32_t mMaxX = 0;
+        uint32_t mMinY = 0;
+        uint32_t mMaxY = 0;
+        uint32_t mMinZ = 0;
+        uint32_t mMaxZ = 0;
+    };
+
+    bool ComputeClusterRange(glm::vec3 worldCenter, float radius, ClusterRange& outRange) const;
+    uint32_t GetSlice(float depth) const;
+    uint32_t GetTile(float ndc, uint32_t numTiles) const;
+    uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) const;
+
+    glm::mat4 mViewMatrix = glm::mat4(1);
+    float mNearZ = 0.0f;
+    float mFarZ = 0.0f;
+    float mTanHalfX = 1.0f;
+    float mTanHalfY = 1.0f;
+    float mSliceScale = 0.0f;
+    bool mOrtho = false;
+    bool mValid = false;
+
+    uint32_t mNumLights = 0;
+    std::vector<uint32_t> mDirectionalLights;
+
+    // Per-cluster light lists stored contiguously. Cluster i owns the entries
+    // in [mClusterOffsets[i], mClusterOffsets[i + 1]).
+    std::vector<uint32_t> mClusterOffsets;
+    std::vector<uint16_t> mClusterLights;
+
+    // Scratch data used while building and gathering.
+    std::vector<ClusterRange> mLightRanges;
+    std::vector<uint32_t> mLightStamps;
+    uint32_t mStamp = 0;
+};
@@ -264,6 +264,21 @@ glm::vec3 Maths::ExtractPosition(const glm::mat4& mat)
 #endif
 }
 
+glm::mat4 Maths::ComposeTransform(glm::vec3 position, glm::quat rotation, glm::vec3 scale)
+{
+    // Same result as translate(position) * toMat4(rotation) * scale(scale),
+    // but writes the columns directly instead of doing two full 4x4 multiplies.
+    glm::mat3 rotMat = glm::toMat3(rotation);
+
+    glm::mat4 ret;
+    ret[0] = glm::vec4(rotMat[0] * scale.x, 0.0f);
+    ret[1] = glm::vec4(rotMat[1] * scale.y, 0.0f);
+    ret[2] = glm::vec4(rotMat[2] * scale.z, 0.0f);
+    ret[3] = glm::vec4(position, 1.0f);
+
+    return ret;
+}
+
 glm::quat Maths::ExtractRotation(const glm::mat4& mat)
 {
 #if USE_GLM_MATRIX_DECOMPOSE_ROTATION
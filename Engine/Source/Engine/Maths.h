@@ -58,6 +58,7 @@ public:
     static glm::vec3 ExtractPosition(const glm::mat4& mat);
     static glm::quat ExtractRotation(const glm::mat4& mat);
     static glm::vec3 ExtractScale(const glm::mat4& mat);
+    static glm::mat4 ComposeTransform(glm::vec3 position, glm::quat rotation, glm::vec3 scale);
 
     static float RotateYawTowardDirection(float srcYaw, glm::vec3 dir, float speed, float deltaTime);
 
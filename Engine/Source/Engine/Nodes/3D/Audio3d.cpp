@@ -158,6 +158,11 @@ void Audio3D::EditorTick(float deltaTime)
     TickCommon(deltaTime);
 }
 
+bool Audio3D::NeedsTick() const
+{
+    return true;
+}
+
 void Audio3D::TickCommon(float deltaTime)
 {
     if (mPlaying)
@@ -22,6 +22,7 @@ public:
     virtual void Start() override;
     virtual void Tick(float deltaTime) override;
     virtual void EditorTick(float deltaTime) override;
+    virtual bool NeedsTick() const override;
 
     void SetSoundWave(SoundWave* soundWave);
     SoundWave* GetSoundWave();
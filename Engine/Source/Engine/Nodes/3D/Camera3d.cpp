@@ -126,9 +126,12 @@ void Camera3D::ComputeMatrices()
     mAspectRatio *= engineState->mAspectRatioScale;
 
     mViewMatrix = CalculateViewMatrix();
-    mViewMatrix = glm::toMat4(glm::conjugate(GetWorldRotationQuat()));
 
-    mViewMatrix = translate(mViewMatrix, -GetWorldPosition());
+    // Follow interpolated render transforms when the world runs a fixed tick rate.
+    glm::mat4 renderTransform = GetInterpolatedTransform();
+    mViewMatrix = glm::toMat4(glm::conjugate(Maths::ExtractRotation(renderTransform)));
+
+    mViewMatrix = translate(mViewMatrix, -Maths::ExtractPosition(renderTransform));
 
     if (mProjectionMode == ProjectionMode::ORTHOGRAPHIC)
     {
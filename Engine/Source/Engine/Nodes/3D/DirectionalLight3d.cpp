@@ -34,6 +34,11 @@ void DirectionalLight3D::EditorTick(float deltaTime)
     TickCommon(deltaTime);
 }
 
+bool DirectionalLight3D::NeedsTick() const
+{
+    return true;
+}
+
 void DirectionalLight3D::TickCommon(float deltaTime)
 {
     GenerateViewProjectionMatrix();
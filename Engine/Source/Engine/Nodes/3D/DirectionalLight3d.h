@@ -15,6 +15,7 @@ public:
 
     virtual void Tick(float deltaTime) override;
     virtual void EditorTick(float deltaTime) override;
+    virtual bool NeedsTick() const override;
 
     virtual const char* GetTypeName() const override;
     virtual void GatherProperties(std::vector<Property>& outProps) override;
@@ -1,9 +1,64 @@
 #include "Nodes/3D/InstancedMesh3d.h"
 #include "Assets/StaticMesh.h"
+#include "CameraFrustum.h"
+#include "World.h"
+
+#if EDITOR
+#include "EditorState.h"
+#endif
+
+#include <algorithm>
+#include <unordered_map>
 
 FORCE_LINK_DEF(InstancedMesh3D);
 DEFINE_NODE(InstancedMesh3D, StaticMesh3D);
 
+static Bounds MergeBounds(const Bounds& a, const Bounds& b)
+{
+    glm::vec3 delta = b.mCenter - a.mCenter;
+    float dist = glm::length(delta);
+
+    if (dist + b.mRadius <= a.mRadius)
+    {
+        return a;
+    }
+
+    if (dist + a.mRadius <= b.mRadius)
+    {
+        return b;
+    }
+
+    Bounds retBounds;
+    retBounds.mRadius = (dist + a.mRadius + b.mRadius) * 0.5f;
+    retBounds.mCenter = a.mCenter + delta * ((retBounds.mRadius - a.mRadius) / dist);
+    return retBounds;
+}
+
+// Appended instances go into overflow chunks until this many exist, then the chunks are rebuilt.
+#define MAX_OVERFLOW_CHUNKS 64
+
+static uint64_t CellKey(glm::ivec2 cell)
+{
+    return (uint64_t(uint32_t(cell.x)) << 32) | uint64_t(uint32_t(cell.y));
+}
+
+bool InstancedMesh3D::HandlePropChange(Datum* datum, uint32_t index, const void* newValue)
+{
+    Property* prop = static_cast<Property*>(datum);
+    OCT_ASSERT(prop != nullptr);
+    InstancedMesh3D* instMesh = static_cast<InstancedMesh3D*>(prop->mOwner);
+    bool success = false;
+
+    if (prop->mName == "Chunk Size")
+    {
+        instMesh->mChunkSize = glm::max(*(float*)newValue, 0.01f);
+        instMesh->MarkInstanceLayoutDirty();
+        success = true;
+    }
+
+    return success;
+}
+
 InstancedMesh3D::InstancedMesh3D()
 {
     mName = "Instanced Mesh";
@@ -26,6 +81,7 @@ void InstancedMesh3D::GatherProperties(std::vector<Property>& outProps)
     outProps.push_back(Property(DatumType::Float, "Unrolled Cull Distance", this, &mUnrolledCullDistance));
     outProps.push_back(Property(DatumType::Float, "Unrolled Cell Size", this, &mUnrolledCellSize));
     outProps.push_back(Property(DatumType::Bool, "Always Unroll", this, &mAlwaysUnroll));
+    outProps.push_back(Property(DatumType::Float, "Chunk Size", this, &mChunkSize, 1, HandlePropChange));
 }
 
 void InstancedMesh3D::Create()
@@ -42,6 +98,11 @@ void InstancedMesh3D::Render()
 {
     if (!mUnrolled)
     {
+        if (IsInstanceDataDirty())
+        {
+            UpdateInstanceData();
+        }
+
         GFX_DrawInstancedMeshComp(this);
     }
 }
@@ -60,6 +121,11 @@ void InstancedMesh3D::EditorTick(float deltaTime)
     UpdateInstanceData();
 }
 
+bool InstancedMesh3D::NeedsTick() const
+{
+    return true;
+}
+
 void InstancedMesh3D::SaveStream(Stream& stream, Platform platform)
 {
     StaticMesh3D::SaveStream(stream, platform);
@@ -86,6 +152,8 @@ void InstancedMesh3D::LoadStream(Stream& stream, Platform platform, uint32_t ver
         mInstanceData[i].mScale = stream.ReadVec3();
     }
 
+    MarkInstanceDataDirty();
+
     if (ShouldUnroll())
     {
         Unroll();
@@ -108,7 +176,7 @@ void InstancedMesh3D::SetStaticMesh(StaticMesh* staticMesh)
 
 Bounds InstancedMesh3D::GetLocalBounds() const
 {
-    if (mInstanceDataDirty)
+    if (IsInstanceDataDirty())
     {
         const_cast<InstancedMesh3D*>(this)->UpdateInstanceData();
     }
@@ -144,7 +212,7 @@ void InstancedMesh3D::SetInstanceData(int32_t index, const MeshInstanceData& dat
         index < int32_t(mInstanceData.size()))
     {
         mInstanceData[index] = data;
-        MarkInstanceDataDirty();
+        MarkInstanceDirty(index);
     }
 }
 
@@ -156,9 +224,12 @@ void InstancedMesh3D::SetInstanceData(const std::vector<MeshInstanceData>& data)
 
 void InstancedMesh3D::AddInstanceData(const MeshInstanceData& data, int32_t index)
 {
-    if (index < 0)
+    if (index < 0 ||
+        index == int32_t(mInstanceData.size()))
     {
+        // Appending leaves every existing instance in place, so collision and chunks can be extended instead of rebuilt.
         mInstanceData.push_back(data);
+        MarkInstanceLayoutDirty();
     }
     else
     {
@@ -171,18 +242,19 @@ void InstancedMesh3D::AddInstanceData(const MeshInstanceData& data, int32_t inde
         {
             LogError("Out of bounds insertion index in AddInstanceData");
         }
+
+        MarkInstanceDataDirty();
     }
-    
-    MarkInstanceDataDirty();
 }
 
 void InstancedMesh3D::RemoveInstanceData(int32_t index)
 {
-    if (index == -1 &&
+    if ((index == -1 || index == int32_t(mInstanceData.size()) - 1) &&
         mInstanceData.size() > 0)
     {
         mInstanceData.pop_back();
-        MarkInstanceDataDirty();
+        mNumUnchangedInstances = glm::min(mNumUnchangedInstances, uint32_t(mInstanceData.size()));
+        MarkInstanceLayoutDirty();
     }
     else if (index >= 0 && index < int32_t(mInstanceData.size()))
     {
@@ -203,25 +275,78 @@ uint32_t InstancedMesh3D::GetTotalVertexCount() const
 
 bool InstancedMesh3D::IsInstanceDataDirty() const
 {
-    return mInstanceDataDirty;
+    return mInstanceDataDirty || mInstanceLayoutDirty || mDirtyInstances.size() > 0;
 }
 
 void InstancedMesh3D::MarkInstanceDataDirty()
 {
     mInstanceDataDirty = true;
-    mInstancedMeshResource.mDirty = true;
+    mDirtyInstances.clear();
+}
+
+void InstancedMesh3D::MarkInstanceDirty(int32_t index)
+{
+    if (!mInstanceDataDirty)
+    {
+        mDirtyInstances.push_back(index);
+    }
+}
+
+void InstancedMesh3D::MarkInstanceLayoutDirty()
+{
+    mInstanceLayoutDirty = true;
+}
+
+void InstancedMesh3D::MarkInstanceSlotDirty(uint32_t slot)
+{
+    InstancedMeshCompResource* resource = &mInstancedMeshResource;
+
+    if (resource->mDirtyStart >= resource->mDirtyEnd)
+    {
+        resource->mDirtyStart = slot;
+        resource->mDirtyEnd = slot + 1;
+    }
+    else
+    {
+        resource->mDirtyStart = glm::min(resource->mDirtyStart, slot);
+        resource->mDirtyEnd = glm::max(resource->mDirtyEnd, slot + 1);
+    }
 }
 
 void InstancedMesh3D::UpdateInstanceData()
 {
+    if (!IsInstanceDataDirty())
+    {
+        return;
+    }
+
     if (mInstanceDataDirty)
     {
         RecreateCollisionShape();
-        CalculateLocalBounds();
+        RebuildChunks();
+    }
+    else
+    {
+        if (!UpdateCollisionShape())
+        {
+            RecreateCollisionShape();
+        }
 
-        mInstanceDataDirty = false;
-        mInstanceDataUpdatedThisFrame = true;
+        if (!UpdateChunks())
+        {
+            RebuildChunks();
+        }
     }
+
+    mDirtyInstances.clear();
+    mNumUnchangedInstances = uint32_t(mInstanceData.size());
+    mInstanceDataDirty = false;
+    mInstanceLayoutDirty = false;
+    mInstanceDataUpdatedThisFrame = true;
+
+#if EDITOR
+    GetEditorState()->HandleNodeChanged(this);
+#endif
 }
 
 bool InstancedMesh3D::WasInstanceDataUpdatedThisFrame() const
@@ -256,6 +381,132 @@ bool InstancedMesh3D::ShouldUnroll() const
     return true;
 }
 
+void InstancedMesh3D::UpdateVisibleChunks(const CameraFrustum* frustum, glm::vec3 cameraPos)
+{
+    mVisibleRanges.clear();
+
+    glm::mat4 transform = GetRenderTransform();
+    glm::vec3 scale = GetWorldScale();
+    float maxScale = glm::max(glm::max(scale.x, scale.y), scale.z);
+
+    float cullDist = GetCullDistance();
+    float cullDist2 = cullDist * cullDist;
+
+    for (uint32_t i = 0; i < mChunks.size(); ++i)
+    {
+        const InstanceChunk& chunk = mChunks[i];
+        glm::vec3 center = transform * glm::vec4(chunk.mBounds.mCenter, 1.0f);
+        float radius = chunk.mBounds.mRadius * maxScale;
+
+        bool visible = true;
+
+        if (cullDist > 0.0f &&
+            glm::distance2(cameraPos, center) > cullDist2)
+        {
+            visible = false;
+        }
+
+        if (visible && frustum != nullptr)
+        {
+            visible = frustum->mOrtho ?
+                frustum->IsSphereInFrustumOrtho(center, radius) :
+                frustum->IsSphereInFrustum(center, radius);
+        }
+
+        if (visible)
+        {
+            // Chunks are laid out back to back, so neighboring visible chunks share one draw.
+            if (mVisibleRanges.size() > 0 &&
+                mVisibleRanges.back().mStart + mVisibleRanges.back().mCount == chunk.mStart)
+            {
+                mVisibleRanges.back().mCount += chunk.mCount;
+            }
+            else
+            {
+                mVisibleRanges.push_back({ chunk.mStart, chunk.mCount });
+            }
+        }
+    }
+}
+
+const std::vector<InstanceChunk>& InstancedMesh3D::GetInstanceChunks() const
+{
+    return mChunks;
+}
+
+const std::vector<InstanceDrawRange>& InstancedMesh3D::GetVisibleInstanceRanges() const
+{
+    return mVisibleRanges;
+}
+
+const std::vector<uint32_t>& InstancedMesh3D::GetInstanceDrawOrder() const
+{
+    return mDrawOrder;
+}
+
+void InstancedMesh3D::GatherInstancesNear(glm::vec3 position, float radius, std::vector<int32_t>& outInstances) const
+{
+    if (mChunks.size() == 0)
+    {
+        return;
+    }
+
+    glm::ivec2 minCell = glm::ivec2(glm::floor((glm::vec2(position.x, position.z) - radius) / mChunkSize));
+    glm::ivec2 maxCell = glm::ivec2(glm::floor((glm::vec2(position.x, position.z) + radius) / mChunkSize));
+
+    auto addChunk = [&](const InstanceChunk& chunk)
+    {
+        for (uint32_t s = chunk.mStart; s < chunk.mStart + chunk.mCount; ++s)
+        {
+            outInstances.push_back(int32_t(mDrawOrder[s]));
+        }
+    };
+
+    if (int64_t(maxCell.y) - minCell.y >= int64_t(mChunks.size()))
+    {
+        // More rows than chunks, just check them all.
+        for (const InstanceChunk& chunk : mChunks)
+        {
+            if (glm::all(glm::greaterThanEqual(chunk.mCell, minCell)) &&
+                glm::all(glm::lessThanEqual(chunk.mCell, maxCell)))
+            {
+                addChunk(chunk);
+            }
+        }
+
+        return;
+    }
+
+    // Rebuilt chunks are sorted by cell (rows along Z), so each row is one binary search.
+    auto sortedEnd = mChunks.begin() + mNumSortedChunks;
+
+    for (int32_t z = minCell.y; z <= maxCell.y; ++z)
+    {
+        auto it = std::lower_bound(mChunks.begin(), sortedEnd, glm::ivec2(minCell.x, z),
+            [](const InstanceChunk& chunk, const glm::ivec2& cell)
+            {
+                return (chunk.mCell.y != cell.y) ? (chunk.mCell.y < cell.y) : (chunk.mCell.x < cell.x);
+            });
+
+        for (; it != sortedEnd && it->mCell.y == z && it->mCell.x <= maxCell.x; ++it)
+        {
+            addChunk(*it);
+        }
+    }
+
+    // Overflow chunks from appends aren't sorted, but there are only a few of them.
+    for (uint32_t i = mNumSortedChunks; i < mChunks.size(); ++i)
+    {
+        const InstanceChunk& chunk = mChunks[i];
+
+        if (glm::all(glm::greaterThanEqual(chunk.mCell, minCell)) &&
+            glm::all(glm::lessThanEqual(chunk.mCell, maxCell)))
+        {
+            addChunk(chunk);
+        }
+    }
+}
+
 InstancedMeshCompResource* InstancedMesh3D::GetInstancedMeshResource()
 {
     return &mInstancedMeshResource;
@@ -359,29 +610,34 @@ btCompoundShape* InstancedMesh3D::GenerateTriangleCollisionShape()
 
         for (uint32_t i = 0; i < mInstanceData.size(); ++i)
         {
-            btTransform bTransform = CalculateInstanceBulletTransform(i);
-
-            // Instances can only have uniform scale for now (based on X component)
-            float scale = mInstanceData[i].mScale.x;
-            btVector3 btscale = btVector3(scale, scale, scale);
-
-            if (mUseTriangleCollision && staticMesh->GetTriangleCollisionShape())
-            {
-                btScaledBvhTriangleMeshShape* scaledTriangleShape = new btScaledBvhTriangleMeshShape(staticMesh->GetTriangleCollisionShape(), btscale);
-                compoundShape->addChildShape(bTransform, scaledTriangleShape);
-            }
-            else
-            {
-                btCollisionShape* newShape = CloneCollisionShape(staticMesh->GetCollisionShape());
-                newShape->setLocalScaling(btscale);
-                compoundShape->addChildShape(bTransform, newShape);
-            }
+            compoundShape->addChildShape(CalculateInstanceBulletTransform(i), CreateInstanceCollisionShape(i));
         }
     }
 
     return compoundShape;
 }
 
+btCollisionShape* InstancedMesh3D::CreateInstanceCollisionShape(int32_t instanceIndex)
+{
+    StaticMesh* staticMesh = mStaticMesh.Get<StaticMesh>();
+    OCT_ASSERT(staticMesh != nullptr);
+
+    // Instances can only have uniform scale for now (based on X component)
+    float scale = mInstanceData[instanceIndex].mScale.x;
+    btVector3 btscale = btVector3(scale, scale, scale);
+
+    if (mUseTriangleCollision && staticMesh->GetTriangleCollisionShape())
+    {
+        return new btScaledBvhTriangleMeshShape(staticMesh->GetTriangleCollisionShape(), btscale);
+    }
+    else
+    {
+        btCollisionShape* newShape = CloneCollisionShape(staticMesh->GetCollisionShape());
+        newShape->setLocalScaling(btscale);
+        return newShape;
+    }
+}
+
 void InstancedMesh3D::RecreateCollisionShape()
 {
     StaticMesh* staticMesh = mStaticMesh.Get<StaticMesh>();
@@ -400,46 +656,90 @@ void InstancedMesh3D::RecreateCollisionShape()
     }
 }
 
+bool InstancedMesh3D::UpdateCollisionShape()
+{
+    // Patches the compound shape built by GenerateTriangleCollisionShape() in place. Returns false
+    // when the shape has to be rebuilt instead.
+    StaticMesh* staticMesh = mStaticMesh.Get<StaticMesh>();
+
+    if (staticMesh == nullptr ||
+        mInstanceData.size() == 0 ||
+        mPhysicsEnabled ||
+        mCollisionShape == nullptr ||
+        mCollisionShape->getShapeType() != COMPOUND_SHAPE_PROXYTYPE)
+    {
+        return false;
+    }
+
+    if (!(mUseTriangleCollision && staticMesh->GetTriangleCollisionShape()) &&
+        !(!mUseTriangleCollision && staticMesh->GetCollisionShape()))
+    {
+        return false;
+    }
+
+    btCompoundShape* compoundShape = static_cast<btCompoundShape*>(mCollisionShape);
+    uint32_t numInstances = uint32_t(mInstanceData.size());
+    uint32_t numKept = glm::min(mNumUnchangedInstances, uint32_t(compoundShape->getNumChildShapes()));
+
+    // Drop children for instances that were popped off the end, then add children for new ones.
+    for (int32_t i = compoundShape->getNumChildShapes() - 1; i >= int32_t(numKept); --i)
+    {
+        btCollisionShape* childShape = compoundShape->getChildShape(i);
+        compoundShape->removeChildShapeByIndex(i);
+        DestroyCollisionShape(childShape);
+    }
+
+    for (uint32_t i = numKept; i < numInstances; ++i)
+    {
+        compoundShape->addChildShape(CalculateInstanceBulletTransform(i), CreateInstanceCollisionShape(i));
+    }
+
+    for (uint32_t i = 0; i < mDirtyInstances.size(); ++i)
+    {
+        int32_t index = mDirtyInstances[i];
+
+        if (index >= 0 && index < int32_t(numKept))
+        {
+            float scale = mInstanceData[index].mScale.x;
+            compoundShape->getChildShape(index)->setLocalScaling(btVector3(scale, scale, scale));
+            compoundShape->updateChildTransform(index, CalculateInstanceBulletTransform(index), false);
+        }
+    }
+
+    compoundShape->recalculateLocalAabb();
+
+    if (IsRigidBodyInWorld())
+    {
+        GetWorld()->GetDynamicsWorld()->updateSingleAabb(mRigidBody);
+    }
+
+    return true;
+}
+
 void InstancedMesh3D::CalculateLocalBounds()
 {
     StaticMesh* mesh = GetStaticMesh();
 
-    if (mesh != nullptr && mInstanceData.size() > 0)
+    if (mesh != nullptr && mChunks.size() > 0)
     {
-        // TODO: This algorithm can be improved.
-        Bounds meshBounds = mesh->GetBounds();
-
-        std::vector<glm::vec3> instBoundsCenters;
-        instBoundsCenters.resize(mInstanceData.size());
+        // Built from the chunk bounds so a single instance edit doesn't have to revisit every instance.
+        glm::vec3 minExt = mChunks[0].mBounds.mCenter;
+        glm::vec3 maxExt = minExt;
 
-        // Determine center position (every instance weighted equally)
-        glm::vec3 sumPosition = {};
-        for (uint32_t i = 0; i < mInstanceData.size(); ++i)
+        for (uint32_t i = 1; i < mChunks.size(); ++i)
         {
-            glm::mat4 transform = CalculateInstanceTransform(i);
-            instBoundsCenters[i] = transform * glm::vec4(meshBounds.mCenter, 1.0f);
-            sumPosition += instBoundsCenters[i];
+            minExt = glm::min(minExt, mChunks[i].mBounds.mCenter);
+            maxExt = glm::max(maxExt, mChunks[i].mBounds.mCenter);
         }
 
-        glm::vec3 centerPosition = sumPosition / float(mInstanceData.size());
+        glm::vec3 centerPosition = (minExt + maxExt) * 0.5f;
 
         // Determine farthest possible position from center
         float maxDistance = 0.0f;
-        for (uint32_t i = 0; i < mInstanceData.size(); ++i)
+        for (uint32_t i = 0; i < mChunks.size(); ++i)
         {
-            float distFromCenter = glm::distance(instBoundsCenters[i], centerPosition);
-
-            // Right now, we only use x component scale for a uniform scale factor, but I'm leaving this code 
-            // here for the future in case we allow non-uniform scale.
-            float maxScale = glm::max(mInstanceData[i].mScale.x, mInstanceData[i].mScale.y);
-            maxScale = glm::max(maxScale, mInstanceData[i].mScale.z);
-
-            distFromCenter += meshBounds.mRadius * maxScale;
-
-            if (distFromCenter > maxDistance)
-            {
-                maxDistance = distFromCenter;
-            }
+            float distFromCenter = glm::distance(mChunks[i].mBounds.mCenter, centerPosition) + mChunks[i].mBounds.mRadius;
+            maxDistance = glm::max(maxDistance, distFromCenter);
         }
 
         mBounds.mCenter = centerPosition;
@@ -452,6 +752,227 @@ void InstancedMesh3D::CalculateLocalBounds()
     }
 }
 
+glm::ivec2 InstancedMesh3D::CalculateInstanceCell(int32_t instanceIndex) const
+{
+    glm::vec3 pos = mInstanceData[instanceIndex].mPosition;
+    return glm::ivec2(
+        int32_t(glm::floor(pos.x / mChunkSize)),
+        int32_t(glm::floor(pos.z / mChunkSize)));
+}
+
+Bounds InstancedMesh3D::CalculateInstanceLocalBounds(int32_t instanceIndex, const Bounds& meshBounds)
+{
+    const MeshInstanceData& instData = mInstanceData[instanceIndex];
+
+    // Right now, we only use x component scale for a uniform scale factor, but I'm leaving this code 
+    // here for the future in case we allow non-uniform scale.
+    float maxScale = glm::max(instData.mScale.x, instData.mScale.y);
+    maxScale = glm::max(maxScale, instData.mScale.z);
+
+    Bounds retBounds;
+    retBounds.mCenter = CalculateInstanceTransform(instanceIndex) * glm::vec4(meshBounds.mCenter, 1.0f);
+    retBounds.mRadius = meshBounds.mRadius * maxScale;
+    return retBounds;
+}
+
+void InstancedMesh3D::RebuildChunks()
+{
+    uint32_t numInstances = uint32_t(mInstanceData.size());
+
+    mChunks.clear();
+    mInstanceChunks.resize(numInstances);
+    mInstanceSlots.resize(numInstances);
+    mDrawOrder.resize(numInstances);
+
+    // Bucket the instances by grid cell
+    std::unordered_map<uint64_t, uint32_t> cellChunks;
+    for (uint32_t i = 0; i < numInstances; ++i)
+    {
+        glm::ivec2 cell = CalculateInstanceCell(i);
+        auto it = cellChunks.find(CellKey(cell));
+
+        if (it == cellChunks.end())
+        {
+            it = cellChunks.insert({ CellKey(cell), uint32_t(mChunks.size()) }).first;
+            mChunks.push_back(InstanceChunk());
+            mChunks.back().mCell = cell;
+        }
+
+        mInstanceChunks[i] = it->second;
+        mChunks[it->second].mCount++;
+    }
+
+    // Sort chunks by cell (rows along Z) so neighboring visible chunks are more likely to merge into one draw.
+    std::vector<uint32_t> chunkOrder(mChunks.size());
+    for (uint32_t i = 0; i < chunkOrder.size(); ++i)
+    {
+        chunkOrder[i] = i;
+    }
+
+    std::sort(chunkOrder.begin(), chunkOrder.end(), [&](uint32_t l, uint32_t r)
+        {
+            const glm::ivec2& lCell = mChunks[l].mCell;
+            const glm::ivec2& rCell = mChunks[r].mCell;
+            return (lCell.y != rCell.y) ? (lCell.y < rCell.y) : (lCell.x < rCell.x);
+        });
+
+    std::vector<InstanceChunk> sortedChunks(mChunks.size());
+    std::vector<uint32_t> chunkRemap(mChunks.size());
+    uint32_t start = 0;
+    for (uint32_t i = 0; i < chunkOrder.size(); ++i)
+    {
+        sortedChunks[i] = mChunks[chunkOrder[i]];
+        sortedChunks[i].mStart = start;
+        chunkRemap[chunkOrder[i]] = i;
+        start += sortedChunks[i].mCount;
+    }
+
+    mChunks.swap(sortedChunks);
+    mNumSortedChunks = uint32_t(mChunks.size());
+
+    // Assign each instance a draw slot inside its chunk
+    std::vector<uint32_t> chunkFill(mChunks.size());
+    for (uint32_t i = 0; i < mChunks.size(); ++i)
+    {
+        chunkFill[i] = mChunks[i].mStart;
+    }
+
+    for (uint32_t i = 0; i < numInstances; ++i)
+    {
+        uint32_t chunkIndex = chunkRemap[mInstanceChunks[i]];
+        uint32_t slot = chunkFill[chunkIndex]++;
+
+        mInstanceChunks[i] = chunkIndex;
+        mInstanceSlots[i] = slot;
+        mDrawOrder[slot] = i;
+    }
+
+    // Chunk bounds
+    StaticMesh* mesh = GetStaticMesh();
+    Bounds meshBounds = mesh ? mesh->GetBounds() : Bounds();
+
+    for (uint32_t c = 0; c < mChunks.size(); ++c)
+    {
+        InstanceChunk& chunk = mChunks[c];
+        chunk.mBounds = CalculateInstanceLocalBounds(mDrawOrder[chunk.mStart], meshBounds);
+
+        for (uint32_t s = chunk.mStart + 1; s < chunk.mStart + chunk.mCount; ++s)
+        {
+            chunk.mBounds = MergeBounds(chunk.mBounds, CalculateInstanceLocalBounds(mDrawOrder[s], meshBounds));
+        }
+    }
+
+    CalculateLocalBounds();
+
+    // Everything is visible until the renderer culls it.
+    mVisibleRanges.clear();
+    if (numInstances > 0)
+    {
+        mVisibleRanges.push_back({ 0, numInstances });
+    }
+
+    mInstancedMeshResource.mDirty = true;
+}
+
+bool InstancedMesh3D::UpdateChunks()
+{
+    // Instances that stay in their cell are patched in place, and instances pushed onto or popped off
+    // the end of the instance array are added to or trimmed from the end of the slot range. Returns false
+    // when that isn't possible, in which case the chunks need to be rebuilt.
+    StaticMesh* mesh = GetStaticMesh();
+    Bounds meshBounds = mesh ? mesh->GetBounds() : Bounds();
+    uint32_t numInstances = uint32_t(mInstanceData.size());
+
+    // Like UpdateCollisionShape(), compare against the instances left untouched rather than the old count.
+    // A pop followed by a push in the same frame keeps the count but replaces the last instance.
+    uint32_t numKept = glm::min(mNumUnchangedInstances, uint32_t(mInstanceChunks.size()));
+
+    // Popped instances can only be trimmed while they occupy the last slot (e.g. undoing an append).
+    while (mInstanceChunks.size() > numKept)
+    {
+        uint32_t index = uint32_t(mInstanceChunks.size()) - 1;
+        uint32_t slot = mInstanceSlots[index];
+
+        if (slot + 1 != mDrawOrder.size())
+        {
+            return false;
+        }
+
+        // The chunk holding the last slot is always the last chunk.
+        OCT_ASSERT(mInstanceChunks[index] == mChunks.size() - 1);
+        mChunks.back().mCount--;
+
+        if (mChunks.back().mCount == 0)
+        {
+            mChunks.pop_back();
+            mNumSortedChunks = glm::min(mNumSortedChunks, uint32_t(mChunks.size()));
+        }
+
+        mInstanceChunks.pop_back();
+        mInstanceSlots.pop_back();
+        mDrawOrder.pop_back();
+    }
+
+    // Appended instances take the next slot, extending the last chunk if it covers the same cell.
+    for (uint32_t i = uint32_t(mInstanceChunks.size()); i < numInstances; ++i)
+    {
+        glm::ivec2 cell = CalculateInstanceCell(i);
+        Bounds instBounds = CalculateInstanceLocalBounds(i, meshBounds);
+        uint32_t slot = uint32_t(mDrawOrder.size());
+
+        if (mChunks.size() > 0 &&
+            mChunks.back().mCell == cell)
+        {
+            mChunks.back().mBounds = MergeBounds(mChunks.back().mBounds, instBounds);
+            mChunks.back().mCount++;
+        }
+        else
+        {
+            if (mChunks.size() - mNumSortedChunks >= MAX_OVERFLOW_CHUNKS)
+            {
+                return false;
+            }
+
+            InstanceChunk chunk;
+            chunk.mBounds = instBounds;
+            chunk.mCell = cell;
+            chunk.mStart = slot;
+            chunk.mCount = 1;
+            mChunks.push_back(chunk);
+        }
+
+        mInstanceChunks.push_back(uint32_t(mChunks.size()) - 1);
+        mInstanceSlots.push_back(slot);
+        mDrawOrder.push_back(i);
+        MarkInstanceSlotDirty(slot);
+    }
+
+    for (uint32_t i = 0; i < mDirtyInstances.size(); ++i)
+    {
+        int32_t index = mDirtyInstances[i];
+
+        if (index < 0 || index >= int32_t(mInstanceChunks.size()))
+        {
+            continue;
+        }
+
+        InstanceChunk& chunk = mChunks[mInstanceChunks[index]];
+
+        if (CalculateInstanceCell(index) != chunk.mCell)
+        {
+            return false;
+        }
+
+        // Chunk bounds only ever grow here. They get tightened the next time the chunks are rebuilt.
+        chunk.mBounds = MergeBounds(chunk.mBounds, CalculateInstanceLocalBounds(index, meshBounds));
+        MarkInstanceSlotDirty(mInstanceSlots[index]);
+    }
+
+    CalculateLocalBounds();
+
+    return true;
+}
+
 void InstancedMesh3D::Unroll()
 {
     if (!ShouldUnroll())
@@ -9,6 +9,25 @@ struct MeshInstanceData
     glm::vec3 mScale = {1.0f, 1.0f, 1.0f};
 };
 
+// Instances are grouped by the grid cell they sit in. Each chunk owns a contiguous range of draw slots
+// so visible chunks can be drawn with a handful of instanced draws. Chunks are stored in slot order:
+// the chunks from the last rebuild (sorted by cell), then overflow chunks for instances appended since.
+struct InstanceChunk
+{
+    Bounds mBounds;
+    glm::ivec2 mCell = {};
+    uint32_t mStart = 0;
+    uint32_t mCount = 0;
+};
+
+struct InstanceDrawRange
+{
+    uint32_t mStart = 0;
+    uint32_t mCount = 0;
+};
+
+class CameraFrustum;
+
 class InstancedMesh3D : public StaticMesh3D
 {
 public:
@@ -26,6 +45,7 @@ public:
     virtual void Render() override;
     virtual void Tick(float deltaTime) override;
     virtual void EditorTick(float deltaTime) override;
+    virtual bool NeedsTick() const override;
 
     virtual void SaveStream(Stream& stream, Platform platform) override;
     virtual void LoadStream(Stream& stream, Platform platform, uint32_t version) override;
@@ -55,6 +75,15 @@ public:
 
     bool ShouldUnroll() const;
 
+    void UpdateVisibleChunks(const CameraFrustum* frustum, glm::vec3 cameraPos);
+    const std::vector<InstanceChunk>& GetInstanceChunks() const;
+    const std::vector<InstanceDrawRange>& GetVisibleInstanceRanges() const;
+    const std::vector<uint32_t>& GetInstanceDrawOrder() const;
+
+    // Appends the instances in every chunk whose cell overlaps the circle (instance space, XZ only).
+    // Uses the chunks from the last UpdateInstanceData(), so callers do the exact test themselves.
+    void GatherInstancesNear(glm::vec3 position, float radius, std::vector<int32_t>& outInstances) const;
+
     InstancedMeshCompResource* GetInstancedMeshResource();
 
     btTransform CalculateInstanceBulletTransform(int32_t instanceIndex);
@@ -66,17 +95,40 @@ public:
 
 protected:
 
+    static bool HandlePropChange(Datum* datum, uint32_t index, const void* newValue);
+
     virtual void RecreateCollisionShape() override;
+    bool UpdateCollisionShape();
+    btCollisionShape* CreateInstanceCollisionShape(int32_t instanceIndex);
     void CalculateLocalBounds();
 
+    void MarkInstanceDirty(int32_t index);
+    void MarkInstanceLayoutDirty();
+    void MarkInstanceSlotDirty(uint32_t slot);
+    glm::ivec2 CalculateInstanceCell(int32_t instanceIndex) const;
+    Bounds CalculateInstanceLocalBounds(int32_t instanceIndex, const Bounds& meshBounds);
+    void RebuildChunks();
+    bool UpdateChunks();
+
     void Unroll();
 
     std::vector<MeshInstanceData> mInstanceData;
     float mUnrolledCullDistance = 0.0f;
     float mUnrolledCellSize = 25.0f;
     bool mAlwaysUnroll = false;
+    float mChunkSize = 25.0f;
+
+    std::vector<InstanceChunk> mChunks;
+    uint32_t mNumSortedChunks = 0;
+    std::vector<uint32_t> mInstanceChunks;
+    std::vector<uint32_t> mInstanceSlots;
+    std::vector<uint32_t> mDrawOrder;
+    std::vector<InstanceDrawRange> mVisibleRanges;
+    std::vector<int32_t> mDirtyInstances;
+    uint32_t mNumUnchangedInstances = 0;
 
     bool mInstanceDataDirty = true;
+    bool mInstanceLayoutDirty = false;
     bool mInstanceDataUpdatedThisFrame = false;
     bool mUnrolled = false;
     Bounds mBounds;
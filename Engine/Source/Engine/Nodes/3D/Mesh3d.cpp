@@ -134,7 +134,7 @@ glm::mat4 Mesh3D::GetRenderTransform()
     }
     else
     {
-        transform = GetTransform();
+        transform = GetInterpolatedTransform();
     }
     return transform;
 }
@@ -9,9 +9,15 @@
 
 #include "Nodes/3D/SkeletalMesh3d.h"
 
+#if EDITOR
+#include "EditorState.h"
+#endif
+
 FORCE_LINK_DEF(Node3D);
 DEFINE_NODE(Node3D, Node);
 
+uint32_t Node3D::sInterpolatedAncestorGen = 1;
+
 bool HandleTransformPropChange(Datum* datum, uint32_t index, const void* newValue)
 {
     Property* prop = static_cast<Property*>(datum);
@@ -34,6 +40,11 @@ bool HandleTransformPropChange(Datum* datum, uint32_t index, const void* newValu
         transformComp->SetScale(*((glm::vec3*)(newValue)));
         success = true;
     }
+    else if (prop->mName == "Interpolate")
+    {
+        transformComp->EnableTransformInterpolation(*((bool*)(newValue)));
+        success = true;
+    }
 
     transformComp->MarkTransformDirty();
 
@@ -123,6 +134,7 @@ void Node3D::GatherProperties(std::vector<Property>& outProps)
     outProps.push_back(Property(DatumType::Vector, "Position", this, &mPosition, 1, HandleTransformPropChange));
     outProps.push_back(Property(DatumType::Vector, "Rotation", this, &mRotationEuler, 1, HandleTransformPropChange));
     outProps.push_back(Property(DatumType::Vector, "Scale", this, &mScale, 1, HandleTransformPropChange));
+    outProps.push_back(Property(DatumType::Bool, "Interpolate", this, &mInterpolateTransform, 1, HandleTransformPropChange));
 }
 
 void Node3D::GatherReplicatedData(std::vector<NetDatum>& outData)
@@ -169,6 +181,17 @@ void Node3D::MarkTransformDirty()
 {
     mTransformDirty = true;
 
+    // Queue up in the world so that the transform pass only visits dirty nodes.
+    if (mWorld != nullptr &&
+        mTransformQueueIndex == -1)
+    {
+        mWorld->QueueTransformUpdate(this);
+    }
+
+#if EDITOR
+    GetEditorState()->HandleNodeChanged(this);
+#endif
+
     // TODO-NODE: Consider propogating this to children nodes. 
     // It looks like Godot does it this way, and might remove some one-frame-delay bugs.
 #if 0
@@ -187,6 +210,134 @@ bool Node3D::IsTransformDirty() const
     return mTransformDirty;
 }
 
+void Node3D::SetTransformQueueIndex(int32_t index)
+{
+    mTransformQueueIndex = index;
+}
+
+int32_t Node3D::GetTransformQueueIndex() const
+{
+    return mTransformQueueIndex;
+}
+
+void Node3D::EnableTransformInterpolation(bool enable)
+{
+    if (mInterpolateTransform != enable)
+    {
+        mInterpolateTransform = enable;
+
+        if (mWorld != nullptr)
+        {
+            if (enable)
+            {
+                mWorld->AddInterpolatedNode(this);
+            }
+            else
+            {
+                mWorld->RemoveInterpolatedNode(this);
+            }
+        }
+    }
+}
+
+bool Node3D::IsTransformInterpolationEnabled() const
+{
+    return mInterpolateTransform;
+}
+
+void Node3D::SetInterpolationIndex(int32_t index)
+{
+    if ((mInterpolationIndex == -1) != (index == -1))
+    {
+        InvalidateInterpolatedAncestors();
+    }
+
+    mInterpolationIndex = index;
+}
+
+void Node3D::InvalidateInterpolatedAncestors()
+{
+    // Cached interpolated ancestors are revalidated lazily in GetInterpolatedTransform().
+    sInterpolatedAncestorGen++;
+}
+
+int32_t Node3D::GetInterpolationIndex() const
+{
+    return mInterpolationIndex;
+}
+
+void Node3D::ResetTransformInterpolation()
+{
+    // Start from the current transform instead of blending from a stale one.
+    mFixedTransformSaved = false;
+}
+
+void Node3D::SaveFixedTransform()
+{
+    mFixedTransform = GetTransform();
+    mFixedTransformSaved = true;
+}
+
+void Node3D::UpdateInterpolatedTransform(float alpha)
+{
+    const glm::mat4& transform = GetTransform();
+
+    if (!mFixedTransformSaved)
+    {
+        mInterpolatedTransform = transform;
+        mInterpolationOffset = glm::mat4(1.0f);
+        return;
+    }
+
+    glm::vec3 position = glm::mix(Maths::ExtractPosition(mFixedTransform), Maths::ExtractPosition(transform), alpha);
+    glm::quat rotation = glm::slerp(Maths::ExtractRotation(mFixedTransform), Maths::ExtractRotation(transform), alpha);
+    glm::vec3 scale = glm::mix(Maths::ExtractScale(mFixedTransform), Maths::ExtractScale(transform), alpha);
+
+    mInterpolatedTransform = glm::translate(glm::mat4(1.0f), position);
+    mInterpolatedTransform *= glm::toMat4(rotation);
+    mInterpolatedTransform = glm::scale(mInterpolatedTransform, scale);
+
+    // Descendants apply this offset to their own transform, so the inverse is only taken once per frame.
+    mInterpolationOffset = mInterpolatedTransform * glm::inverse(transform);
+}
+
+glm::mat4 Node3D::GetInterpolatedTransform()
+{
+    if (mWorld == nullptr ||
+        !mWorld->IsFixedTickEnabled())
+    {
+        return GetTransform();
+    }
+
+    // Descendants follow the nearest interpolated ancestor so attached meshes don't lag behind it.
+    if (mInterpolatedAncestorGen != sInterpolatedAncestorGen)
+    {
+        mInterpolatedAncestor = nullptr;
+        mInterpolatedAncestorGen = sInterpolatedAncestorGen;
+
+        for (Node* node = this; node != nullptr; node = node->GetParent())
+        {
+            if (node->IsNode3D() &&
+                static_cast<Node3D*>(node)->mInterpolationIndex != -1)
+            {
+                mInterpolatedAncestor = static_cast<Node3D*>(node);
+                break;
+            }
+        }
+    }
+
+    if (mInterpolatedAncestor == nullptr)
+    {
+        return GetTransform();
+    }
+    else if (mInterpolatedAncestor == this)
+    {
+        return mInterpolatedTransform;
+    }
+
+    return mInterpolatedAncestor->mInterpolationOffset * GetTransform();
+}
+
 void Node3D::UpdateTransform(bool updateChildren)
 {
     // First we need to update parent transform if it's dirty.
@@ -200,9 +351,6 @@ void Node3D::UpdateTransform(bool updateChildren)
 
     if (mTransformDirty)
     {
-        // Update transform
-        mTransform = glm::mat4(1);
-
         // Force uniform scale if the component has children.
         // Non-uniform scale was causing problems for children components because shear was 
         // getting introduced into the child transforms if the parent had any rotation.
@@ -215,10 +363,8 @@ void Node3D::UpdateTransform(bool updateChildren)
         {
             scale = glm::vec3(mScale.x, mScale.x, mScale.x);
         }
-        
-        mTransform = glm::translate(mTransform, mPosition);
-        mTransform *= glm::toMat4(mRotationQuat);
-        mTransform = glm::scale(mTransform, scale);
+
+        mTransform = Maths::ComposeTransform(mPosition, mRotationQuat, scale);
 
         if (parent != nullptr)
         {
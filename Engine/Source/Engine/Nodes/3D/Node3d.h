@@ -33,8 +33,22 @@ public:
 
     void MarkTransformDirty();
     bool IsTransformDirty() const;
+    void SetTransformQueueIndex(int32_t index);
+    int32_t GetTransformQueueIndex() const;
     virtual void UpdateTransform(bool updateChildren);
 
+    // When the world runs a fixed tick rate, interpolated nodes (and their descendants) are
+    // rendered between their transforms from the last two fixed ticks.
+    void EnableTransformInterpolation(bool enable);
+    bool IsTransformInterpolationEnabled() const;
+    void SetInterpolationIndex(int32_t index);
+    int32_t GetInterpolationIndex() const;
+    void ResetTransformInterpolation();
+    void SaveFixedTransform();
+    void UpdateInterpolatedTransform(float alpha);
+    glm::mat4 GetInterpolatedTransform();
+    static void InvalidateInterpolatedAncestors();
+
     virtual void GatherProxyDraws(std::vector<DebugDraw>& inoutDraws);
 
     glm::vec3 GetPosition() const;
@@ -100,6 +114,18 @@ protected:
 
     glm::mat4 mTransform;
     int32_t mParentBoneIndex;
+    int32_t mTransformQueueIndex = -1;
+
+    static uint32_t sInterpolatedAncestorGen;
+
+    glm::mat4 mFixedTransform = glm::mat4(1.0f);
+    glm::mat4 mInterpolatedTransform = glm::mat4(1.0f);
+    glm::mat4 mInterpolationOffset = glm::mat4(1.0f);
+    Node3D* mInterpolatedAncestor = nullptr;
+    uint32_t mInterpolatedAncestorGen = 0;
+    int32_t mInterpolationIndex = -1;
+    bool mInterpolateTransform = false;
+    bool mFixedTransformSaved = false;
 
     bool mTransformDirty;
 };
\ No newline at end of file
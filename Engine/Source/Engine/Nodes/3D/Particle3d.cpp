@@ -127,7 +127,10 @@ void Particle3D::GatherProxyDraws(std::vector<DebugDraw>& inoutDraws)
 void Particle3D::Create()
 {
     Primitive3D::Create();
-    GFX_CreateParticleCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateParticleCompResource(this);
+    }
     EnableEmission(true);
 }
 
@@ -137,7 +140,10 @@ void Particle3D::Destroy()
     
     EnableEmission(false);
 
-    GFX_DestroyParticleCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyParticleCompResource(this);
+    }
 
     mParticles.clear();
     mParticles.shrink_to_fit();
@@ -189,6 +195,11 @@ void Particle3D::EditorTick(float deltaTime)
     TickCommon(deltaTime);
 }
 
+bool Particle3D::NeedsTick() const
+{
+    return true;
+}
+
 void Particle3D::TickCommon(float deltaTime)
 {
     mHasSimulatedThisFrame = false;
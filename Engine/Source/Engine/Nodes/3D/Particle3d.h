@@ -52,6 +52,7 @@ public:
     virtual void Render() override;
     virtual void Tick(float deltaTime) override;
     virtual void EditorTick(float deltaTime) override;
+    virtual bool NeedsTick() const override;
 
     virtual VertexType GetVertexType() const override;
 
@@ -28,6 +28,18 @@ static btEmptyShape* sEmptyCollisionShape = nullptr;
         }                                                                      \
     }
 
+void OctaveMotionState::setWorldTransform(const btTransform& transform)
+{
+    mInterpolatedTransform = transform;
+
+    if (!mWriteBackQueued &&
+        mOwner->GetWorld() != nullptr)
+    {
+        mWriteBackQueued = true;
+        mOwner->GetWorld()->QueuePhysicsWriteBack(mOwner);
+    }
+}
+
 bool Primitive3D::HandlePropChange(Datum* datum, uint32_t index, const void* newValue)
 {
     Property* prop = static_cast<Property*>(datum);
@@ -166,38 +178,18 @@ void Primitive3D::Tick(float deltaTime)
 
     bool gameTickEnabled = IsGameTickEnabled();
 
-    if (gameTickEnabled && mPhysicsEnabled)
+    // Transforms Bullet moved are written back by World::ApplyPhysicsWriteBacks() after each step.
+    if (gameTickEnabled && mPhysicsEnabled && mTransformDirty)
     {
-        if (mTransformDirty)
-        {
-            UpdateTransform(false);
-        }
-        else
-        {
-            // Sync the component transform with the physics transform
-            glm::vec3 worldScale = GetWorldScale();
-            glm::mat4 physTransform(1);
-
-            if (mPhysicsEnabled)
-            {
-                physTransform = mMotionState->GetTransform();
-            }
-            else
-            {
-                mRigidBody->getWorldTransform().getOpenGLMatrix(glm::value_ptr(physTransform));
-            }
-
-            physTransform = glm::scale(physTransform, worldScale);
-
-            // Do not call Primitive3D's SetTransform, because it will
-            // remove / add the rigidbody to the world, which will mess up its velocity/acceleration.
-            // In this case, we just want to update our position/rotation/scale from the new transform
-            // and also dirty child transforms.
-            Node3D::SetTransform(physTransform);
-        }
+        UpdateTransform(false);
     }
 }
 
+bool Primitive3D::NeedsTick() const
+{
+    return mPhysicsEnabled || Node3D::NeedsTick();
+}
+
 void Primitive3D::GatherProperties(std::vector<Property>& outProps)
 {
     Node3D::GatherProperties(outProps);
@@ -259,7 +251,7 @@ void Primitive3D::UpdateTransform(bool updateChildren)
     
     if (updateRigidBody)
     {
-        FullSyncRigidBodyTransform();
+        MoveRigidBody();
     }
 }
 
@@ -269,7 +261,7 @@ void Primitive3D::SetTransform(const glm::mat4& transform)
 
     if (IsRigidBodyInWorld())
     {
-        FullSyncRigidBodyTransform();
+        MoveRigidBody();
     }
 }
 
@@ -280,10 +272,18 @@ void Primitive3D::EnablePhysics(bool enable)
         EnableRigidBody(false);
         mPhysicsEnabled = enable;
 
+        if (GetWorld() != nullptr)
+        {
+            GetWorld()->UpdateTickRegistration(this);
+        }
+
         if (enable)
         {
             // Lazily allocate the motion state the first time physics is enabled.
-            mMotionState = new OctaveMotionState();
+            if (mMotionState == nullptr)
+            {
+                mMotionState = new OctaveMotionState(this);
+            }
 
             if (mRigidBody != nullptr)
             {
@@ -567,6 +567,39 @@ void Primitive3D::FullSyncRigidBodyTransform()
     dynamicsWorld->addRigidBody(mRigidBody, mCollisionGroup, mCollisionMask);
 }
 
+void Primitive3D::MoveRigidBody()
+{
+    // Teleport the body in place. Re-adding it to the world would destroy and recreate its broadphase proxy
+    // along with every overlapping pair. Group/mask and shape changes still go through EnableRigidBody().
+    btDynamicsWorld* dynamicsWorld = GetWorld()->GetDynamicsWorld();
+    SyncRigidBodyTransform();
+
+    // Otherwise the motion state is interpolated from the old position until the next simulation step.
+    mRigidBody->setInterpolationWorldTransform(mRigidBody->getWorldTransform());
+
+    // Static colliders stay asleep like they would after being re-added.
+    if (!mRigidBody->isStaticObject())
+    {
+        mRigidBody->activate(true);
+    }
+
+    dynamicsWorld->updateSingleAabb(mRigidBody);
+}
+
+void Primitive3D::ApplyPhysicsTransform()
+{
+    if (!mPhysicsEnabled || mMotionState == nullptr)
+        return;
+
+    glm::mat4 physTransform = mMotionState->GetTransform();
+    physTransform = glm::scale(physTransform, GetWorldScale());
+
+    // Do not call Primitive3D's SetTransform, because it would move the rigid body back
+    // to where it already is. We only want to update our position/rotation/scale from the
+    // new transform and dirty child transforms.
+    Node3D::SetTransform(physTransform);
+}
+
 void Primitive3D::SyncRigidBodyTransform()
 {
     if (GetWorld() != nullptr)
@@ -596,8 +629,9 @@ void Primitive3D::SyncRigidBodyTransform()
 
             if (mPhysicsEnabled)
             {
+                // Assign directly so the node doesn't queue a write-back of its own transform.
                 OCT_ASSERT(mMotionState != nullptr);
-                mMotionState->setWorldTransform(worldTransform);
+                mMotionState->mInterpolatedTransform = worldTransform;
             }
 
             mRigidBody->setWorldTransform(worldTransform);
@@ -718,6 +752,11 @@ btRigidBody* Primitive3D::GetRigidBody()
     return mRigidBody;
 }
 
+OctaveMotionState* Primitive3D::GetMotionState()
+{
+    return mMotionState;
+}
+
 btCollisionShape* Primitive3D::GetCollisionShape()
 {
     return mCollisionShape;
@@ -8,6 +8,8 @@
 
 #include <vector>
 
+class Primitive3D;
+
 //typedef void(*BeginOverlapHandlerFP)(Primitive3D* thisPrim, Primitive3D* otherPrim);
 //typedef void(*EndOverlapHandlerFP)(Primitive3D* thisPrim, Primitive3D* otherPrim);
 //typedef void(*CollisionHandlerFP)(Primitive3D* thisPrim, Primitive3D* otherPrim, btPersistentManifold* manifold);
@@ -15,11 +17,13 @@
 ATTRIBUTE_ALIGNED16(struct) OctaveMotionState : public btMotionState
 {
     btTransform mInterpolatedTransform;
-    //void* mUserPointer;
+    Primitive3D* mOwner = nullptr;
+    bool mWriteBackQueued = false;
 
     BT_DECLARE_ALIGNED_ALLOCATOR();
 
-    OctaveMotionState(glm::mat4 startTransform = glm::mat4(1))
+    OctaveMotionState(Primitive3D* owner, glm::mat4 startTransform = glm::mat4(1)) :
+        mOwner(owner)
     {
         mInterpolatedTransform.setFromOpenGLMatrix(glm::value_ptr(startTransform));
     }
@@ -29,10 +33,8 @@ ATTRIBUTE_ALIGNED16(struct) OctaveMotionState : public btMotionState
         transform = mInterpolatedTransform;
     }
 
-    virtual void setWorldTransform(const btTransform& transform) override
-    {
-        mInterpolatedTransform = transform;
-    }
+    // Only called by Bullet for bodies that aren't sleeping, so it also queues the owner's write-back.
+    virtual void setWorldTransform(const btTransform& transform) override;
 
     glm::mat4 GetTransform() const
     {
@@ -57,6 +59,7 @@ public:
     virtual const char* GetTypeName() const override;
     virtual bool IsPrimitive3D() const override;
     virtual void Tick(float deltaTime) override;
+    virtual bool NeedsTick() const override;
     virtual void GatherProperties(std::vector<Property>& outProps) override;
 
     virtual void SetWorld(World* world) override;
@@ -108,9 +111,12 @@ public:
     void AddImpulse(glm::vec3 impulse);
     void ClearForces();
 
+    // Removes and re-adds the rigid body. Prefer MoveRigidBody() when only the transform changed.
     void FullSyncRigidBodyTransform();
+    void MoveRigidBody();
 
     void SyncRigidBodyTransform();
+    void ApplyPhysicsTransform();
     void SyncRigidBodyMass();
     void SyncCollisionFlags();
 
@@ -129,6 +135,7 @@ public:
     virtual VertexType GetVertexType() const override;
 
     btRigidBody* GetRigidBody();
+    OctaveMotionState* GetMotionState();
     btCollisionShape* GetCollisionShape();
     void SetCollisionShape(btCollisionShape* newShape);
 
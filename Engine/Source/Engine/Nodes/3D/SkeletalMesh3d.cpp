@@ -112,7 +112,10 @@ void SkeletalMesh3D::GatherProperties(std::vector<Property>& outProps)
 void SkeletalMesh3D::Create()
 {
     Mesh3D::Create();
-    GFX_CreateSkeletalMeshCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateSkeletalMeshCompResource(this);
+    }
     SetSkeletalMesh(GetDefaultMesh());
 
     if (mDefaultAnimation != "")
@@ -124,7 +127,10 @@ void SkeletalMesh3D::Create()
 void SkeletalMesh3D::Destroy()
 {
     Mesh3D::Destroy();
-    GFX_DestroySkeletalMeshCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroySkeletalMeshCompResource(this);
+    }
 }
 
 SkeletalMeshCompResource* SkeletalMesh3D::GetResource()
@@ -144,6 +150,11 @@ void SkeletalMesh3D::EditorTick(float deltaTime)
     TickCommon(deltaTime);
 }
 
+bool SkeletalMesh3D::NeedsTick() const
+{
+    return true;
+}
+
 void SkeletalMesh3D::TickCommon(float deltaTime)
 {
     mHasAnimatedThisFrame = false;
@@ -167,7 +178,7 @@ void SkeletalMesh3D::SetSkeletalMesh(SkeletalMesh* skeletalMesh)
 
         if (skeletalMesh != nullptr)
         {
-            if (GFX_IsCpuSkinningRequired(this))
+            if (!GFX_IsHeadless() && GFX_IsCpuSkinningRequired(this))
             {
                 // Initialize skinned vertex array
                 mSkinnedVertices.resize(skeletalMesh->GetNumVertices());
@@ -1043,7 +1054,7 @@ void SkeletalMesh3D::UpdateAnimation(float deltaTime, bool updateBones)
 
             mesh->FinalizeBoneTransforms(mBoneMatrices);
 
-            if (GFX_IsCpuSkinningRequired(this))
+            if (!GFX_IsHeadless() && GFX_IsCpuSkinningRequired(this))
             {
                 CpuSkinVertices();
             }
@@ -1081,6 +1092,7 @@ void SkeletalMesh3D::UpdateAnimation(float deltaTime, bool updateBones)
     if (updateBones &&
         (inheritPose || mAnimationPaused) &&
         mesh != nullptr &&
+        !GFX_IsHeadless() &&
         GFX_IsCpuSkinningRequired(this))
     {
         CpuSkinVertices();
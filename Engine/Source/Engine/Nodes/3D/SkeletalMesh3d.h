@@ -65,6 +65,7 @@ public:
 
     virtual void Tick(float deltaTime) override;
     virtual void EditorTick(float deltaTime) override;
+    virtual bool NeedsTick() const override;
 
     virtual bool IsStaticMesh3D() const override;
     virtual bool IsSkeletalMesh3D() const override;
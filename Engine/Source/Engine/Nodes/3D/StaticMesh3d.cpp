@@ -8,6 +8,10 @@
 
 #include "Graphics/Graphics.h"
 
+#if EDITOR
+#include "EditorState.h"
+#endif
+
 #include <btBulletDynamicsCommon.h>
 
 FORCE_LINK_DEF(StaticMesh3D);
@@ -81,14 +85,20 @@ void StaticMesh3D::GatherProperties(std::vector<Property>& outProps)
 void StaticMesh3D::Create()
 {
     Mesh3D::Create();
-    GFX_CreateStaticMeshCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateStaticMeshCompResource(this);
+    }
     SetStaticMesh(GetDefaultMesh());
 }
 
 void StaticMesh3D::Destroy()
 {
     Mesh3D::Destroy();
-    GFX_DestroyStaticMeshCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyStaticMeshCompResource(this);
+    }
 }
 
 StaticMeshCompResource* StaticMesh3D::GetResource()
@@ -124,7 +134,10 @@ void StaticMesh3D::LoadStream(Stream& stream, Platform platform, uint32_t versio
 #endif
     }
 
-    GFX_UpdateStaticMeshCompResourceColors(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_UpdateStaticMeshCompResourceColors(this);
+    }
 }
 
 bool StaticMesh3D::IsStaticMesh3D() const
@@ -142,8 +155,13 @@ void StaticMesh3D::SetStaticMesh(StaticMesh* staticMesh)
     if (mStaticMesh.Get() != staticMesh)
     {
         mStaticMesh = staticMesh;
+        mLodIndex = 0;
         RecreateCollisionShape();
         ClearInstanceColors();
+
+#if EDITOR
+        GetEditorState()->HandleNodeChanged(this);
+#endif
     }
 }
 
@@ -176,6 +194,27 @@ bool StaticMesh3D::GetBakeLighting() const
     return mBakeLighting;
 }
 
+void StaticMesh3D::UpdateLod(float screenSize)
+{
+    StaticMesh* staticMesh = mStaticMesh.Get<StaticMesh>();
+
+    // Instance colors are per vertex of LOD 0, so they can't be applied to the reduced meshes.
+    if (staticMesh == nullptr ||
+        HasInstanceColors())
+    {
+        mLodIndex = 0;
+    }
+    else
+    {
+        mLodIndex = staticMesh->SelectLod(screenSize, mLodIndex);
+    }
+}
+
+uint32_t StaticMesh3D::GetLodIndex() const
+{
+    return mLodIndex;
+}
+
 Material* StaticMesh3D::GetMaterial()
 {
     Material* mat = mMaterialOverride.Get<Material>();
@@ -190,7 +229,17 @@ Material* StaticMesh3D::GetMaterial()
 
 void StaticMesh3D::Render()
 {
-    GFX_DrawStaticMeshComp(this);
+    StaticMesh* staticMesh = mStaticMesh.Get<StaticMesh>();
+    StaticMesh* lodMesh = nullptr;
+
+    if (staticMesh != nullptr &&
+        mLodIndex > 0 &&
+        mLodIndex < staticMesh->GetNumLods())
+    {
+        lodMesh = staticMesh->GetLod(mLodIndex);
+    }
+
+    GFX_DrawStaticMeshComp(this, lodMesh);
 }
 
 VertexType StaticMesh3D::GetVertexType() const
@@ -245,14 +294,22 @@ void StaticMesh3D::ClearInstanceColors()
 {
     mInstanceColors.clear();
     mHasBakedLighting = false;
-    GFX_UpdateStaticMeshCompResourceColors(this);
+
+    if (!GFX_IsHeadless())
+    {
+        GFX_UpdateStaticMeshCompResourceColors(this);
+    }
 }
 
 void StaticMesh3D::SetInstanceColors(const std::vector<uint32_t>& colors, bool bakedLighting)
 {
     mInstanceColors = colors;
     mHasBakedLighting = bakedLighting;
-    GFX_UpdateStaticMeshCompResourceColors(this);
+
+    if (!GFX_IsHeadless())
+    {
+        GFX_UpdateStaticMeshCompResourceColors(this);
+    }
 }
 
 std::vector<uint32_t>& StaticMesh3D::GetInstanceColors()
@@ -39,6 +39,10 @@ public:
     void SetBakeLighting(bool bake);
     bool GetBakeLighting() const;
 
+    // Called by the renderer with the projected bounds size (fraction of screen height).
+    void UpdateLod(float screenSize);
+    uint32_t GetLodIndex() const;
+
     virtual Material* GetMaterial() override;
     virtual void Render() override;
 
@@ -66,6 +70,7 @@ protected:
     bool mUseTriangleCollision;
     bool mBakeLighting;
     bool mHasBakedLighting;
+    uint32_t mLodIndex = 0;
 
     // Graphics Resource
     StaticMeshCompResource mResource;
@@ -96,6 +96,11 @@ void TestSpinner::EditorTick(float deltaTime)
     TickCommon(deltaTime);
 }
 
+bool TestSpinner::NeedsTick() const
+{
+    return true;
+}
+
 void TestSpinner::TickCommon(float deltaTime)
 {
     if (!mSpin)
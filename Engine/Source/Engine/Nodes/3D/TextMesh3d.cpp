@@ -62,7 +62,10 @@ void TextMesh3D::GatherProperties(std::vector<Property>& outProps)
 void TextMesh3D::Create()
 {
     Mesh3D::Create();
-    GFX_CreateTextMeshCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateTextMeshCompResource(this);
+    }
 
     // To make things easier, each TextMesh3D creates a material instance
     // to use in the case that a material override is not provided.
@@ -75,7 +78,10 @@ void TextMesh3D::Create()
 void TextMesh3D::Destroy()
 {
     Mesh3D::Destroy();
-    GFX_DestroyTextMeshCompResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyTextMeshCompResource(this);
+    }
 }
 
 TextMeshCompResource* TextMesh3D::GetResource()
@@ -95,6 +101,11 @@ void TextMesh3D::EditorTick(float deltaTime)
     TickCommon(deltaTime);
 }
 
+bool TextMesh3D::NeedsTick() const
+{
+    return true;
+}
+
 void TextMesh3D::TickCommon(float deltaTime)
 {
     UpdateVertexData();
@@ -247,7 +258,7 @@ void TextMesh3D::UploadVertexData()
 {
     // Upload vertices to GPU
     uint32_t frameIndex = Renderer::Get()->GetFrameIndex();
-    if (mUploadVertices[frameIndex])
+    if (mUploadVertices[frameIndex] && !GFX_IsHeadless())
     {
         GFX_UpdateTextMeshCompVertexBuffer(this, mVertices);
         mUploadVertices[frameIndex] = false;
@@ -86,6 +86,24 @@ bool Node::HandlePropChange(Datum* datum, uint32_t index, const void* newValue)
         const std::string& newName = *((const std::string*)newValue);
         node->SetName(newName);
 
+        success = true;
+    }
+    else if (prop->mName == "Late Tick")
+    {
+        node->EnableLateTick(*((const bool*)newValue));
+
+        success = true;
+    }
+    else if (prop->mName == "Active")
+    {
+        node->SetActive(*((const bool*)newValue));
+
+        success = true;
+    }
+    else if (prop->mName == "Visible")
+    {
+        node->SetVisible(*((const bool*)newValue));
+
         success = true;
     }
 #if EDITOR
@@ -469,6 +487,24 @@ void Node::RecursiveTick(float deltaTime, bool game)
     }
 }
 
+void Node::GroupTick(float deltaTime, bool game)
+{
+    // Called by the World for nodes registered in one of its tick lists.
+    // Children are ticked from their own tick list entries, not from here.
+    // A game node must Start() before its first Tick() (see World::TickNodes).
+    if (CanTick() && (!game || mHasStarted))
+    {
+        if (game)
+        {
+            Tick(deltaTime);
+        }
+        else
+        {
+            EditorTick(deltaTime);
+        }
+    }
+}
+
 void Node::Tick(float deltaTime)
 {
     TickCommon(deltaTime);
@@ -479,6 +515,14 @@ void Node::EditorTick(float deltaTime)
     TickCommon(deltaTime);
 }
 
+void Node::FixedTick(float deltaTime)
+{
+    if (mScript != nullptr)
+    {
+        mScript->FixedTick(deltaTime);
+    }
+}
+
 void Node::TickCommon(float deltaTime)
 {
     if (mScript != nullptr)
@@ -506,9 +550,9 @@ void Node::GatherProperties(std::vector<Property>& outProps)
 #if EDITOR
         outProps.push_back(Property(DatumType::Bool, "Expose Variable", this, &mExposeVariable));
 #endif
-        outProps.push_back({ DatumType::Bool, "Active", this, &mActive });
-        outProps.push_back({ DatumType::Bool, "Visible", this, &mVisible });
-        outProps.push_back({ DatumType::Bool, "Late Tick", this, &mLateTick });
+        outProps.push_back({ DatumType::Bool, "Active", this, &mActive, 1, HandlePropChange });
+        outProps.push_back({ DatumType::Bool, "Visible", this, &mVisible, 1, HandlePropChange });
+        outProps.push_back({ DatumType::Bool, "Late Tick", this, &mLateTick, 1, HandlePropChange });
 
         outProps.push_back(Property(DatumType::Bool, "Replicate", this, &mReplicate));
         outProps.push_back(Property(DatumType::Bool, "Replicate Transform", this, &mReplicateTransform));
@@ -855,7 +899,23 @@ bool Node::IsWorldRoot() const
 
 void Node::SetPendingDestroy(bool pendingDestroy)
 {
-    mPendingDestroy = pendingDestroy;
+    if (mPendingDestroy != pendingDestroy)
+    {
+        mPendingDestroy = pendingDestroy;
+        UpdateCanTick();
+
+        if (mWorld != nullptr)
+        {
+            if (mPendingDestroy)
+            {
+                mWorld->AddPendingDestroy(this);
+            }
+            else
+            {
+                mWorld->RemovePendingDestroy(this);
+            }
+        }
+    }
 
     // Do we need to mark children as pending destroy? I think it could cause problems...
     // A parent node may be expecting its children to be alive during Tick(), but if they are 
@@ -895,7 +955,16 @@ bool Node::HasStarted() const
 
 void Node::EnableTick(bool enable)
 {
-    mTickEnabled = enable;
+    if (mTickEnabled != enable)
+    {
+        mTickEnabled = enable;
+        UpdateCanTick();
+
+        if (mWorld != nullptr)
+        {
+            mWorld->UpdateTickRegistration(this);
+        }
+    }
 }
 
 bool Node::IsTickEnabled() const
@@ -903,6 +972,77 @@ bool Node::IsTickEnabled() const
     return mTickEnabled;
 }
 
+bool Node::CanTick() const
+{
+    return mCanTick;
+}
+
+bool Node::NeedsTick() const
+{
+    return (mScript != nullptr && mScript->NeedsTick());
+}
+
+void Node::UpdateCanTick()
+{
+    // Disabling tick, deactivating, or destroying a node also stops its descendants from ticking.
+    bool canTick = mTickEnabled &&
+        mActive &&
+        !mPendingDestroy &&
+        (mParent == nullptr || mParent->mCanTick);
+
+    if (mCanTick != canTick)
+    {
+        mCanTick = canTick;
+
+        for (uint32_t i = 0; i < mChildren.size(); ++i)
+        {
+            mChildren[i]->UpdateCanTick();
+        }
+    }
+}
+
+void Node::SetTickGroup(TickGroup group)
+{
+    OCT_ASSERT(group != TickGroup::Count);
+
+    if (group != GetTickGroup())
+    {
+        // Remove from the old tick list before changing group, since the world
+        // uses the node's current group to find which list it lives in.
+        if (mWorld != nullptr)
+        {
+            mWorld->RemoveTickNode(this);
+        }
+
+        mLateTick = (group == TickGroup::Late);
+
+        if (!mLateTick)
+        {
+            mTickGroup = group;
+        }
+
+        if (mWorld != nullptr)
+        {
+            mWorld->UpdateTickRegistration(this);
+        }
+    }
+}
+
+TickGroup Node::GetTickGroup() const
+{
+    return mLateTick ? TickGroup::Late : mTickGroup;
+}
+
+void Node::SetTickListIndex(int32_t index)
+{
+    mTickListIndex = index;
+}
+
+int32_t Node::GetTickListIndex() const
+{
+    return mTickListIndex;
+}
+
 void Node::SetWorld(World * world)
 {
     if (mWorld != world)
@@ -1097,7 +1237,11 @@ const std::string& Node::GetName() const
 
 void Node::SetActive(bool active)
 {
-    mActive = active;
+    if (mActive != active)
+    {
+        mActive = active;
+        UpdateCanTick();
+    }
 }
 
 bool Node::IsActive(bool recurse) const
@@ -1114,7 +1258,14 @@ bool Node::IsActive(bool recurse) const
 
 void Node::SetVisible(bool visible)
 {
-    mVisible = visible;
+    if (mVisible != visible)
+    {
+        mVisible = visible;
+
+#if EDITOR
+        GetEditorState()->HandleNodeChanged(this, true);
+#endif
+    }
 }
 
 bool Node::IsVisible(bool recurse) const
@@ -1524,7 +1675,7 @@ bool Node::IsLateTickEnabled() const
 
 void Node::EnableLateTick(bool enable)
 {
-    mLateTick = enable;
+    SetTickGroup(enable ? TickGroup::Late : mTickGroup);
 }
 
 Script* Node::GetScript()
@@ -1800,6 +1951,8 @@ NetFunc* Node::FindNetFunc(uint16_t index)
 void Node::SetParent(Node* parent)
 {
     mParent = parent;
+    UpdateCanTick();
+    Node3D::InvalidateInterpolatedAncestors();
 }
 
 void Node::ValidateUniqueChildName(Node* newChild)
@@ -83,8 +83,12 @@ public:
     virtual void Start();
     virtual void Stop();
     virtual void RecursiveTick(float deltaTime, bool game);
+    virtual void GroupTick(float deltaTime, bool game);
     virtual void Tick(float deltaTime);
     virtual void EditorTick(float deltaTime);
+
+    // Called at the world's fixed tick rate, right before each physics step. See World::SetFixedTickRate().
+    virtual void FixedTick(float deltaTime);
     virtual void Render();
     virtual VertexType GetVertexType() const;
 
@@ -141,6 +145,17 @@ public:
 
     void EnableTick(bool enable);
     bool IsTickEnabled() const;
+    bool CanTick() const;
+
+    // Whether this node does any per-frame work. Only nodes that need it are placed in the
+    // world's tick lists. Override in types whose Tick() does more than run the script.
+    virtual bool NeedsTick() const;
+
+    void SetTickGroup(TickGroup group);
+    TickGroup GetTickGroup() const;
+
+    void SetTickListIndex(int32_t index);
+    int32_t GetTickListIndex() const;
 
     virtual void SetWorld(World* world);
     World* GetWorld();
@@ -359,6 +374,7 @@ protected:
 
     virtual void SetParent(Node* parent);
     void ValidateUniqueChildName(Node* newChild);
+    void UpdateCanTick();
 
     void SendNetFunc(NetFunc* func, uint32_t numParams, const Datum** params);
 
@@ -385,7 +401,10 @@ protected:
     bool mHasStarted = false;
     bool mPendingDestroy = false;
     bool mTickEnabled = true;
+    bool mCanTick = true;
     bool mLateTick = false;
+    TickGroup mTickGroup = TickGroup::PostPhysics;
+    int32_t mTickListIndex = -1;
 
     // Network Data
     // This is only about 44 bytes, so right now, we will keep this data as direct members of Node.
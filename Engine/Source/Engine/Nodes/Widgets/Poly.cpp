@@ -24,13 +24,19 @@ Poly::~Poly()
 void Poly::Create()
 {
     Widget::Create();
-    GFX_CreatePolyResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreatePolyResource(this);
+    }
 }
 
 void Poly::Destroy()
 {
     Widget::Destroy();
-    GFX_DestroyPolyResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyPolyResource(this);
+    }
 }
 
 PolyResource* Poly::GetResource()
@@ -46,14 +46,20 @@ void Quad::Create()
     Widget::Create();
 
     InitVertexData();
-    GFX_CreateQuadResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateQuadResource(this);
+    }
 }
 
 void Quad::Destroy()
 {
     Widget::Destroy();
 
-    GFX_DestroyQuadResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyQuadResource(this);
+    }
 }
 
 QuadResource* Quad::GetResource()
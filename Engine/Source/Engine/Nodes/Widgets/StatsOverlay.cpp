@@ -5,9 +5,12 @@
 #include "Profiler.h"
 #include "Engine.h"
 #include "NetworkManager.h"
+#include "World.h"
 
 #include "System/System.h"
 
+#include <algorithm>
+
 FORCE_LINK_DEF(StatsOverlay);
 DEFINE_NODE(StatsOverlay, Canvas);
 
@@ -40,6 +43,7 @@ void StatsOverlay::TickCommon(float deltaTime)
 {
     // (1) Determine the number of stats to display.
     uint32_t numStats = 0;
+    std::vector<std::pair<TypeId, AssetMemoryStats>> typeStats;
 
     switch (mDisplayMode)
     {
@@ -59,11 +63,32 @@ void StatsOverlay::TickCommon(float deltaTime)
         numStats += (uint32_t)GetProfiler()->GetGpuStats().size();
         break;
     case StatDisplayMode::Memory:
-        numStats = 1;
+    {
+        std::unordered_map<TypeId, AssetMemoryStats> typeStatMap = AssetManager::Get()->GetTypeMemoryStats();
+        for (auto it = typeStatMap.begin(); it != typeStatMap.end(); ++it)
+        {
+            if (it->second.mNumAssets > 0)
+            {
+                typeStats.push_back(*it);
+            }
+        }
+
+        // Largest asset types first.
+        std::sort(typeStats.begin(), typeStats.end(),
+            [](const std::pair<TypeId, AssetMemoryStats>& l, const std::pair<TypeId, AssetMemoryStats>& r)
+            {
+                return (l.second.mCpuBytes + l.second.mGpuBytes) > (r.second.mCpuBytes + r.second.mGpuBytes);
+            });
+
+        numStats = 5 + (uint32_t)typeStats.size();
         break;
+    }
     case StatDisplayMode::Network:
         numStats = 2;
         break;
+    case StatDisplayMode::Physics:
+        numStats = 4;
+        break;
     default:
         numStats = 0;
         break;
@@ -107,6 +132,22 @@ void StatsOverlay::TickCommon(float deltaTime)
 #else
         SetStatText(0, "Free Memory", SYS_GetNumBytesFree() / static_cast<float>(1024 * 1024), DEFAULT_STAT_COLOR, statY);
 #endif
+
+        AssetMemoryStats assetStats = AssetManager::Get()->GetMemoryStats();
+        uint64_t assetBudget = AssetManager::Get()->GetMemoryBudget();
+        uint64_t assetBytes = assetStats.mCpuBytes + assetStats.mGpuBytes;
+        glm::vec4 assetColor = (assetBudget > 0 && assetBytes > assetBudget) ? glm::vec4(1.0f, 0.4f, 0.4f, 1.0f) : DEFAULT_STAT_COLOR;
+
+        SetStatText(1, "Asset CPU", assetStats.mCpuBytes / static_cast<float>(1024 * 1024), assetColor, statY);
+        SetStatText(2, "Asset GPU", assetStats.mGpuBytes / static_cast<float>(1024 * 1024), assetColor, statY);
+        SetStatText(3, "Asset Cached", assetStats.mCachedBytes / static_cast<float>(1024 * 1024), DEFAULT_STAT_COLOR, statY);
+        SetStatText(4, "Asset Budget", assetBudget / static_cast<float>(1024 * 1024), DEFAULT_STAT_COLOR, statY);
+
+        for (uint32_t i = 0; i < typeStats.size(); ++i)
+        {
+            const AssetMemoryStats& stats = typeStats[i].second;
+            SetStatText(5 + i, Asset::GetNameFromTypeId(typeStats[i].first), (stats.mCpuBytes + stats.mGpuBytes) / static_cast<float>(1024 * 1024), DEFAULT_STAT_COLOR, statY);
+        }
     }
     else if (mDisplayMode == StatDisplayMode::Network)
     {
@@ -114,6 +155,15 @@ void StatsOverlay::TickCommon(float deltaTime)
         SetStatText(0, "Upload", netMan->GetUploadRate() / 1024, DEFAULT_STAT_COLOR, statY);
         SetStatText(1, "Download", netMan->GetDownloadRate() / 1024, DEFAULT_STAT_COLOR, statY);
     }
+    else if (mDisplayMode == StatDisplayMode::Physics)
+    {
+        // The overlay is owned by the renderer, so report the primary world.
+        const PhysicsStats& physStats = ::GetWorld(0)->GetPhysicsStats();
+        SetStatText(0, "Phys Threads", float(physStats.mNumThreads), DEFAULT_STAT_COLOR, statY);
+        SetStatText(1, "Phys Bodies", float(physStats.mNumBodies), DEFAULT_STAT_COLOR, statY);
+        SetStatText(2, "Phys Moved", float(physStats.mNumMovedBodies), DEFAULT_STAT_COLOR, statY);
+        SetStatText(3, "Phys Manifolds", float(physStats.mNumManifolds), DEFAULT_STAT_COLOR, statY);
+    }
     else
     {
         const std::vector<CpuStat>& cpuStats = GetProfiler()->GetCpuFrameStats();
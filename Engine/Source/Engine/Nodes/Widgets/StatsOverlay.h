@@ -14,6 +14,7 @@ enum class StatDisplayMode
     AllStatText,
     Memory,
     Network,
+    Physics,
 
     Count
 };
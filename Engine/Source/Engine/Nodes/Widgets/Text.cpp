@@ -8,6 +8,9 @@
 
 #include "Graphics/Graphics.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 FORCE_LINK_DEF(Text);
 DEFINE_NODE(Text, Widget);
 
@@ -27,6 +30,82 @@ static const char* sVertJustStrings[] =
 };
 static_assert(int32_t(Justification::Count) == 3, "Need to update string conversion table");
 
+// Laid out glyph runs shared by every Text widget, so that labels which cycle through
+// the same strings (scores, timers, damage numbers) skip layout after the first time.
+#define MAX_GLYPH_RUNS 512
+#define MAX_GLYPH_RUN_CHARS 64
+
+struct GlyphRunKey
+{
+    Font* mFont = nullptr;
+    std::string mText;
+    float mWrapLimit = 0.0f;
+    Justification mHoriJust = Justification::Left;
+    Justification mVertJust = Justification::Top;
+    bool mWordWrap = false;
+
+    bool operator==(const GlyphRunKey& other) const
+    {
+        return mFont == other.mFont &&
+            mWrapLimit == other.mWrapLimit &&
+            mHoriJust == other.mHoriJust &&
+            mVertJust == other.mVertJust &&
+            mWordWrap == other.mWordWrap &&
+            mText == other.mText;
+    }
+};
+
+struct GlyphRunKeyHasher
+{
+    size_t operator()(const GlyphRunKey& k) const
+    {
+        size_t hash = std::hash<std::string>()(k.mText);
+        hash ^= std::hash<const void*>()(k.mFont) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<float>()(k.mWrapLimit) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= size_t(k.mHoriJust) | (size_t(k.mVertJust) << 8) | (size_t(k.mWordWrap) << 16);
+        return hash;
+    }
+};
+
+struct GlyphRun
+{
+    std::vector<VertexUI> mVertices;
+    glm::vec2 mMinExtent = {};
+    glm::vec2 mMaxExtent = {};
+    int32_t mVisibleCharacters = 0;
+    uint32_t mLastUsedFrame = 0;
+};
+
+static std::unordered_map<GlyphRunKey, GlyphRun, GlyphRunKeyHasher> sGlyphRunCache;
+
+static void EvictGlyphRuns()
+{
+    // Drop the least recently used quarter of the cache.
+    std::vector<uint32_t> frames;
+    frames.reserve(sGlyphRunCache.size());
+
+    for (auto it = sGlyphRunCache.begin(); it != sGlyphRunCache.end(); ++it)
+    {
+        frames.push_back(it->second.mLastUsedFrame);
+    }
+
+    auto threshold = frames.begin() + frames.size() / 4;
+    std::nth_element(frames.begin(), threshold, frames.end());
+    uint32_t evictFrame = *threshold;
+
+    for (auto it = sGlyphRunCache.begin(); it != sGlyphRunCache.end();)
+    {
+        if (it->second.mLastUsedFrame <= evictFrame)
+        {
+            it = sGlyphRunCache.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 static uint32_t HexCharToInt(char c)
 {
     uint32_t ret = 255;
@@ -113,7 +192,10 @@ void Text::Create()
 
     mFont = LoadAsset<Font>("F_Roboto32");
     MarkVerticesDirty();
-    GFX_CreateTextResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_CreateTextResource(this);
+    }
 }
 
 void Text::Destroy()
@@ -126,7 +208,10 @@ void Text::Destroy()
         mVertices = nullptr;
     }
 
-    GFX_DestroyTextResource(this);
+    if (!GFX_IsHeadless())
+    {
+        GFX_DestroyTextResource(this);
+    }
 }
 
 TextResource* Text::GetResource()
@@ -201,12 +286,9 @@ void Text::SetColor(glm::vec4 color)
 
 void Text::MarkDirty()
 {
+    // Layout is only invalidated by changes that affect it. UpdateVertexData() re-lays out
+    // word wrapped text when the wrap limit changes.
     Widget::MarkDirty();
-
-    if (mWordWrap)
-    {
-        MarkVerticesDirty();
-    }
 }
 
 void Text::SetOutlineColor(glm::vec4 color)
@@ -400,8 +482,17 @@ bool Text::ContainsPoint(int32_t x, int32_t y)
 
 void Text::UpdateVertexData()
 {
-    if (!mReconstructVertices ||
-        mFont == nullptr)
+    if (mFont == nullptr)
+        return;
+
+    // Word wrapped text only needs a new layout when the wrap limit changes.
+    // Moving or recoloring the widget keeps the existing glyph run.
+    if (mWordWrap && GetWrapLimit() != mLayoutWrapLimit)
+    {
+        MarkVerticesDirty();
+    }
+
+    if (!mReconstructVertices)
         return;
 
     // Check if we need to reallocate a bigger buffer.
@@ -420,14 +511,7 @@ void Text::UpdateVertexData()
         mNumCharactersAllocated = numCharsToAllocate;
     }
 
-    Font* font = mFont.Get<Font>();
-    OCT_ASSERT(font != nullptr);
-    int32_t fontSize = font->GetSize();
-    int32_t fontWidth = font->GetWidth();
-    int32_t fontHeight = font->GetHeight();
-    float lineSpacing = font->GetLineSpacing();
-    const std::vector<Character>& fontChars = font->GetCharacters();
-
+    mLayoutWrapLimit = mWordWrap ? GetWrapLimit() : 0.0f;
     mVisibleCharacters = 0;
     mMinExtent = glm::vec2(0.0f, 0.0f);
     mMaxExtent = glm::vec2(0.0f, 0.0f);
@@ -438,6 +522,71 @@ void Text::UpdateVertexData()
         return;
     }
 
+    Font* font = mFont.Get<Font>();
+    OCT_ASSERT(font != nullptr);
+
+    bool cacheable = (mText.size() <= MAX_GLYPH_RUN_CHARS);
+    GlyphRunKey key;
+
+    if (cacheable)
+    {
+        key.mFont = font;
+        key.mText = mText;
+        key.mWrapLimit = mLayoutWrapLimit;
+        key.mHoriJust = mHoriJust;
+        key.mVertJust = mVertJust;
+        key.mWordWrap = mWordWrap;
+
+        auto it = sGlyphRunCache.find(key);
+        if (it != sGlyphRunCache.end())
+        {
+            GlyphRun& run = it->second;
+            run.mLastUsedFrame = Renderer::Get()->GetFrameNumber();
+
+            if (run.mVertices.size() > 0)
+            {
+                memcpy(mVertices, run.mVertices.data(), run.mVertices.size() * sizeof(VertexUI));
+            }
+
+            mVisibleCharacters = run.mVisibleCharacters;
+            mMinExtent = run.mMinExtent;
+            mMaxExtent = run.mMaxExtent;
+            mReconstructVertices = false;
+            return;
+        }
+    }
+
+    LayoutVertices();
+
+    if (cacheable)
+    {
+        if (sGlyphRunCache.size() >= MAX_GLYPH_RUNS)
+        {
+            EvictGlyphRuns();
+        }
+
+        GlyphRun run;
+        run.mVertices.assign(mVertices, mVertices + mVisibleCharacters * TEXT_VERTS_PER_CHAR);
+        run.mMinExtent = mMinExtent;
+        run.mMaxExtent = mMaxExtent;
+        run.mVisibleCharacters = mVisibleCharacters;
+        run.mLastUsedFrame = Renderer::Get()->GetFrameNumber();
+        sGlyphRunCache.insert({ std::move(key), std::move(run) });
+    }
+
+    mReconstructVertices = false;
+}
+
+void Text::LayoutVertices()
+{
+    Font* font = mFont.Get<Font>();
+    OCT_ASSERT(font != nullptr);
+    int32_t fontSize = font->GetSize();
+    int32_t fontWidth = font->GetWidth();
+    int32_t fontHeight = font->GetHeight();
+    float lineSpacing = font->GetLineSpacing();
+    const std::vector<Character>& fontChars = font->GetCharacters();
+
     // Run through each of the characters and construct vertices for it.
     // Not using an index buffer currently, so each character is 6 vertices.
     // Topology is triangles.
@@ -450,7 +599,7 @@ void Text::UpdateVertexData()
     float cursorX = 0.0f;
     float cursorY = 0.0f + (font->GetSize() + lineSpacing);
 
-    float textScale = GetScaledTextSize() / fontSize;
+    float wrapLimit = GetWrapLimit();
 
     for (uint32_t i = 0; i < mText.size(); ++i)
     {
@@ -549,7 +698,7 @@ void Text::UpdateVertexData()
         }
         else if (mWordWrap &&
             wordVertStart != lineVertStart &&
-            (cursorX - fontChar.mOriginX + fontChar.mWidth) * textScale > mRect.mWidth)
+            (cursorX - fontChar.mOriginX + fontChar.mWidth) > wrapLimit)
         {
             JustifyLine(mVertices, mHoriJust, lineVertStart, wordVertStart);
 
@@ -595,7 +744,15 @@ void Text::UpdateVertexData()
         mMaxExtent.y += deltaY;
     }
 
-    mReconstructVertices = false;
+}
+
+
+float Text::GetWrapLimit() const
+{
+    // Wrapping compares unscaled glyph positions against the rect width in font space.
+    const Font* font = mFont.Get<Font>();
+    float textScale = font ? (GetScaledTextSize() / font->GetSize()) : 0.0f;
+    return (textScale > 0.0f) ? (mRect.mWidth / textScale) : FLT_MAX;
 }
 
 void Text::UploadVertexData()
@@ -632,6 +789,53 @@ void Text::Render()
     GFX_DrawText(this);
 }
 
+bool Text::CanBatch(Text* a, Text* b)
+{
+    Rect scissorA = a->GetScissorRect();
+    Rect scissorB = b->GetScissorRect();
+
+    return a->GetFont() == b->GetFont() &&
+        a->GetColor() == b->GetColor() &&
+        a->GetCutoff() == b->GetCutoff() &&
+        a->GetOutlineSize() == b->GetOutlineSize() &&
+        a->GetSoftness() == b->GetSoftness() &&
+        scissorA.mX == scissorB.mX &&
+        scissorA.mY == scissorB.mY &&
+        scissorA.mWidth == scissorB.mWidth &&
+        scissorA.mHeight == scissorB.mHeight;
+}
+
+void Text::RenderBatch(Text* const* texts, uint32_t numTexts)
+{
+    if (numTexts == 0)
+        return;
+
+    // Every text in the batch shares a scissor rect.
+    texts[0]->Widget::Render();
+    GFX_DrawTextBatch(texts, numTexts);
+}
+
+void Text::ClearGlyphRunCache(Font* font)
+{
+    if (font == nullptr)
+    {
+        sGlyphRunCache.clear();
+        return;
+    }
+
+    for (auto it = sGlyphRunCache.begin(); it != sGlyphRunCache.end();)
+    {
+        if (it->first.mFont == font)
+        {
+            it = sGlyphRunCache.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 glm::vec2 Text::GetJustifiedOffset()
 {
     glm::vec2 offset = glm::vec2(
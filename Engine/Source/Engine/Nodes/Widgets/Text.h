@@ -89,12 +89,21 @@ public:
     glm::vec2 GetJustifiedOffset();
     static float GetJustificationRatio(Justification just);
 
+    // Widgets that can be drawn with a single draw call (same font, scissor and text uniforms).
+    static bool CanBatch(Text* a, Text* b);
+    static void RenderBatch(Text* const* texts, uint32_t numTexts);
+
+    // Drops cached glyph runs for the given font (or all fonts if null).
+    static void ClearGlyphRunCache(Font* font = nullptr);
+
 protected:
 
     static bool HandlePropChange(Datum* datum, uint32_t index, const void* newValue);
 
     void TickCommon(float deltaTime);
     void UpdateVertexData();
+    void LayoutVertices();
+    float GetWrapLimit() const;
     void UploadVertexData();
     void JustifyLine(VertexUI* vertices, Justification just, int32_t& lineVertStart, int32_t numVerts);
 
@@ -117,6 +126,9 @@ protected:
     bool mUploadVertices[MAX_FRAMES] = {};
     bool mReconstructVertices = false;
 
+    // Wrap limit that the current vertices were laid out with (only relevant with word wrap).
+    float mLayoutWrapLimit = 0.0f;
+
     // Graphics Resource
     TextResource mResource;
 };
\ No newline at end of file
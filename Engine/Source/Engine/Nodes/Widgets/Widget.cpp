@@ -150,6 +150,22 @@ void Widget::RecursiveTick(float deltaTime, bool game)
     }
 }
 
+// Only the top-most widget of a widget tree is registered in a world tick list.
+// The rest of the tree is ticked recursively from here so that layout is resolved parent-first.
+void Widget::GroupTick(float deltaTime, bool game)
+{
+    // Widget trees only exist to be drawn, so a dedicated server skips their layout and ticking entirely.
+    if (IsDedicatedServer())
+    {
+        return;
+    }
+
+    if (mParent == nullptr || mParent->CanTick())
+    {
+        RecursiveTick(deltaTime, game);
+    }
+}
+
 void Widget::Tick(float deltaTime)
 {
     Node::Tick(deltaTime);
@@ -62,6 +62,7 @@ public:
     // Refresh any data used for rendering based on this widget's state. Use dirty flag.
     // Recursively update children.
     virtual void RecursiveTick(float deltaTime, bool game) override;
+    virtual void GroupTick(float deltaTime, bool game) override;
     virtual void Tick(float deltaTime) override;
     virtual void EditorTick(float deltaTime) override;
     virtual void Render() override;
@@ -5,11 +5,14 @@
 #include "Profiler.h"
 #include "Constants.h"
 #include "Nodes/Widgets/Widget.h"
+#include "Nodes/Widgets/Text.h"
 #include "Nodes/Widgets/Console.h"
 #include "Nodes/Widgets/StatsOverlay.h"
 #include "Assets/Font.h"
 #include "Nodes/3D/PointLight3d.h"
 #include "Nodes/3D/Primitive3d.h"
+#include "Nodes/3D/StaticMesh3d.h"
+#include "Nodes/3D/InstancedMesh3d.h"
 #include "Nodes/3D/Particle3d.h"
 #include "Nodes/3D/SkeletalMesh3d.h"
 #include "Nodes/3D/ShadowMesh3d.h"
@@ -55,6 +58,41 @@ using namespace std::chrono;
 
 Renderer* Renderer::sInstance = nullptr;
 
+static void SetupCameraFrustum(Camera3D* camera, CameraFrustum& frustum)
+{
+    frustum.SetPosition(camera->GetWorldPosition());
+    frustum.SetBasis(
+        camera->GetForwardVector(),
+        camera->GetUpVector(),
+        camera->GetRightVector());
+
+    float nearZ = camera->GetNearZ();
+    float farZ = camera->GetFarZ();
+
+    ProjectionMode projMode = camera->GetProjectionMode();
+    if (projMode == ProjectionMode::PERSPECTIVE)
+    {
+        float fovY = camera->GetFieldOfViewY();
+        float aspectRatio = camera->GetAspectRatio();
+
+        frustum.SetPerspective(
+            fovY,
+            aspectRatio,
+            nearZ,
+            farZ);
+    }
+    else
+    {
+        float orthoWidth = camera->GetOrthoWidth();
+        float orthoHeight = camera->GetOrthoHeight();
+
+        frustum.SetOrthographic(orthoWidth,
+            orthoHeight,
+            nearZ,
+            farZ);
+    }
+}
+
 void Renderer::Create()
 {
     Destroy();
@@ -133,7 +171,10 @@ void Renderer::GatherProperties(std::vector<Property>& props)
     props.push_back(Property(DatumType::Float, "Resolution Scale", nullptr, &(GetEngineState()->mGraphics.mResolutionScale)));
 
 #if API_VULKAN
-    GetVulkanContext()->GetPostProcessChain()->GatherProperties(props);
+    if (GetVulkanContext() != nullptr)
+    {
+        GetVulkanContext()->GetPostProcessChain()->GatherProperties(props);
+    }
 #endif
 
     props.push_back(Property(DatumType::Bool, "Light Fade", nullptr, &mEnableLightFade));
@@ -461,7 +502,11 @@ void Renderer::LoadDefaultFonts()
 void Renderer::AddDebugDraw(const DebugDraw& draw)
 {
 #if DEBUG_DRAW_ENABLED
-    mDebugDraws.push_back(draw);
+    // Debug draws are only expired by Render(), which never runs on a dedicated server.
+    if (!IsDedicatedServer())
+    {
+        mDebugDraws.push_back(draw);
+    }
 #endif
 }
 
@@ -523,6 +568,17 @@ void Renderer::GatherDrawData(World* world)
     {
         glm::vec3 cameraPos = camera->GetWorldPosition();
 
+        // Converts a bounding radius (and distance, for perspective) into a fraction of the screen height for LOD selection.
+        // Both branches measure against the half-height of the view. GetOrthoHeight() is already a half-extent.
+        bool perspective = (camera->GetProjectionMode() == ProjectionMode::PERSPECTIVE);
+        float lodScale = perspective ?
+            1.0f / tanf(camera->GetFieldOfViewY() * DEGREES_TO_RADIANS * 0.5f) :
+            1.0f / camera->GetOrthoHeight();
+
+        // Instanced meshes cull their chunks individually while gathering.
+        CameraFrustum frustum;
+        SetupCameraFrustum(camera, frustum);
+
         auto gatherDrawData = [&](Node* node) -> bool
         {
             if (!node->IsVisible())
@@ -550,12 +606,16 @@ void Renderer::GatherDrawData(World* world)
                 Primitive3D* prim = (Primitive3D*)node;
                 bool simpleShadow = (data.mNodeType == ShadowMesh3D::GetStaticType());
 
+                InstancedMesh3D* instMeshNode = node->As<InstancedMesh3D>();
+
                 bool distanceCulled = false;
                 data.mDistance2 = glm::distance2(cameraPos, data.mBounds.mCenter);
                 const float cullDist = prim ? prim->GetCullDistance() : 0.0f;
                 if (cullDist > 0.0f)
                 {
-                    const float cullDist2 = cullDist * cullDist;
+                    // Instanced meshes apply the cull distance per chunk, so only cull the whole node once its nearest edge is too far.
+                    const float nodeCullDist = instMeshNode ? (cullDist + data.mBounds.mRadius) : cullDist;
+                    const float cullDist2 = nodeCullDist * nodeCullDist;
                     if (data.mDistance2 > cullDist2)
                     {
                         distanceCulled = true;
@@ -565,6 +625,23 @@ void Renderer::GatherDrawData(World* world)
                 if (data.mNode != nullptr &&
                     !distanceCulled)
                 {
+                    StaticMesh3D* staticMeshNode = node->As<StaticMesh3D>();
+                    if (staticMeshNode != nullptr)
+                    {
+                        float screenSize = data.mBounds.mRadius * lodScale;
+                        if (perspective)
+                        {
+                            screenSize /= glm::max(sqrtf(data.mDistance2), 0.001f);
+                        }
+
+                        staticMeshNode->UpdateLod(screenSize);
+                    }
+
+                    if (instMeshNode != nullptr)
+                    {
+                        instMeshNode->UpdateVisibleChunks(mFrustumCulling ? &frustum : nullptr, cameraPos);
+                    }
+
                     if (simpleShadow)
                     {
                         mSimpleShadowDraws.push_back(data);
@@ -775,32 +852,22 @@ void Renderer::GatherLightData(World* world)
 
             float dist2 = directional ? 0.0f : glm::distance2(lightPos, camPos);
 
-            if (sClosestLights.size() < lightLimit)
-            {
-                sClosestLights.push_back({ lights[i], dist2 });
-            }
-            else
-            {
-                // We need to evict the farthest light (if it is farther than this cur light)
-                int32_t farthestIdx = -1;
-                float farthestDist = 0.0f;
+            sClosestLights.push_back({ lights[i], dist2 });
+        }
 
-                for (uint32_t j = 0; j < sClosestLights.size(); ++j)
+        // Only keep the closest N lights. A partial selection is O(lights) instead of
+        // rescanning the kept lights for every candidate.
+        if (sClosestLights.size() > lightLimit)
+        {
+            std::nth_element(sClosestLights.begin(),
+                sClosestLights.begin() + lightLimit,
+                sClosestLights.end(),
+                [](const LightDistance2& l, const LightDistance2& r)
                 {
-                    if (sClosestLights[j].mDistance2 > dist2 &&
-                        sClosestLights[j].mDistance2 > farthestDist)
-                    {
-                        farthestIdx = (int32_t)j;
-                        farthestDist = sClosestLights[j].mDistance2;
-                    }
-                }
+                    return l.mDistance2 < r.mDistance2;
+                });
 
-                // We found a light to evict.
-                if (farthestIdx >= 0)
-                {
-                    sClosestLights[farthestIdx] = { lights[i], dist2 };
-                }
-            }
+            sClosestLights.erase(sClosestLights.begin() + lightLimit, sClosestLights.end());
         }
 
         // Step 2 - If there is space, add the closest lights to the fading light list (if not already in it).
@@ -930,6 +997,31 @@ void Renderer::GatherLightData(World* world)
 #endif
 }
 
+void Renderer::SortLightData(Camera3D* camera)
+{
+    if (camera == nullptr)
+        return;
+
+    // Directional lights first, then local lights from nearest to farthest. Backends that can only
+    // use a fixed number of lights (per frame or per draw) will then drop the least important ones.
+    glm::vec3 camPos = camera->GetWorldPosition();
+
+    std::stable_sort(mLightData.begin(),
+        mLightData.end(),
+        [camPos](const LightData& l, const LightData& r)
+        {
+            bool lDir = (l.mType == LightType::Directional);
+            bool rDir = (r.mType == LightType::Directional);
+
+            if (lDir != rDir)
+            {
+                return lDir;
+            }
+
+            return !lDir && glm::distance2(l.mPosition, camPos) < glm::distance2(r.mPosition, camPos);
+        });
+}
+
 void Renderer::RenderDraws(const std::vector<DrawData>& drawData)
 {
     for (uint32_t i = 0; i < drawData.size(); ++i)
@@ -947,6 +1039,40 @@ void Renderer::RenderDraws(const std::vector<DrawData>& drawData, PipelineConfig
     }
 }
 
+void Renderer::RenderWidgetDraws(const std::vector<DrawData>& drawData)
+{
+    SCOPED_FRAME_STAT("Widgets");
+
+    uint32_t i = 0;
+
+    while (i < drawData.size())
+    {
+        // Consecutive text widgets that share a font and text uniforms are drawn together.
+        // Draw order is preserved, so anything drawn in between still layers correctly.
+        if (drawData[i].mNodeType == Text::GetStaticType())
+        {
+            mTextBatch.clear();
+            mTextBatch.push_back(static_cast<Text*>(drawData[i].mNode));
+            ++i;
+
+            while (i < drawData.size() &&
+                drawData[i].mNodeType == Text::GetStaticType() &&
+                Text::CanBatch(mTextBatch[0], static_cast<Text*>(drawData[i].mNode)))
+            {
+                mTextBatch.push_back(static_cast<Text*>(drawData[i].mNode));
+                ++i;
+            }
+
+            Text::RenderBatch(mTextBatch.data(), uint32_t(mTextBatch.size()));
+        }
+        else
+        {
+            drawData[i].mNode->Render();
+            ++i;
+        }
+    }
+}
+
 void Renderer::RenderDebugDraws(const std::vector<DebugDraw>& draws, PipelineConfig pipelineConfig)
 {
 #if DEBUG_DRAW_ENABLED
@@ -974,37 +1100,7 @@ void Renderer::FrustumCull(Camera3D* camera)
         return;
 
     CameraFrustum frustum;
-    frustum.SetPosition(camera->GetWorldPosition());
-    frustum.SetBasis(
-        camera->GetForwardVector(),
-        camera->GetUpVector(),
-        camera->GetRightVector());
-
-    float nearZ = camera->GetNearZ();
-    float farZ = camera->GetFarZ();
-
-    ProjectionMode projMode = camera->GetProjectionMode();
-    if (projMode == ProjectionMode::PERSPECTIVE)
-    {
-        float fovY = camera->GetFieldOfViewY();
-        float aspectRatio = camera->GetAspectRatio();
-
-        frustum.SetPerspective(
-            fovY,
-            aspectRatio,
-            nearZ,
-            farZ);
-    }
-    else
-    {
-        float orthoWidth = camera->GetOrthoWidth();
-        float orthoHeight = camera->GetOrthoHeight();
-
-        frustum.SetOrthographic(orthoWidth,
-            orthoHeight,
-            nearZ,
-            farZ);
-    }
+    SetupCameraFrustum(camera, frustum);
 
     int32_t drawsCulled = 0;
     drawsCulled += FrustumCullDraws(frustum, mOpaqueDraws);
@@ -1237,6 +1333,9 @@ void Renderer::Render(World* world, int32_t screenIndex)
             {
                 FrustumCull(activeCamera);
             }
+
+            SortLightData(activeCamera);
+            mLightGrid.Build(mLightData, activeCamera);
         }
     }
 
@@ -1390,7 +1489,7 @@ void Renderer::Render(World* world, int32_t screenIndex)
             // ******************
             GFX_SetViewport(viewportX, viewportY, viewportWidth, viewportHeight);
             GFX_BeginRenderPass(RenderPassId::Ui);
-            RenderDraws(mWidgetDraws);
+            RenderWidgetDraws(mWidgetDraws);
             GFX_EndRenderPass();
         }
 
@@ -1470,6 +1569,11 @@ const std::vector<LightData>& Renderer::GetLightData() const
     return mLightData;
 }
 
+LightGrid& Renderer::GetLightGrid()
+{
+    return mLightGrid;
+}
+
 void Renderer::BeginLightBake()
 {
     GFX_BeginLightBake();
@@ -9,12 +9,14 @@
 #include "Assets/StaticMesh.h"
 #include "Assets/MaterialLite.h"
 #include "Vertex.h"
+#include "LightGrid.h"
 #include "World.h"
 #include "Constants.h"
 #include "Log.h"
 #include "Profiler.h"
 
 class Widget;
+class Text;
 class Console;
 class StatsOverlay;
 class CameraFrustum;
@@ -117,6 +119,7 @@ public:
     const std::vector<DebugDraw>& GetDebugDraws() const;
 
     const std::vector<LightData>& GetLightData() const;
+    LightGrid& GetLightGrid();
 
     void BeginLightBake();
     void EndLightBake();
@@ -193,8 +196,10 @@ private:
 
     void GatherDrawData(World* world);
     void GatherLightData(World* world);
+    void SortLightData(Camera3D* camera);
     void RenderDraws(const std::vector<DrawData>& drawData);
     void RenderDraws(const std::vector<DrawData>& drawData, PipelineConfig pipelineConfig);
+    void RenderWidgetDraws(const std::vector<DrawData>& drawData);
     void RenderDebugDraws(const std::vector<DebugDraw>& draws, PipelineConfig pipelineConfig = PipelineConfig::Count);
     void FrustumCull(Camera3D* camera);
     int32_t FrustumCullDraws(const CameraFrustum& frustum, std::vector<DrawData>& drawData);
@@ -221,8 +226,10 @@ private:
     std::vector<DrawData> mTranslucentDraws;
     std::vector<DrawData> mWireframeDraws;
     std::vector<DrawData> mWidgetDraws;
+    std::vector<Text*> mTextBatch;
 
     std::vector<LightData> mLightData;
+    LightGrid mLightGrid;
 
     std::vector<DebugDraw> mDebugDraws;
     std::vector<DebugDraw> mCollisionDraws;
@@ -99,6 +99,22 @@ void Script::Tick(float deltaTime)
     }
 }
 
+void Script::FixedTick(float deltaTime)
+{
+#if LUA_ENABLED
+    if (IsActive() && mFixedTickEnabled)
+    {
+        CallFunction("FixedTick", deltaTime);
+    }
+#endif
+}
+
+bool Script::NeedsTick() const
+{
+    // Replicated script variables are downloaded from Tick() on the server.
+    return mTickEnabled || mFixedTickEnabled || mEditorTickEnabled || !mReplicatedData.empty();
+}
+
 void Script::AppendScriptProperties(std::vector<Property>& outProps)
 {
     for (uint32_t i = 0; i < mScriptProps.size(); ++i)
@@ -1626,6 +1642,8 @@ void Script::CreateScriptInstance()
             lua_setfield(L, uvIdx, OCT_CLASS_TABLE_KEY); // Pops script class metatable
 
             mTickEnabled = CheckIfFunctionExists("Tick");
+            mFixedTickEnabled = CheckIfFunctionExists("FixedTick");
+            mEditorTickEnabled = CheckIfFunctionExists("EditorTick");
             mHandleBeginOverlap = CheckIfFunctionExists("BeginOverlap");
             mHandleEndOverlap = CheckIfFunctionExists("EndOverlap");
             mHandleOnCollision = CheckIfFunctionExists("OnCollision");
@@ -1645,6 +1663,11 @@ void Script::CreateScriptInstance()
                 RegisterNetFuncs();
             }
 
+            if (mOwner->GetWorld() != nullptr)
+            {
+                mOwner->GetWorld()->UpdateTickRegistration(mOwner);
+            }
+
             // Create used to be called here, but then we couldn't assign default values in Create().
             //CallFunction("Create");
         }
@@ -1700,9 +1723,16 @@ void Script::DestroyScriptInstance()
     }
 
     mTickEnabled = false;
+    mFixedTickEnabled = false;
+    mEditorTickEnabled = false;
     mHandleBeginOverlap = false;
     mHandleEndOverlap = false;
     mHandleOnCollision = false;
+
+    if (mOwner->GetWorld() != nullptr)
+    {
+        mOwner->GetWorld()->UpdateTickRegistration(mOwner);
+    }
 #endif
 }
 
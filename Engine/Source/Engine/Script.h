@@ -28,6 +28,8 @@ public:
     Node* GetOwner();
 
     virtual void Tick(float deltaTime);
+    void FixedTick(float deltaTime);
+    bool NeedsTick() const;
 
     void AppendScriptProperties(std::vector<Property>& outProps);
 
@@ -125,6 +127,8 @@ protected:
     std::vector<Property> mScriptProps;
     std::vector<ScriptNetDatum> mReplicatedData;
     bool mTickEnabled = false;
+    bool mFixedTickEnabled = false;
+    bool mEditorTickEnabled = false;
     bool mHandleBeginOverlap = false;
     bool mHandleEndOverlap = false;
     bool mHandleOnCollision = false;
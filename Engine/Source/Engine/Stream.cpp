@@ -20,6 +20,7 @@ Stream::Stream() :
     mCapacity(0),
     mPos(0),
     mAsyncRequest(nullptr),
+    mWrittenAssets(nullptr),
     mExternal(false)
 {
 
@@ -32,6 +33,7 @@ Stream::Stream(const char* externalData, uint32_t externalSize) :
     mCapacity(externalSize),
     mPos(0),
     mAsyncRequest(nullptr),
+    mWrittenAssets(nullptr),
     mExternal(true)
 {
 
@@ -141,18 +143,25 @@ void Stream::ReadFile(const char* path, bool isAsset, int32_t maxSize)
 #endif
 }
 
-void Stream::WriteFile(const char* path)
+bool Stream::WriteFile(const char* path)
 {
+    bool success = false;
     FILE* file = fopen(path, "wb");
     OCT_ASSERT(file != nullptr);
 
     if (file != nullptr)
     {
-        fwrite(mData, mSize, 1, file);
-
-        fclose(file);
+        success = (mSize == 0 || fwrite(mData, mSize, 1, file) == 1);
+        success = (fclose(file) == 0) && success;
         file = nullptr;
     }
+
+    if (!success)
+    {
+        LogError("Failed to write file: %s", path);
+    }
+
+    return success;
 }
 
 void Stream::SetAsyncRequest(AsyncLoadRequest* request)
@@ -160,6 +169,11 @@ void Stream::SetAsyncRequest(AsyncLoadRequest* request)
     mAsyncRequest = request;
 }
 
+void Stream::SetWrittenAssetList(std::vector<std::string>* assetNames)
+{
+    mWrittenAssets = assetNames;
+}
+
 void Stream::ReadAsset(AssetRef& asset)
 {
     // TODO: Resort to default asset if failed to load?
@@ -219,6 +233,11 @@ void Stream::WriteAsset(const AssetRef& asset)
     // Things like MaterialInstance shouldnt be saved since those are only temporary.
     std::string assetName = (asset.Get() && !asset.Get()->IsTransient()) ? asset.Get()->GetName() : "";
     WriteString(assetName);
+
+    if (mWrittenAssets != nullptr && assetName != "")
+    {
+        mWrittenAssets->push_back(assetName);
+    }
 }
 
 void Stream::ReadString(std::string& dst)
@@ -273,6 +292,42 @@ void Stream::ReadBytes(uint8_t* dst, uint32_t length)
     }
 }
 
+const char* Stream::ReadView(uint32_t length)
+{
+    OCT_ASSERT(mPos + length <= mSize);
+
+    const char* view = &mData[mPos];
+    mPos += length;
+    return view;
+}
+
+void Stream::ReadArray32(void* dst, uint32_t count)
+{
+    uint32_t length = count * sizeof(uint32_t);
+    ReadBytes(reinterpret_cast<uint8_t*>(dst), length);
+
+#if ENDIAN_SWAP
+    uint32_t* elements = reinterpret_cast<uint32_t*>(dst);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        Swap32(elements[i]);
+    }
+#endif
+}
+
+void Stream::WriteArray32(const void* src, uint32_t count)
+{
+#if ENDIAN_SWAP
+    const uint32_t* elements = reinterpret_cast<const uint32_t*>(src);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        WriteUint32(elements[i]);
+    }
+#else
+    WriteBytes(reinterpret_cast<const uint8_t*>(src), count * sizeof(uint32_t));
+#endif
+}
+
 uint32_t Stream::ReadBytesMax(uint8_t* dst, uint32_t length)
 {
     if (length > 0 && mPos < mSize)
@@ -31,10 +31,13 @@ public:
     void Resize(uint32_t size);
 
     void ReadFile(const char* path, bool isAsset, int32_t maxSize = 0);
-    void WriteFile(const char* path);
+    bool WriteFile(const char* path);
 
     void SetAsyncRequest(AsyncLoadRequest* request);
 
+    // When set, the name of every asset passed to WriteAsset() is appended to the list.
+    void SetWrittenAssetList(std::vector<std::string>* assetNames);
+
     void ReadAsset(AssetRef& asset);
     void WriteAsset(const AssetRef& asset);
 
@@ -46,6 +49,53 @@ public:
 
     uint32_t ReadBytesMax(uint8_t* dst, uint32_t length);
 
+    // Returns a pointer to the next length bytes in the stream without copying them.
+    const char* ReadView(uint32_t length);
+
+    // Bulk arrays of 4 byte elements (float / int32 / uint32, or structs made only of them).
+    // The data is copied with one memcpy and only byte swapped in place on ENDIAN_SWAP platforms.
+    void ReadArray32(void* dst, uint32_t count);
+    void WriteArray32(const void* src, uint32_t count);
+
+    // Arrays serialized as uint32 that may be held in a narrower type in memory (e.g. 16 bit indices).
+    template<typename T>
+    void ReadUint32Array(T* dst, uint32_t count)
+    {
+        if (sizeof(T) == sizeof(uint32_t))
+        {
+            ReadArray32(dst, count);
+        }
+        else
+        {
+            const char* src = ReadView(count * sizeof(uint32_t));
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                uint32_t value;
+                memcpy(&value, src + i * sizeof(uint32_t), sizeof(uint32_t));
+#if ENDIAN_SWAP
+                Swap32(value);
+#endif
+                dst[i] = T(value);
+            }
+        }
+    }
+
+    template<typename T>
+    void WriteUint32Array(const T* src, uint32_t count)
+    {
+        if (sizeof(T) == sizeof(uint32_t))
+        {
+            WriteArray32(src, count);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                WriteUint32(uint32_t(src[i]));
+            }
+        }
+    }
+
     int32_t ReadInt32();
     uint32_t ReadUint32();
     int16_t ReadInt16();
@@ -166,5 +216,6 @@ private:
     uint32_t mCapacity;
     uint32_t mPos;
     AsyncLoadRequest* mAsyncRequest;
+    std::vector<std::string>* mWrittenAssets;
     bool mExternal;
 };
@@ -24,9 +24,83 @@
 #include <btBulletDynamicsCommon.h>
 #include <BulletCollision/CollisionDispatch/btInternalEdgeUtility.h>
 #include <Bullet/BulletCollision/CollisionShapes/btTriangleShape.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
 
 using namespace std;
 
+static btITaskScheduler* sPhysicsTaskScheduler = nullptr;
+static bool sPhysicsTaskSchedulerFailed = false;
+
+static btITaskScheduler* GetPhysicsTaskScheduler()
+{
+    if (sPhysicsTaskScheduler == nullptr &&
+        !sPhysicsTaskSchedulerFailed)
+    {
+        // One scheduler (and its worker pool) is shared by every world. It is only null
+        // when the Bullet library was built without BT_THREADSAFE.
+        sPhysicsTaskScheduler = btCreateDefaultTaskScheduler();
+
+        if (sPhysicsTaskScheduler != nullptr)
+        {
+            btSetTaskScheduler(sPhysicsTaskScheduler);
+        }
+        else
+        {
+            sPhysicsTaskSchedulerFailed = true;
+        }
+    }
+
+    return sPhysicsTaskScheduler;
+}
+
+// Batched queries only go wide on a scheduler that multithreaded physics already created.
+// They never create one themselves, so a game with single threaded physics stays that way.
+static bool ShouldParallelizeQueries(size_t numQueries)
+{
+    return numQueries >= QUERY_BATCH_GRAIN_SIZE * 2 &&
+        sPhysicsTaskScheduler != nullptr;
+}
+
+// Queries only read the collision world, so each worker can run its share of a batch independently.
+struct RayTestBatchBody : public btIParallelForBody
+{
+    World* mWorld = nullptr;
+    const RayTestQuery* mRays = nullptr;
+    RayTestResult* mResults = nullptr;
+    uint8_t mCollisionMask = 0;
+    uint32_t mNumIgnoreObjects = 0;
+    btCollisionObject** mIgnoreObjects = nullptr;
+
+    virtual void forLoop(int iBegin, int iEnd) const override
+    {
+        for (int i = iBegin; i < iEnd; ++i)
+        {
+            mWorld->RayTest(mRays[i].mStart, mRays[i].mEnd, mCollisionMask, mResults[i], mNumIgnoreObjects, mIgnoreObjects);
+        }
+    }
+};
+
+struct SweepTestBatchBody : public btIParallelForBody
+{
+    World* mWorld = nullptr;
+    btConvexShape* mShape = nullptr;
+    const SweepTestQuery* mSweeps = nullptr;
+    SweepTestResult* mResults = nullptr;
+    uint8_t mCollisionMask = 0;
+    uint32_t mNumIgnoreObjects = 0;
+    btCollisionObject** mIgnoreObjects = nullptr;
+
+    virtual void forLoop(int iBegin, int iEnd) const override
+    {
+        for (int i = iBegin; i < iEnd; ++i)
+        {
+            mWorld->SweepTest(mShape, mSweeps[i].mStart, mSweeps[i].mEnd, mSweeps[i].mRotation, mCollisionMask, mResults[i], mNumIgnoreObjects, mIgnoreObjects);
+        }
+    }
+};
+
 bool ContactAddedHandler(btManifoldPoint& cp,
     const btCollisionObjectWrapper* colObj0Wrap,
     int partId0,
@@ -69,15 +143,8 @@ World::World() :
 {
     SCOPED_STAT("World()")
 
-    // Setup physics world
-    mCollisionConfig = new btDefaultCollisionConfiguration();
-    mCollisionDispatcher = new btCollisionDispatcher(mCollisionConfig);
-    mBroadphase = new btDbvtBroadphase();
-    mSolver = new btSequentialImpulseConstraintSolver();
-    mDynamicsWorld = new btDiscreteDynamicsWorld(mCollisionDispatcher, mBroadphase, mSolver, mCollisionConfig);
+    CreateDynamicsWorld(false);
     mDynamicsWorld->setGravity(btVector3(0, -10, 0));
-
-    mDefaultDynamicsWorld = mDynamicsWorld;
 }
 
 void World::Destroy()
@@ -87,15 +154,55 @@ void World::Destroy()
     OCT_ASSERT(mRootNode == nullptr);
     mActiveCamera = nullptr;
 
+    DestroyDynamicsWorld();
+}
+
+void World::CreateDynamicsWorld(bool multithreaded)
+{
+    OCT_ASSERT(mDynamicsWorld == nullptr);
+
+    mCollisionConfig = new btDefaultCollisionConfiguration();
+    mBroadphase = new btDbvtBroadphase();
+
+    if (multithreaded)
+    {
+        mCollisionDispatcher = new btCollisionDispatcherMt(mCollisionConfig);
+        mSolver = new btConstraintSolverPoolMt(BT_MAX_THREAD_COUNT);
+
+        // Islands too large for a single pooled solver are split across threads by this one.
+        mSolverMt = new btSequentialImpulseConstraintSolverMt();
+
+        mDynamicsWorld = new btDiscreteDynamicsWorldMt(
+            mCollisionDispatcher,
+            mBroadphase,
+            static_cast<btConstraintSolverPoolMt*>(mSolver),
+            mSolverMt,
+            mCollisionConfig);
+    }
+    else
+    {
+        mCollisionDispatcher = new btCollisionDispatcher(mCollisionConfig);
+        mSolver = new btSequentialImpulseConstraintSolver();
+        mDynamicsWorld = new btDiscreteDynamicsWorld(mCollisionDispatcher, mBroadphase, mSolver, mCollisionConfig);
+    }
+
+    mDefaultDynamicsWorld = mDynamicsWorld;
+    mMultithreadedPhysics = multithreaded;
+}
+
+void World::DestroyDynamicsWorld()
+{
     mDefaultDynamicsWorld = nullptr;
 
     delete mDynamicsWorld;
+    delete mSolverMt;
     delete mSolver;
     delete mBroadphase;
     delete mCollisionDispatcher;
     delete mCollisionConfig;
 
     mDynamicsWorld = nullptr;
+    mSolverMt = nullptr;
     mSolver = nullptr;
     mBroadphase = nullptr;
     mCollisionDispatcher = nullptr;
@@ -104,14 +211,20 @@ void World::Destroy()
 
 void World::FlushPendingDestroys()
 {
-    if (mRootNode != nullptr)
+    while (!mPendingDestroyNodes.empty())
     {
-        mRootNode->FlushPendingDestroys();
+        // Destructing a node unregisters it (and any pending descendants) from this list.
+        Node* node = mPendingDestroyNodes.back();
+        mPendingDestroyNodes.pop_back();
 
-        if (mRootNode->IsPendingDestroy())
+        if (node == mRootNode)
         {
             DestroyRootNode();
         }
+        else
+        {
+            Node::Destruct(node);
+        }
     }
 }
 
@@ -377,6 +490,93 @@ btDynamicsWorld* World::GetDynamicsWorld()
     return mDynamicsWorld;
 }
 
+void World::EnableMultithreadedPhysics(bool enable)
+{
+    if (mMultithreadedPhysics == enable)
+        return;
+
+    if (mDynamicsWorld != mDefaultDynamicsWorld)
+    {
+        LogError("Cannot change physics threading while the dynamics world is overridden");
+        return;
+    }
+
+    if (enable && GetPhysicsTaskScheduler() == nullptr)
+    {
+        LogWarning("Multithreaded physics is not supported on this platform");
+        return;
+    }
+
+    // Move every collision object into the new world with its existing filter.
+    struct MovedObject
+    {
+        btCollisionObject* mObject = nullptr;
+        int32_t mGroup = 0;
+        int32_t mMask = 0;
+    };
+
+    std::vector<MovedObject> objects;
+    btCollisionObjectArray& objectArray = mDynamicsWorld->getCollisionObjectArray();
+    objects.reserve(objectArray.size());
+
+    for (int32_t i = objectArray.size() - 1; i >= 0; --i)
+    {
+        MovedObject moved;
+        moved.mObject = objectArray[i];
+        moved.mGroup = moved.mObject->getBroadphaseHandle()->m_collisionFilterGroup;
+        moved.mMask = moved.mObject->getBroadphaseHandle()->m_collisionFilterMask;
+        objects.push_back(moved);
+
+        mDynamicsWorld->removeCollisionObject(moved.mObject);
+    }
+
+    btVector3 gravity = mDynamicsWorld->getGravity();
+    btContactSolverInfo solverInfo = mDynamicsWorld->getSolverInfo();
+
+    DestroyDynamicsWorld();
+    CreateDynamicsWorld(enable);
+
+    mDynamicsWorld->setGravity(gravity);
+    mDynamicsWorld->getSolverInfo() = solverInfo;
+
+    for (int32_t i = int32_t(objects.size()) - 1; i >= 0; --i)
+    {
+        btRigidBody* body = btRigidBody::upcast(objects[i].mObject);
+
+        if (body != nullptr)
+        {
+            mDynamicsWorld->addRigidBody(body, objects[i].mGroup, objects[i].mMask);
+        }
+        else
+        {
+            mDynamicsWorld->addCollisionObject(objects[i].mObject, objects[i].mGroup, objects[i].mMask);
+        }
+    }
+
+    // Overlap tracking holds primitive pairs, not broadphase pairs, so it carries over as is.
+    LogDebug("World physics is now %s", enable ? "multithreaded" : "single threaded");
+}
+
+bool World::IsMultithreadedPhysicsEnabled() const
+{
+    return mMultithreadedPhysics;
+}
+
+const PhysicsStats& World::GetPhysicsStats() const
+{
+    return mPhysicsStats;
+}
+
+void World::ShutdownPhysicsThreads()
+{
+    if (sPhysicsTaskScheduler != nullptr)
+    {
+        btSetTaskScheduler(btGetSequentialTaskScheduler());
+        delete sPhysicsTaskScheduler;
+        sPhysicsTaskScheduler = nullptr;
+    }
+}
+
 btDbvtBroadphase* World::GetBroadphase()
 {
     return mBroadphase;
@@ -454,6 +654,66 @@ void World::RayTestMulti(glm::vec3 start, glm::vec3 end, uint8_t collisionMask,
     }
 }
 
+void World::RayTestBatch(
+    const std::vector<RayTestQuery>& rays,
+    uint8_t collisionMask,
+    std::vector<RayTestResult>& outResults,
+    uint32_t numIgnoredObjects,
+    btCollisionObject** ignoreObjects)
+{
+    SCOPED_STAT("RayTestBatch");
+
+    outResults.resize(rays.size());
+
+    RayTestBatchBody body;
+    body.mWorld = this;
+    body.mRays = rays.data();
+    body.mResults = outResults.data();
+    body.mCollisionMask = collisionMask;
+    body.mNumIgnoreObjects = numIgnoredObjects;
+    body.mIgnoreObjects = ignoreObjects;
+
+    if (ShouldParallelizeQueries(rays.size()))
+    {
+        btParallelFor(0, int(rays.size()), QUERY_BATCH_GRAIN_SIZE, body);
+    }
+    else
+    {
+        body.forLoop(0, int(rays.size()));
+    }
+}
+
+void World::SweepTestBatch(
+    btConvexShape* convexShape,
+    const std::vector<SweepTestQuery>& sweeps,
+    uint8_t collisionMask,
+    std::vector<SweepTestResult>& outResults,
+    uint32_t numIgnoreObjects,
+    btCollisionObject** ignoreObjects)
+{
+    SCOPED_STAT("SweepTestBatch");
+
+    outResults.resize(sweeps.size());
+
+    SweepTestBatchBody body;
+    body.mWorld = this;
+    body.mShape = convexShape;
+    body.mSweeps = sweeps.data();
+    body.mResults = outResults.data();
+    body.mCollisionMask = collisionMask;
+    body.mNumIgnoreObjects = numIgnoreObjects;
+    body.mIgnoreObjects = ignoreObjects;
+
+    if (ShouldParallelizeQueries(sweeps.size()))
+    {
+        btParallelFor(0, int(sweeps.size()), QUERY_BATCH_GRAIN_SIZE, body);
+    }
+    else
+    {
+        body.forLoop(0, int(sweeps.size()));
+    }
+}
+
 void World::SweepTest(Primitive3D* primComp, glm::vec3 start, glm::vec3 end, uint8_t collisionMask, SweepTestResult& outResult)
 {
     if (primComp->GetCollisionShape() == nullptr ||
@@ -559,12 +819,44 @@ void World::RegisterNode(Node* node)
     {
         AddNodeToRepVector(node);
     }
+
+    UpdateTickRegistration(node);
+
+    if (node->IsNode3D() &&
+        static_cast<Node3D*>(node)->IsTransformDirty())
+    {
+        QueueTransformUpdate(static_cast<Node3D*>(node));
+    }
+
+    if (node->IsNode3D() &&
+        static_cast<Node3D*>(node)->IsTransformInterpolationEnabled())
+    {
+        AddInterpolatedNode(static_cast<Node3D*>(node));
+    }
+
+    if (!node->HasStarted())
+    {
+        mPendingStartNodes.push_back(node);
+    }
+
+    if (node->IsPendingDestroy())
+    {
+        AddPendingDestroy(node);
+    }
+
+#if EDITOR
+    GetEditorState()->HandleNodeChanged(node);
+#endif
 }
 
 void World::UnregisterNode(Node* node)
 {
     TypeId nodeType = node->GetType();
 
+#if EDITOR
+    GetEditorState()->HandleNodeRemoved(node);
+#endif
+
     if (nodeType == Audio3D::GetStaticType())
     {
         auto it = std::find(mAudios.begin(), mAudios.end(), (Audio3D*)node);
@@ -592,6 +884,280 @@ void World::UnregisterNode(Node* node)
     {
         RemoveNodeFromRepVector(node);
     }
+
+    RemoveTickNode(node);
+
+    if (node->IsNode3D())
+    {
+        DequeueTransformUpdate(static_cast<Node3D*>(node));
+        RemoveInterpolatedNode(static_cast<Node3D*>(node));
+    }
+
+    if (!mPendingStartNodes.empty())
+    {
+        // Clear instead of erase, the list may be getting iterated in StartPendingNodes().
+        auto it = std::find(mPendingStartNodes.begin(), mPendingStartNodes.end(), node);
+        if (it != mPendingStartNodes.end())
+        {
+            *it = nullptr;
+        }
+    }
+
+    if (node->IsPendingDestroy())
+    {
+        RemovePendingDestroy(node);
+    }
+}
+
+void World::UpdateTickRegistration(Node* node)
+{
+    bool registered = (node->GetTickListIndex() != -1);
+    bool shouldRegister = (node->GetWorld() == this);
+
+    // Nodes beneath a widget are ticked recursively by their top-most widget (see Widget::GroupTick).
+    // Top-most widgets always register so their tree can refresh dirty state even if they don't tick.
+    for (Node* parent = node->GetParent(); parent != nullptr && shouldRegister; parent = parent->GetParent())
+    {
+        shouldRegister = !parent->IsWidget();
+    }
+
+    shouldRegister = shouldRegister && (node->IsWidget() || (node->IsTickEnabled() && node->NeedsTick()));
+
+    if (shouldRegister && !registered)
+    {
+        AddTickNode(node);
+    }
+    else if (!shouldRegister && registered)
+    {
+        RemoveTickNode(node);
+    }
+}
+
+void World::AddTickNode(Node* node)
+{
+    OCT_ASSERT(node->GetTickListIndex() == -1);
+    std::vector<Node*>& tickList = mTickNodes[(uint32_t)node->GetTickGroup()];
+
+    node->SetTickListIndex((int32_t)tickList.size());
+    tickList.push_back(node);
+}
+
+void World::RemoveTickNode(Node* node)
+{
+    int32_t index = node->GetTickListIndex();
+
+    if (index != -1)
+    {
+        uint32_t group = (uint32_t)node->GetTickGroup();
+        std::vector<Node*>& tickList = mTickNodes[group];
+        OCT_ASSERT(index < (int32_t)tickList.size() && tickList[index] == node);
+
+        // Leave a hole so that indices stay valid while ticking. Holes are removed in CompactTickList().
+        tickList[index] = nullptr;
+        mNumRemovedTickNodes[group]++;
+        node->SetTickListIndex(-1);
+    }
+}
+
+void World::CompactTickList(TickGroup group)
+{
+    std::vector<Node*>& tickList = mTickNodes[(uint32_t)group];
+    uint32_t& numRemoved = mNumRemovedTickNodes[(uint32_t)group];
+
+    if (numRemoved > 0)
+    {
+        uint32_t dst = 0;
+
+        for (uint32_t src = 0; src < tickList.size(); ++src)
+        {
+            if (tickList[src] != nullptr)
+            {
+                tickList[dst] = tickList[src];
+                tickList[dst]->SetTickListIndex((int32_t)dst);
+                ++dst;
+            }
+        }
+
+        tickList.resize(dst);
+        numRemoved = 0;
+    }
+}
+
+void World::TickNodes(TickGroup group, float deltaTime, bool game)
+{
+    CompactTickList(group);
+    std::vector<Node*>& tickList = mTickNodes[(uint32_t)group];
+
+    // Nodes spawned during this loop are appended and will tick this frame (except in the Late group).
+    // Pending nodes are started before the first one reaches its Tick(), so a node spawned by an
+    // earlier tick still runs Start() first.
+    if (group == TickGroup::Late)
+    {
+        // Iterate backwards so that nodes registered later (usually children) tick first.
+        for (int32_t i = (int32_t)tickList.size() - 1; i >= 0; --i)
+        {
+            Node* node = tickList[i];
+
+            if (node != nullptr)
+            {
+                if (game && !node->HasStarted())
+                {
+                    StartPendingNodes();
+                }
+
+                node->GroupTick(deltaTime, game);
+            }
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < tickList.size(); ++i)
+        {
+            Node* node = tickList[i];
+
+            if (node != nullptr)
+            {
+                if (game && !node->HasStarted())
+                {
+                    StartPendingNodes();
+                }
+
+                node->GroupTick(deltaTime, game);
+            }
+        }
+    }
+}
+
+void World::StartPendingNodes()
+{
+    // Start() can spawn and destroy nodes, so iterate by index and skip cleared entries.
+    for (uint32_t i = 0; i < mPendingStartNodes.size(); ++i)
+    {
+        Node* node = mPendingStartNodes[i];
+
+        if (node != nullptr && !node->HasStarted())
+        {
+            node->Start();
+        }
+    }
+
+    mPendingStartNodes.clear();
+}
+
+uint32_t World::GetNumTickNodes(TickGroup group) const
+{
+    OCT_ASSERT(group != TickGroup::Count);
+    return uint32_t(mTickNodes[(uint32_t)group].size()) - mNumRemovedTickNodes[(uint32_t)group];
+}
+
+void World::QueueTransformUpdate(Node3D* node)
+{
+    if (node->GetTransformQueueIndex() == -1)
+    {
+        node->SetTransformQueueIndex((int32_t)mDirtyTransforms.size());
+        mDirtyTransforms.push_back(node);
+    }
+}
+
+void World::DequeueTransformUpdate(Node3D* node)
+{
+    int32_t index = node->GetTransformQueueIndex();
+
+    if (index != -1)
+    {
+        OCT_ASSERT(index < (int32_t)mDirtyTransforms.size() && mDirtyTransforms[index] == node);
+        mDirtyTransforms[index] = nullptr;
+        node->SetTransformQueueIndex(-1);
+    }
+}
+
+void World::QueuePhysicsWriteBack(Primitive3D* prim)
+{
+    mPhysicsWriteBacks.push_back(prim);
+}
+
+void World::ApplyPhysicsWriteBacks()
+{
+    // Bullet skips sleeping bodies when synchronizing motion states, so only
+    // the bodies that actually moved during the step end up in this list.
+    for (uint32_t i = 0; i < mPhysicsWriteBacks.size(); ++i)
+    {
+        Primitive3D* prim = mPhysicsWriteBacks[i];
+        prim->GetMotionState()->mWriteBackQueued = false;
+        prim->ApplyPhysicsTransform();
+    }
+
+    mPhysicsWriteBacks.clear();
+}
+
+void World::UpdateDirtyTransforms()
+{
+    // Updating a node marks its Node3D children dirty, which queues them for the next batch.
+    // So each iteration of this loop handles the next level down of the dirty subtrees.
+    while (!mDirtyTransforms.empty())
+    {
+        mUpdatingTransforms.clear();
+
+        for (uint32_t i = 0; i < mDirtyTransforms.size(); ++i)
+        {
+            Node3D* node = mDirtyTransforms[i];
+
+            if (node != nullptr)
+            {
+                node->SetTransformQueueIndex(-1);
+
+                // Transforms can be updated lazily (e.g. GetTransform()) after being queued.
+                if (node->IsTransformDirty())
+                {
+                    QueuedTransform queued;
+                    queued.mNode = node;
+
+                    for (Node* parent = node->GetParent(); parent != nullptr; parent = parent->GetParent())
+                    {
+                        queued.mDepth++;
+                    }
+
+                    mUpdatingTransforms.push_back(queued);
+                }
+            }
+        }
+
+        mDirtyTransforms.clear();
+
+        // Update parents before children so each node only has its transform computed once.
+        std::sort(mUpdatingTransforms.begin(), mUpdatingTransforms.end(),
+            [](const QueuedTransform& a, const QueuedTransform& b)
+            {
+                return a.mDepth < b.mDepth;
+            });
+
+        for (uint32_t i = 0; i < mUpdatingTransforms.size(); ++i)
+        {
+            Node3D* node = mUpdatingTransforms[i].mNode;
+
+            if (node->IsTransformDirty())
+            {
+                node->UpdateTransform(false);
+            }
+        }
+    }
+}
+
+void World::AddPendingDestroy(Node* node)
+{
+#if _DEBUG
+    OCT_ASSERT(std::find(mPendingDestroyNodes.begin(), mPendingDestroyNodes.end(), node) == mPendingDestroyNodes.end());
+#endif
+    mPendingDestroyNodes.push_back(node);
+}
+
+void World::RemovePendingDestroy(Node* node)
+{
+    auto it = std::find(mPendingDestroyNodes.begin(), mPendingDestroyNodes.end(), node);
+    if (it != mPendingDestroyNodes.end())
+    {
+        mPendingDestroyNodes.erase(it);
+    }
 }
 
 const std::vector<Audio3D*>& World::GetAudios() const
@@ -698,10 +1264,64 @@ void World::Update(float deltaTime)
         }
     }
 
+    if (gameTickEnabled)
+    {
+        StartPendingNodes();
+    }
+#if EDITOR
+    else if (!IsPlayingInEditor())
+    {
+        // Nodes never start while editing. Play In Editor registers a fresh clone of the scene.
+        mPendingStartNodes.clear();
+    }
+#endif
+
+    {
+        SCOPED_FRAME_STAT("Tick");
+        TickNodes(TickGroup::PrePhysics, deltaTime, gameTickEnabled);
+    }
+
     if (gameTickEnabled)
     {
         SCOPED_FRAME_STAT("Physics");
-        mDynamicsWorld->stepSimulation(deltaTime, 2);
+
+        if (IsFixedTickEnabled())
+        {
+            float fixedDeltaTime = 1.0f / mFixedTickRate;
+            uint32_t numTicks = 0;
+            mFixedTimeAccumulator += deltaTime;
+
+            while (mFixedTimeAccumulator >= fixedDeltaTime &&
+                numTicks < MAX_FIXED_TICKS_PER_FRAME)
+            {
+                for (uint32_t i = 0; i < mInterpolatedNodes.size(); ++i)
+                {
+                    if (mInterpolatedNodes[i] != nullptr)
+                    {
+                        mInterpolatedNodes[i]->SaveFixedTransform();
+                    }
+                }
+
+                FixedTickNodes(fixedDeltaTime);
+
+                // Push transforms moved by FixedTick() into Bullet before it steps.
+                UpdateDirtyTransforms();
+
+                // A max of 0 substeps makes Bullet take exactly one step of the given length.
+                StepPhysics(fixedDeltaTime, 0);
+
+                mFixedTimeAccumulator -= fixedDeltaTime;
+                ++numTicks;
+            }
+
+            // Drop the backlog after a long hitch instead of trying to catch up over the next frames.
+            mFixedTimeAccumulator = glm::min(mFixedTimeAccumulator, fixedDeltaTime);
+            mFixedTickAlpha = mFixedTimeAccumulator / fixedDeltaTime;
+        }
+        else
+        {
+            StepPhysics(deltaTime, 2);
+        }
     }
 
     if (gameTickEnabled)
@@ -797,38 +1417,133 @@ void World::Update(float deltaTime)
 
     {
         SCOPED_FRAME_STAT("Tick");
-        if (mRootNode != nullptr)
+        TickNodes(TickGroup::PostPhysics, deltaTime, gameTickEnabled);
+        TickNodes(TickGroup::Late, deltaTime, gameTickEnabled);
+    }
+
+    FlushPendingDestroys();
+
+    {
+        // Make sure transforms are updated so that the bullet dynamics world is in sync.
+        SCOPED_FRAME_STAT("Transforms");
+        UpdateDirtyTransforms();
+
+        if (IsFixedTickEnabled())
         {
-            mRootNode->RecursiveTick(deltaTime, gameTickEnabled);
+            // Fixed ticks don't run while editing, so show the current transforms.
+            UpdateInterpolatedTransforms(gameTickEnabled ? mFixedTickAlpha : 1.0f);
         }
     }
+}
+
+void World::StepPhysics(float deltaTime, int32_t maxSubSteps)
+{
+    mDynamicsWorld->stepSimulation(deltaTime, maxSubSteps);
+
+    mPhysicsStats.mNumThreads = mMultithreadedPhysics ? uint32_t(sPhysicsTaskScheduler->getNumThreads()) : 1;
+    mPhysicsStats.mNumBodies = uint32_t(mDynamicsWorld->getNumCollisionObjects());
+    mPhysicsStats.mNumMovedBodies = uint32_t(mPhysicsWriteBacks.size());
+    mPhysicsStats.mNumManifolds = uint32_t(mCollisionDispatcher->getNumManifolds());
+
+    ApplyPhysicsWriteBacks();
+}
 
+void World::FixedTickNodes(float deltaTime)
+{
+    for (uint32_t g = 0; g < (uint32_t)TickGroup::Count; ++g)
     {
-        // TODO-NODE: Adding this! Make sure it works. I think we need to
-        // make sure transforms are updated so that the bullet dynamics world is in sync.
-        // But maybe not and we only need to update transforms when getting world pos/rot/scale/transform
-        SCOPED_FRAME_STAT("Transforms");
-        if (mRootNode != nullptr)
+        std::vector<Node*>& tickList = mTickNodes[g];
+
+        // Nodes spawned during a fixed tick are appended and will also tick.
+        for (uint32_t i = 0; i < tickList.size(); ++i)
         {
-            auto update3dTransform = [](Node* node) -> bool
+            Node* node = tickList[i];
+
+            // Widget trees are UI only and don't take part in the simulation.
+            if (node != nullptr &&
+                !node->IsWidget() &&
+                node->HasStarted() &&
+                node->CanTick())
             {
-                if (node->IsNode3D())
-                {
-                    Node3D* node3d = (Node3D*)node;
-                    if (node3d->IsTransformDirty())
-                    {
-                        node3d->UpdateTransform(false);
-                    }
-                }
+                node->FixedTick(deltaTime);
+            }
+        }
+    }
+}
+
+void World::UpdateInterpolatedTransforms(float alpha)
+{
+    // Compact out removed nodes while blending the rest.
+    uint32_t numNodes = 0;
+
+    for (uint32_t i = 0; i < mInterpolatedNodes.size(); ++i)
+    {
+        Node3D* node = mInterpolatedNodes[i];
+
+        if (node != nullptr)
+        {
+            node->SetInterpolationIndex(int32_t(numNodes));
+            node->UpdateInterpolatedTransform(alpha);
+            mInterpolatedNodes[numNodes] = node;
+            ++numNodes;
+        }
+    }
+
+    mInterpolatedNodes.resize(numNodes);
+}
 
-                return true;
-            };
+void World::SetFixedTickRate(float rate)
+{
+    mFixedTickRate = glm::max(rate, 0.0f);
+    mFixedTimeAccumulator = 0.0f;
+    mFixedTickAlpha = 1.0f;
 
-            mRootNode->Traverse(update3dTransform);
+    for (uint32_t i = 0; i < mInterpolatedNodes.size(); ++i)
+    {
+        if (mInterpolatedNodes[i] != nullptr)
+        {
+            mInterpolatedNodes[i]->ResetTransformInterpolation();
         }
     }
 }
 
+float World::GetFixedTickRate() const
+{
+    return mFixedTickRate;
+}
+
+bool World::IsFixedTickEnabled() const
+{
+    return (mFixedTickRate > 0.0f);
+}
+
+float World::GetFixedTickAlpha() const
+{
+    return mFixedTickAlpha;
+}
+
+void World::AddInterpolatedNode(Node3D* node)
+{
+    if (node->GetInterpolationIndex() == -1)
+    {
+        node->SetInterpolationIndex(int32_t(mInterpolatedNodes.size()));
+        node->ResetTransformInterpolation();
+        mInterpolatedNodes.push_back(node);
+    }
+}
+
+void World::RemoveInterpolatedNode(Node3D* node)
+{
+    int32_t index = node->GetInterpolationIndex();
+
+    if (index != -1)
+    {
+        OCT_ASSERT(index < (int32_t)mInterpolatedNodes.size() && mInterpolatedNodes[index] == node);
+        mInterpolatedNodes[index] = nullptr;
+        node->SetInterpolationIndex(-1);
+    }
+}
+
 Camera3D* World::GetActiveCamera()
 {
 #if EDITOR
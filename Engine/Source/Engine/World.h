@@ -21,6 +21,20 @@ class Node;
 class Audio3D;
 class Particle3D;
 
+struct PhysicsStats
+{
+    uint32_t mNumThreads = 1;
+    uint32_t mNumBodies = 0;
+    uint32_t mNumMovedBodies = 0;
+    uint32_t mNumManifolds = 0;
+};
+
+struct QueuedTransform
+{
+    Node3D* mNode = nullptr;
+    uint32_t mDepth = 0;
+};
+
 class World
 {
 public:
@@ -83,6 +97,22 @@ public:
 
     btDynamicsWorld* GetDynamicsWorld();
     btDbvtBroadphase* GetBroadphase();
+
+    // Rebuilds the dynamics world with Bullet's multithreaded world, dispatcher and solver pool.
+    // Falls back to single threaded stepping if the Bullet library wasn't built with BT_THREADSAFE.
+    void EnableMultithreadedPhysics(bool enable);
+    bool IsMultithreadedPhysicsEnabled() const;
+    const PhysicsStats& GetPhysicsStats() const;
+    static void ShutdownPhysicsThreads();
+
+    // When the rate (in Hz) is above 0, physics and Node::FixedTick() run at that constant rate
+    // and interpolated Node3Ds are rendered between fixed ticks. Otherwise physics follows the frame delta.
+    void SetFixedTickRate(float rate);
+    float GetFixedTickRate() const;
+    bool IsFixedTickEnabled() const;
+    float GetFixedTickAlpha() const;
+    void AddInterpolatedNode(Node3D* node);
+    void RemoveInterpolatedNode(Node3D* node);
     void PurgeOverlaps(Primitive3D* prim);
 
     void RayTest(
@@ -116,8 +146,33 @@ public:
         uint32_t numIgnoreObjects = 0,
         btCollisionObject** ignoreObjects = nullptr);
 
+    // Batched queries write one result per query, in order. Large batches are split
+    // across the physics worker threads when the platform supports them.
+    void RayTestBatch(
+        const std::vector<RayTestQuery>& rays,
+        uint8_t collisionMask,
+        std::vector<RayTestResult>& outResults,
+        uint32_t numIgnoredObjects = 0,
+        btCollisionObject** ignoreObjects = nullptr);
+
+    void SweepTestBatch(
+        btConvexShape* convexShape,
+        const std::vector<SweepTestQuery>& sweeps,
+        uint8_t collisionMask,
+        std::vector<SweepTestResult>& outResults,
+        uint32_t numIgnoreObjects = 0,
+        btCollisionObject** ignoreObjects = nullptr);
+
     void RegisterNode(Node* node);
     void UnregisterNode(Node* node);
+    void UpdateTickRegistration(Node* node);
+    void RemoveTickNode(Node* node);
+    void AddPendingDestroy(Node* node);
+    void RemovePendingDestroy(Node* node);
+    uint32_t GetNumTickNodes(TickGroup group) const;
+    void QueueTransformUpdate(Node3D* node);
+    void DequeueTransformUpdate(Node3D* node);
+    void QueuePhysicsWriteBack(Primitive3D* prim);
     const std::vector<Audio3D*>& GetAudios() const;
 
     std::vector<Node*>& GetReplicatedNodeVector(ReplicationRate rate);
@@ -191,6 +246,17 @@ public:
 private:
 
     void UpdateLines(float deltaTime);
+    void AddTickNode(Node* node);
+    void CompactTickList(TickGroup group);
+    void TickNodes(TickGroup group, float deltaTime, bool game);
+    void StartPendingNodes();
+    void UpdateDirtyTransforms();
+    void ApplyPhysicsWriteBacks();
+    void StepPhysics(float deltaTime, int32_t maxSubSteps);
+    void FixedTickNodes(float deltaTime);
+    void UpdateInterpolatedTransforms(float alpha);
+    void CreateDynamicsWorld(bool multithreaded);
+    void DestroyDynamicsWorld();
 
 private:
 
@@ -212,14 +278,38 @@ private:
     uint32_t mIncrementalRepTier = 0;
     uint32_t mIncrementalRepIndex = 0;
 
+    // Tick lists, in registration order. Parents usually precede their children, but a node that
+    // re-registers (EnableTick, SetTickGroup, script reload) moves to the end, so ticks must not
+    // rely on hierarchy order.
+    std::vector<Node*> mTickNodes[(uint32_t)TickGroup::Count];
+    uint32_t mNumRemovedTickNodes[(uint32_t)TickGroup::Count] = {};
+    std::vector<Node*> mPendingStartNodes;
+    std::vector<Node*> mPendingDestroyNodes;
+
+    // Node3Ds that were marked dirty since the last transform pass
+    std::vector<Node3D*> mDirtyTransforms;
+    std::vector<QueuedTransform> mUpdatingTransforms;
+
     // Physics
     btDefaultCollisionConfiguration* mCollisionConfig = nullptr;
     btCollisionDispatcher* mCollisionDispatcher = nullptr;
     btDbvtBroadphase* mBroadphase = nullptr;
-    btSequentialImpulseConstraintSolver* mSolver = nullptr;
+    btConstraintSolver* mSolver = nullptr;
+    btConstraintSolver* mSolverMt = nullptr;
     btDiscreteDynamicsWorld* mDynamicsWorld = nullptr;
     btDiscreteDynamicsWorld* mDefaultDynamicsWorld = nullptr;;
     std::vector<PrimitivePair> mCurrentOverlaps;
     std::vector<PrimitivePair> mPreviousOverlaps;
 
+    // Physics bodies whose motion state Bullet updated during the last step
+    std::vector<Primitive3D*> mPhysicsWriteBacks;
+    PhysicsStats mPhysicsStats;
+    bool mMultithreadedPhysics = false;
+
+    // Fixed tick
+    float mFixedTickRate = 0.0f;
+    float mFixedTimeAccumulator = 0.0f;
+    float mFixedTickAlpha = 1.0f;
+    std::vector<Node3D*> mInterpolatedNodes;
+
 };
\ No newline at end of file
@@ -1476,6 +1476,15 @@ void GFX_DrawText(Text* text)
     C3D_DrawArrays(GPU_TRIANGLES, 0, 6 * numVisibleChars);
 }
 
+void GFX_DrawTextBatch(Text* const* texts, uint32_t numTexts)
+{
+    // No shared streaming buffer on this platform, draw each widget individually.
+    for (uint32_t i = 0; i < numTexts; ++i)
+    {
+        GFX_DrawText(texts[i]);
+    }
+}
+
 // Poly
 void GFX_CreatePolyResource(Poly* poly)
 {
@@ -1216,6 +1216,15 @@ void GFX_DrawText(Text* text)
     //GX_SetTevSwapModeTable(GX_TEV_SWAP1, GX_CH_RED, GX_CH_GREEN, GX_CH_BLUE, GX_CH_ALPHA);
 }
 
+void GFX_DrawTextBatch(Text* const* texts, uint32_t numTexts)
+{
+    // No shared streaming buffer on this platform, draw each widget individually.
+    for (uint32_t i = 0; i < numTexts; ++i)
+    {
+        GFX_DrawText(texts[i]);
+    }
+}
+
 // Poly
 void GFX_CreatePolyResource(Poly* poly)
 {
@@ -29,6 +29,10 @@ struct FogSettings;
 void GFX_Initialize();
 void GFX_Shutdown();
 
+// True when running without a graphics device (dedicated servers, including a client build
+// started with -dedicated). GFX resource functions must not be called while headless.
+bool GFX_IsHeadless();
+
 void GFX_BeginFrame();
 void GFX_EndFrame();
 void GFX_BeginScreen(uint32_t screenIndex);
@@ -130,6 +134,7 @@ void GFX_CreateTextResource(Text* text);
 void GFX_DestroyTextResource(Text* text);
 void GFX_UpdateTextResourceVertexData(Text* text);
 void GFX_DrawText(Text* text);
+void GFX_DrawTextBatch(Text* const* texts, uint32_t numTexts);
 
 // Polygon
 void GFX_CreatePolyResource(Poly* poly);
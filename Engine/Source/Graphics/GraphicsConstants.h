@@ -20,4 +20,10 @@
 #define SYNC_ON_END_FRAME 0
 #define SUPPORTS_SECOND_SCREEN 1
 #define MAX_GPU_BONES 16
+#elif API_NULL
+#define MAX_FRAMES 1
+#define MAX_MESH_VERTEX_COUNT 4294967295
+#define SYNC_ON_END_FRAME 0
+#define SUPPORTS_SECOND_SCREEN 0
+#define MAX_GPU_BONES 64
 #endif
@@ -115,7 +115,7 @@ enum class WrapMode
     Count
 };
 
-#if API_VULKAN
+#if API_VULKAN || API_NULL
 typedef uint32_t IndexType;
 #else
 typedef uint16_t IndexType;
@@ -148,6 +148,7 @@ struct StaticMeshResource
 #if API_VULKAN
     Buffer* mVertexBuffer = nullptr;
     Buffer* mIndexBuffer = nullptr;
+    VkIndexType mIndexType = VK_INDEX_TYPE_UINT32;
 #elif API_GX
     void* mDisplayList = nullptr;
     uint32_t mDisplayListSize = 0;
@@ -164,6 +165,7 @@ struct SkeletalMeshResource
 #if API_VULKAN
     Buffer* mVertexBuffer = nullptr;
     Buffer* mIndexBuffer = nullptr;
+    VkIndexType mIndexType = VK_INDEX_TYPE_UINT32;
 #elif API_C3D
     void* mVertexData = nullptr;
     void* mIndexData = nullptr;
@@ -182,10 +184,18 @@ struct StaticMeshCompResource
 struct InstancedMeshCompResource
 {
 #if API_VULKAN
-    Buffer* mInstanceDataBuffer = nullptr;
+    // One device local buffer per frame in flight. A frame's buffer is only written once that frame
+    // comes around again, since earlier frames still on the GPU may be reading theirs.
+    Buffer* mInstanceDataBuffers[MAX_FRAMES] = {};
     Buffer* mVertexColorBuffer = nullptr;
+    uint32_t mInstanceCapacity = 0;
+    uint32_t mFrameDirtyStart[MAX_FRAMES] = {};
+    uint32_t mFrameDirtyEnd[MAX_FRAMES] = {};
 #endif
 
+    // Draw slots changed since the last upload. Ignored when mDirty is set.
+    uint32_t mDirtyStart = 0;
+    uint32_t mDirtyEnd = 0;
     bool mDirty = true;
 };
 
@@ -228,10 +238,7 @@ struct PolyResource
 
 struct TextResource
 {
-#if API_VULKAN
-    MultiBuffer* mVertexBuffer = nullptr;
-    uint32_t mNumBufferCharsAllocated = 0;
-#elif API_C3D
+#if API_C3D
     DoubleBuffer mVertexData;
     uint32_t mNumBufferCharsAllocated = 0;
 #endif
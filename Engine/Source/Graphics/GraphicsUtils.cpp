@@ -1,4 +1,7 @@
 #include "Graphics/GraphicsUtils.h"
+#include "Graphics/Graphics.h"
+
+#include "Engine.h"
 
 const char* GetRenderPassName(RenderPassId id)
 {
@@ -15,4 +18,10 @@ const char* GetRenderPassName(RenderPassId id)
     }
 
     return name;
-}
\ No newline at end of file
+}
+
+bool GFX_IsHeadless()
+{
+    // GFX_Initialize() is skipped for dedicated servers, so there is never a device to use.
+    return IsDedicatedServer();
+}
@@ -74,7 +74,11 @@ void Buffer::Update(const void* srcData, size_t srcSize, size_t dstOffset)
 
         if (mMappedPointer == nullptr)
         {
-            vkMapMemory(device, mMemory.mDeviceMemory, mMemory.mOffset, srcSize, 0, &data);
+            vkMapMemory(device, mMemory.mDeviceMemory, mMemory.mOffset + dstOffset, srcSize, 0, &data);
+        }
+        else
+        {
+            data = reinterpret_cast<uint8_t*>(mMappedPointer) + dstOffset;
         }
 
         memcpy(data, srcData, srcSize);
@@ -87,7 +91,7 @@ void Buffer::Update(const void* srcData, size_t srcSize, size_t dstOffset)
     else
     {
         Buffer* stagingBuffer = new Buffer(BufferType::Transfer, srcSize, "Staging Buffer", srcData);
-        CopyBuffer(stagingBuffer->Get(), mBuffer, srcSize);
+        CopyBuffer(stagingBuffer->Get(), mBuffer, srcSize, dstOffset);
         GetDestroyQueue()->Destroy(stagingBuffer);
     }
 }
@@ -42,6 +42,9 @@ void DestroyQueue::Destroy(MultiBuffer* multiBuffer)
 
 void DestroyQueue::Destroy(Shader* shader)
 {
+    // Pipelines built from this shader must not be resolved again (or finish building) after it's gone.
+    GetVulkanContext()->GetPipelineCache().RemoveShader(shader);
+
     uint32_t frameIndex = GetFrameIndex();
     mShaders[frameIndex].push_back(shader);
 }
@@ -76,7 +76,13 @@ void GFX_SetScissor(int32_t x, int32_t y, int32_t width, int32_t height, bool ha
 
 glm::mat4 GFX_MakePerspectiveMatrix(float fovyDegrees, float aspectRatio, float zNear, float zFar)
 {
-    VkSurfaceTransformFlagBitsKHR preTransformFlag = gVulkanContext->GetPreTransformFlag();
+    VkSurfaceTransformFlagBitsKHR preTransformFlag = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+
+    // There is no swapchain to match when running as a dedicated server.
+    if (gVulkanContext != nullptr)
+    {
+        preTransformFlag = gVulkanContext->GetPreTransformFlag();
+    }
 
     glm::mat4 preRotateMat = glm::mat4(1.0f);
     glm::vec3 rotationAxis = glm::vec3(0.0f, 0.0f, 1.0f);
@@ -102,7 +108,13 @@ glm::mat4 GFX_MakePerspectiveMatrix(float fovyDegrees, float aspectRatio, float
 
 glm::mat4 GFX_MakeOrthographicMatrix(float left, float right, float bottom, float top, float zNear, float zFar)
 {
-    VkSurfaceTransformFlagBitsKHR preTransformFlag = gVulkanContext->GetPreTransformFlag();
+    VkSurfaceTransformFlagBitsKHR preTransformFlag = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+
+    // There is no swapchain to match when running as a dedicated server.
+    if (gVulkanContext != nullptr)
+    {
+        preTransformFlag = gVulkanContext->GetPreTransformFlag();
+    }
 
     glm::mat4 preRotateMat = glm::mat4(1.0f);
     glm::vec3 rotationAxis = glm::vec3(0.0f, 0.0f, 1.0f);
@@ -442,6 +454,11 @@ void GFX_DrawText(Text* text)
     DrawTextWidget(text);
 }
 
+void GFX_DrawTextBatch(Text* const* texts, uint32_t numTexts)
+{
+    DrawTextWidgets(texts, numTexts);
+}
+
 void GFX_CreatePolyResource(Poly* poly)
 {
     CreatePolyResource(poly);
@@ -1,27 +1,43 @@
+#if API_VULKAN
+
 #include "Graphics/Vulkan/MaterialPipelineCache.h"
 #include "Graphics/Vulkan/VulkanUtils.h"
 #include "Graphics/Vulkan/VulkanContext.h"
-#include "Graphics/Vulkan/PipelineConfigs.h"
+#include "Graphics/Vulkan/VulkanConstants.h"
 
-#include "Assets/MaterialLite.h"
 #include "System/System.h"
+#include "Profiler.h"
 #include "Log.h"
 
-#if 0
+#include <algorithm>
+
+static bool DoesStateUseShader(const PipelineState& state, Shader* shader)
+{
+    return shader == nullptr ||
+        state.mVertexShader == shader ||
+        state.mFragmentShader == shader ||
+        state.mComputeShader == shader;
+}
+
 ThreadFuncRet MaterialPipelineCache::BuildThreadFunc(void* arg)
 {
     MaterialPipelineCache* cache = (MaterialPipelineCache*)arg;
 
     std::vector<MaterialPipelineRequest>& requests = cache->mRequests;
     std::vector<MaterialPipelineResult>& results = cache->mResults;
+    std::vector<MaterialPipelineRequest>& building = cache->mBuilding;
     MutexObject* mutex = cache->mMutex;
 
     while (true)
     {
-        uint32_t id = 0;
+        PipelineState state;
         bool hasRequest = false;
         bool cacheEnabled = false;
 
+        // Signaled once per queued request and once per thread when the cache is disabled.
+        // Cancelled requests leave extra signals behind, so an empty queue just waits again.
+        SYS_WaitSemaphore(cache->mRequestSemaphore);
+
         SYS_LockMutex(mutex);
 
         cacheEnabled = cache->mEnabled;
@@ -29,8 +45,13 @@ ThreadFuncRet MaterialPipelineCache::BuildThreadFunc(void* arg)
         if (cacheEnabled && requests.size() > 0)
         {
             hasRequest = true;
-            id = requests[0].mId;
+            state = requests[0].mState;
             requests.erase(requests.begin());
+
+            // Track in-flight builds so shaders aren't destroyed out from under us.
+            MaterialPipelineRequest inFlight;
+            inFlight.mState = state;
+            building.push_back(inFlight);
         }
 
         SYS_UnlockMutex(mutex);
@@ -42,286 +63,90 @@ ThreadFuncRet MaterialPipelineCache::BuildThreadFunc(void* arg)
 
         if (hasRequest)
         {
-            Pipeline *pipeline = nullptr;
-            
-            static_assert(uint32_t(ShadingModel::Count) <= 8, "Need to update pipeline id!");
-            static_assert(uint32_t(BlendMode::Count) <= 8, "Need to update pipeline id!");
-            static_assert(uint32_t(VertexColorMode::Count) <= 8, "Need to update pipeline id!");
-            static_assert(uint32_t(TevMode::Count) <= 8, "Need to update pipeline id!");
-            static_assert(uint32_t(CullMode::Count) <= 4, "Need to update pipeline id!");
-
-            // Reverse the pipeline id to find specialization values
-            ShadingModel shadingModel = ShadingModel((id >> 0) & 7);
-            BlendMode blendMode = BlendMode((id >> 3) & 7);
-            VertexColorMode vertexColorMode = VertexColorMode((id >> 6) & 7);
-            VkBool32 hasSpecular = VkBool32((id >> 9) & 1);
-            VkBool32 hasUv1 = VkBool32((id >> 10) & 1);
-            VkBool32 hasFresnel = VkBool32((id >> 11) & 1);
-            VkBool32 hasFog = VkBool32((id >> 12) & 1);
-            VkBool32 hasWrapLighting = VkBool32((id >> 13) & 1);
-            uint32_t numTextures = uint32_t((id >> 14) & 7);
-            uint32_t tev0 = uint32_t((id >> 17) & 7);
-            uint32_t tev1 = uint32_t((id >> 20) & 7);
-            uint32_t tev2 = uint32_t((id >> 23) & 7);
-            uint32_t tev3 = uint32_t((id >> 26) & 7);
-            CullMode cullMode = CullMode((id >> 29) & 3);
-            bool depthless = uint32_t((id >> 31) & 1);
-
-            // Create base pipeline based on blend mode
-            static_assert(uint32_t(BlendMode::Count) == 4, "Use blend mode to pick starting pipeline or adjust blend modes.");
-
-            switch (blendMode)
-            {
-            case BlendMode::Translucent: pipeline = new TranslucentPipeline(); break;
-            case BlendMode::Additive: pipeline = new AdditivePipeline(); break;
-            default:
-                pipeline = new OpaquePipeline(); break;
-                break;
-            }
-
-            pipeline->mName = "MaterialSpec";
-
-            // Set vertex configs
-            // Don't use skeletal mesh shader because on android we use CPU skinning since gpu skinning is too costly.
-            // The material pipeline cache was designed specifically to assist android devices.
-            // In the future, maybe just create a Pipeline object based on the vertex type with only that single vertex type's vkPipeline
-            pipeline->ClearVertexConfigs();
-            pipeline->AddVertexConfig(VertexType::Vertex, ENGINE_SHADER_DIR "Forward.vert");
-            pipeline->AddVertexConfig(VertexType::VertexColor, ENGINE_SHADER_DIR "ForwardColor.vert");
-            pipeline->AddVertexConfig(VertexType::VertexParticle, ENGINE_SHADER_DIR "ForwardParticle.vert");
-            pipeline->SetFragmentShader(ENGINE_SHADER_DIR "ForwardSpec.frag");
-
-            // Set depth / cull pipeline properties
-            if (depthless)
-            {
-                pipeline->mDepthTestEnabled = false;
-                pipeline->mDepthWriteEnabled = false;
-            }
-
-            switch (cullMode)
-            {
-            case CullMode::Back: pipeline->mCullMode = VK_CULL_MODE_BACK_BIT; break;
-            case CullMode::Front: pipeline->mCullMode = VK_CULL_MODE_FRONT_BIT; break;
-            case CullMode::None: pipeline->mCullMode = VK_CULL_MODE_NONE; break;
-            default: break;
-            }
-
-            // Set renderpass
-            // TODO: This isn't thread safe, but as long as the VulkanContext:mForwardRenderPass
-            // is only changed in VulkanContext::CreateRenderPass(), stopping the 
-            // builder thread in RecreateSwapchain() should be ok.
-            pipeline->SetRenderPass(GetVulkanContext()->GetForwardRenderPass() /*mRenderPass*/);
-
-            // Gather specialization constants
-            constexpr uint32_t kNumSpecs = 13;
-            VkSpecializationMapEntry mapEntries[kNumSpecs] = {};
-
-            // Shading model
-            mapEntries[0].constantID = 0;
-            mapEntries[0].offset = 0;
-            mapEntries[0].size = 4;
-
-            // Blend mode
-            mapEntries[1].constantID = 1;
-            mapEntries[1].offset = 4;
-            mapEntries[1].size = 4;
-
-            // Vertex color mode
-            mapEntries[2].constantID = 2;
-            mapEntries[2].offset = 8;
-            mapEntries[2].size = 4;
-
-            // Has specular
-            mapEntries[3].constantID = 3;
-            mapEntries[3].offset = 12;
-            mapEntries[3].size = 4;
-
-            // Has uv1
-            mapEntries[4].constantID = 4;
-            mapEntries[4].offset = 16;
-            mapEntries[4].size = 4;
-
-            // Has fresnel
-            mapEntries[5].constantID = 5;
-            mapEntries[5].offset = 20;
-            mapEntries[5].size = 4;
-
-            // Has fog
-            mapEntries[6].constantID = 6;
-            mapEntries[6].offset = 24;
-            mapEntries[6].size = 4;
-
-            // Has wrap lighting
-            mapEntries[7].constantID = 7;
-            mapEntries[7].offset = 28;
-            mapEntries[7].size = 4;
-
-            // Num textures
-            mapEntries[8].constantID = 8;
-            mapEntries[8].offset = 32;
-            mapEntries[8].size = 4;
-
-            // Tev 0
-            mapEntries[9].constantID = 9;
-            mapEntries[9].offset = 36;
-            mapEntries[9].size = 4;
-
-            // Tev 1
-            mapEntries[10].constantID = 10;
-            mapEntries[10].offset = 40;
-            mapEntries[10].size = 4;
-
-            // Tev 2
-            mapEntries[11].constantID = 11;
-            mapEntries[11].offset = 44;
-            mapEntries[11].size = 4;
-
-            // Tev 3
-            mapEntries[12].constantID = 12;
-            mapEntries[12].offset = 48;
-            mapEntries[12].size = 4;
-
-            Stream specDataStream;
-            specDataStream.WriteUint32((uint32_t)shadingModel);
-            specDataStream.WriteUint32((uint32_t)blendMode);
-            specDataStream.WriteUint32((uint32_t)vertexColorMode);
-            specDataStream.WriteUint32(hasSpecular);
-            specDataStream.WriteUint32(hasUv1);
-            specDataStream.WriteUint32(hasFresnel);
-            specDataStream.WriteUint32(hasFog);
-            specDataStream.WriteUint32(hasWrapLighting);
-            specDataStream.WriteUint32(numTextures);
-            specDataStream.WriteUint32(tev0);
-            specDataStream.WriteUint32(tev1);
-            specDataStream.WriteUint32(tev2);
-            specDataStream.WriteUint32(tev3);
-
-            VkSpecializationInfo specInfo = {};
-            specInfo.mapEntryCount = kNumSpecs;
-            specInfo.pMapEntries = mapEntries;
-            specInfo.pData = specDataStream.GetData();
-            specInfo.dataSize = specDataStream.GetSize();
-
-            // Create pipeline
-            pipeline->Create(&specInfo);
+            // Pipeline creation only touches the VkDevice and the VkPipelineCache,
+            // both of which are safe to use from multiple threads.
+            Pipeline* pipeline = new Pipeline();
+            pipeline->mName = "MaterialAsync";
+            pipeline->Create(state, cache->mVkPipelineCache);
 
             {
                 SCOPED_LOCK(mutex);
                 MaterialPipelineResult res;
-                res.mId = id;
+                res.mState = state;
                 res.mPipeline = pipeline;
                 results.push_back(res);
+
+                for (uint32_t i = 0; i < building.size(); ++i)
+                {
+                    if (building[i].mState == state)
+                    {
+                        building.erase(building.begin() + i);
+                        break;
+                    }
+                }
+
+                if (cache->mWaitingForBuilds)
+                {
+                    SYS_SignalSemaphore(cache->mBuildDoneSemaphore);
+                }
             }
         }
-        else
-        {
-            // TODO: Use condition variable instead.
-            SYS_Sleep(1);
-        }
     }
 
     THREAD_RETURN();
 }
 
-
-void MaterialPipelineCache::Create()
+void MaterialPipelineCache::Create(VkPipelineCache vkCache)
 {
     mMutex = SYS_CreateMutex();
+    mRequestSemaphore = SYS_CreateSemaphore(0);
+    mBuildDoneSemaphore = SYS_CreateSemaphore(0);
+    mVkPipelineCache = vkCache;
 }
 
 void MaterialPipelineCache::Destroy()
 {
-    // This call may join + destroy builder thread.
-    // This could potentially be a long wait?
+    // This call may join + destroy builder threads.
+    // Each thread finishes the pipeline it is currently building first.
     Enable(false);
+    Reset();
+
+    SYS_DestroySemaphore(mRequestSemaphore);
+    mRequestSemaphore = nullptr;
+    SYS_DestroySemaphore(mBuildDoneSemaphore);
+    mBuildDoneSemaphore = nullptr;
 
     SYS_DestroyMutex(mMutex);
     mMutex = nullptr;
 }
 
-Pipeline* MaterialPipelineCache::GetPipeline(Material* material, VertexType vertexType)
-{
-    // Base materials should store their pipelines on their graphics resource object.
-    if (!material->IsLite())
-        return nullptr;
-
-    MaterialLite* matLite = (MaterialLite*)material;
-
-    static_assert(uint32_t(ShadingModel::Count) <= 8, "Need to update pipeline id!");
-    static_assert(uint32_t(BlendMode::Count) <= 8, "Need to update pipeline id!");
-    static_assert(uint32_t(VertexColorMode::Count) <= 8, "Need to update pipeline id!");
-    static_assert(uint32_t(TevMode::Count) <= 8, "Need to update pipeline id!");
-    static_assert(uint32_t(CullMode::Count) <= 4, "Need to update pipeline id!");
-
-    // Constant values
-    uint32_t shadingModel_3 = (uint32_t)matLite->GetShadingModel();
-    uint32_t blendMode_3 = (uint32_t)matLite->GetBlendMode();
-    uint32_t vertexColorMode_3 = (uint32_t)matLite->GetVertexColorMode();
-    uint32_t hasSpecular_1 = (uint32_t)(matLite->GetSpecular() > 0.0f);
-    uint32_t hasUv1_1 = (uint32_t)(matLite->GetUvMap(0) == 1 || matLite->GetUvMap(1) == 1 || matLite->GetUvMap(2) == 1 || matLite->GetUvMap(3) == 1);
-    uint32_t hasFresnel_1 = (uint32_t)matLite->IsFresnelEnabled();
-    uint32_t hasFog_1 = (uint32_t)matLite->ShouldApplyFog();
-    uint32_t hasWrapLighting_1 = (uint32_t)(matLite->GetWrapLighting() > 0.0f);
-    uint32_t numTextures_3 = (uint32_t)(1 + uint32_t(matLite->GetTevMode(1) != TevMode::Pass) + uint32_t(matLite->GetTevMode(2) != TevMode::Pass) + uint32_t(matLite->GetTevMode(3) != TevMode::Pass));
-    uint32_t tev0_3 = (uint32_t)matLite->GetTevMode(0);
-    uint32_t tev1_3 = (uint32_t)matLite->GetTevMode(1);
-    uint32_t tev2_3 = (uint32_t)matLite->GetTevMode(2);
-    uint32_t tev3_3 = (uint32_t)matLite->GetTevMode(3);
-    uint32_t cullMode_2 = (uint32_t)matLite->GetCullMode();
-    uint32_t depthless_1 = (uint32_t)matLite->IsDepthTestDisabled();
-
-    uint32_t id = 0;
-    id += shadingModel_3 << 0;
-    id += blendMode_3 << 3;
-    id += vertexColorMode_3 << 6;
-    id += hasSpecular_1 << 9;
-    id += hasUv1_1 << 10;
-    id += hasFresnel_1 << 11;
-    id += hasFog_1 << 12;
-    id += hasWrapLighting_1 << 13;
-    id += numTextures_3 << 14;
-    id += tev0_3 << 17;
-    id += tev1_3 << 20;
-    id += tev2_3 << 23;
-    id += tev3_3 << 26;
-    id += cullMode_2 << 29;
-    id += depthless_1 << 31;
-
-    return GetPipeline(id, vertexType);
-}
-
-Pipeline* MaterialPipelineCache::GetPipeline(uint32_t id, VertexType vertexType)
+Pipeline* MaterialPipelineCache::GetPipeline(const PipelineState& state)
 {
     Pipeline* retPipeline = nullptr;
 
-    // Based on the pipeline id, check our mPipelines map.
-    auto it = mPipelines.find(id);
+    auto it = mPipelines.find(state);
 
     // If no pipeline in the map, create a request for the pipeline and return null.
     if (it == mPipelines.end())
     {
-        if (mPipelines.size() < mMaxPipelines)
-        {
-            // Insert nullptr
-            mPipelines[id] = nullptr;
+        MaterialPipelineEntry entry;
+        entry.mLastUsedFrame = GetVulkanContext()->GetFrameNumber();
+        mPipelines.insert({ state, entry });
+        ++mNumPending;
 
-            // Enqueue request
-            MaterialPipelineRequest request;
-            request.mId = id;
+        MaterialPipelineRequest request;
+        request.mState = state;
 
-            SYS_LockMutex(mMutex);
-            mRequests.push_back(request);
-            SYS_UnlockMutex(mMutex);
-        }
+        SYS_LockMutex(mMutex);
+        mRequests.push_back(request);
+        SYS_UnlockMutex(mMutex);
+
+        SYS_SignalSemaphore(mRequestSemaphore);
     }
     else
     {
-        // See if the vertex type is supported.
-        if (it->second != nullptr &&
-            it->second->GetVkPipeline(vertexType) != VK_NULL_HANDLE)
-        {
-            retPipeline = it->second;
-        }
+        it->second.mLastUsedFrame = GetVulkanContext()->GetFrameNumber();
+        retPipeline = it->second.mPipeline;
     }
 
     return retPipeline;
@@ -333,59 +158,51 @@ uint32_t MaterialPipelineCache::GetNumPipelines() const
     return (uint32_t)mPipelines.size();
 }
 
+uint32_t MaterialPipelineCache::GetNumPendingPipelines() const
+{
+    return mNumPending;
+}
+
 void MaterialPipelineCache::Reset()
 {
-    // Destroy all pipelines (or queue delete them?)
-    DeviceWaitIdle();
-    for (auto it = mPipelines.begin(); it != mPipelines.end(); ++it)
     {
-        if (it->second != nullptr)
-        {
-            GetDestroyQueue()->Destroy(it->second);
-            it->second = nullptr;
-        }
+        SCOPED_LOCK(mMutex);
+        mRequests.clear();
     }
-    mPipelines.clear();
+
+    WaitForBuilds(nullptr);
 
     {
         SCOPED_LOCK(mMutex);
-        mRequests.clear();
 
         for (uint32_t i = 0; i < mResults.size(); ++i)
         {
-            if (mResults[i].mPipeline != nullptr)
-            {
-                GetDestroyQueue()->Destroy(mResults[i].mPipeline);
-                mResults[i].mPipeline = nullptr;
-            }
+            GetDestroyQueue()->Destroy(mResults[i].mPipeline);
+            mResults[i].mPipeline = nullptr;
         }
 
         mResults.clear();
     }
 
-    // What do we do about pipelines currently being built on the worker thread?
-    // For now... nothing?
-}
-
-void MaterialPipelineCache::Update()
-{
-    SCOPED_LOCK(mMutex);
-    
-    // Move all of the results into the mPipelines map.
-    for (uint32_t i = 0; i < mResults.size(); ++i)
+    for (auto it = mPipelines.begin(); it != mPipelines.end(); ++it)
     {
-        uint32_t id = mResults[i].mId;
-        OCT_ASSERT(mResults[i].mPipeline != nullptr);
-
-        if (mPipelines.find(id) == mPipelines.end())
+        if (it->second.mPipeline != nullptr)
         {
-            LogWarning("Result pipeline wasn't requested. This can happen after calling Reset()");
+            GetDestroyQueue()->Destroy(it->second.mPipeline);
+            it->second.mPipeline = nullptr;
         }
-
-        mPipelines[id] = mResults[i].mPipeline;
     }
 
-    mResults.clear();
+    mPipelines.clear();
+    mNumPending = 0;
+}
+
+void MaterialPipelineCache::Update()
+{
+    SCOPED_FRAME_STAT("MaterialPipelines");
+
+    ProcessResults();
+    EvictPipelines();
 }
 
 void MaterialPipelineCache::Enable(bool enable)
@@ -395,20 +212,77 @@ void MaterialPipelineCache::Enable(bool enable)
     SYS_UnlockMutex(mMutex);
 
     if (enable)
-    { 
-        if (mBuildThread == nullptr)
+    {
+        if (mBuildThreads.size() == 0)
         {
-            // Startup the thread
-            mBuildThread = SYS_CreateThread(BuildThreadFunc, this);
+            // Startup the threads
+            for (uint32_t i = 0; i < MATERIAL_PIPELINE_BUILD_THREADS; ++i)
+            {
+                mBuildThreads.push_back(SYS_CreateThread(BuildThreadFunc, this));
+            }
         }
     }
     else
     {
-        if (mBuildThread != nullptr)
+        // Wake every thread so it sees the cache is disabled.
+        for (uint32_t i = 0; i < mBuildThreads.size(); ++i)
+        {
+            SYS_SignalSemaphore(mRequestSemaphore);
+        }
+
+        for (uint32_t i = 0; i < mBuildThreads.size(); ++i)
+        {
+            SYS_JoinThread(mBuildThreads[i]);
+            SYS_DestroyThread(mBuildThreads[i]);
+        }
+
+        mBuildThreads.clear();
+    }
+}
+
+bool MaterialPipelineCache::IsEnabled() const
+{
+    return mEnabled;
+}
+
+void MaterialPipelineCache::RemoveShader(Shader* shader)
+{
+    if (mPipelines.size() == 0)
+        return;
+
+    // Cancel any requests that haven't started yet.
+    {
+        SCOPED_LOCK(mMutex);
+        for (int32_t i = int32_t(mRequests.size()) - 1; i >= 0; --i)
+        {
+            if (DoesStateUseShader(mRequests[i].mState, shader))
+            {
+                mRequests.erase(mRequests.begin() + i);
+            }
+        }
+    }
+
+    WaitForBuilds(shader);
+    ProcessResults();
+
+    for (auto it = mPipelines.begin(); it != mPipelines.end();)
+    {
+        if (DoesStateUseShader(it->first, shader))
+        {
+            if (it->second.mPipeline != nullptr)
+            {
+                GetDestroyQueue()->Destroy(it->second.mPipeline);
+            }
+            else
+            {
+                --mNumPending;
+            }
+
+            it = mPipelines.erase(it);
+        }
+        else
         {
-            SYS_JoinThread(mBuildThread);
-            SYS_DestroyThread(mBuildThread);
-            mBuildThread = nullptr;
+            ++it;
         }
     }
 }
@@ -423,4 +297,95 @@ void MaterialPipelineCache::SetMaxPipelines(uint32_t maxPipelines)
     mMaxPipelines = maxPipelines;
 }
 
-#endif
\ No newline at end of file
+void MaterialPipelineCache::ProcessResults()
+{
+    SCOPED_LOCK(mMutex);
+
+    // Move all of the results into the mPipelines map.
+    for (uint32_t i = 0; i < mResults.size(); ++i)
+    {
+        OCT_ASSERT(mResults[i].mPipeline != nullptr);
+
+        auto it = mPipelines.find(mResults[i].mState);
+
+        if (it == mPipelines.end() || it->second.mPipeline != nullptr)
+        {
+            // Request was cancelled (e.g. by Reset() or RemoveShader()) while it was being built.
+            GetDestroyQueue()->Destroy(mResults[i].mPipeline);
+        }
+        else
+        {
+            it->second.mPipeline = mResults[i].mPipeline;
+            --mNumPending;
+        }
+    }
+
+    mResults.clear();
+}
+
+void MaterialPipelineCache::EvictPipelines()
+{
+    if (mPipelines.size() <= mMaxPipelines)
+        return;
+
+    // Evict the least recently used pipelines that haven't been used by any frame still in flight.
+    uint32_t frameNumber = GetVulkanContext()->GetFrameNumber();
+    std::vector<std::pair<uint32_t, const PipelineState*>> candidates;
+
+    for (auto it = mPipelines.begin(); it != mPipelines.end(); ++it)
+    {
+        if (it->second.mPipeline != nullptr &&
+            it->second.mLastUsedFrame + MAX_FRAMES < frameNumber)
+        {
+            candidates.push_back({ it->second.mLastUsedFrame, &it->first });
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+        [](const std::pair<uint32_t, const PipelineState*>& l, const std::pair<uint32_t, const PipelineState*>& r)
+        {
+            return l.first < r.first;
+        });
+
+    uint32_t numToEvict = glm::min<uint32_t>(uint32_t(mPipelines.size()) - mMaxPipelines, uint32_t(candidates.size()));
+
+    for (uint32_t i = 0; i < numToEvict; ++i)
+    {
+        auto it = mPipelines.find(*candidates[i].second);
+        OCT_ASSERT(it != mPipelines.end());
+
+        GetDestroyQueue()->Destroy(it->second.mPipeline);
+        mPipelines.erase(it);
+    }
+}
+
+void MaterialPipelineCache::WaitForBuilds(Shader* shader)
+{
+    while (true)
+    {
+        bool building = false;
+
+        SYS_LockMutex(mMutex);
+        for (uint32_t i = 0; i < mBuilding.size(); ++i)
+        {
+            if (DoesStateUseShader(mBuilding[i].mState, shader))
+            {
+                building = true;
+                break;
+            }
+        }
+        mWaitingForBuilds = building;
+        SYS_UnlockMutex(mMutex);
+
+        if (!building)
+        {
+            break;
+        }
+
+        // Build threads signal whenever they finish a pipeline while we're waiting.
+        // It may not be one that uses this shader, so check again.
+        SYS_WaitSemaphore(mBuildDoneSemaphore);
+    }
+}
+
+#endif
@@ -9,32 +9,43 @@
 #include <unordered_set>
 #include <vector>
 
-#if 0
-
 struct MaterialPipelineRequest
 {
-    uint32_t mId = 0;
+    PipelineState mState;
 };
 
 struct MaterialPipelineResult
 {
-    uint32_t mId = 0;
+    PipelineState mState;
+    Pipeline* mPipeline = nullptr;
+};
+
+struct MaterialPipelineEntry
+{
     Pipeline* mPipeline = nullptr;
+    uint32_t mLastUsedFrame = 0;
 };
 
+// Builds pipelines for material shaders on background threads so that the first
+// appearance of a material doesn't stall the frame. Callers draw with a fallback
+// pipeline until GetPipeline() returns a non-null result.
 class MaterialPipelineCache
 {
 public:
 
-    void Create();
+    void Create(VkPipelineCache vkCache);
     void Destroy();
 
-    Pipeline* GetPipeline(Material* material, VertexType vertexType);
-    Pipeline* GetPipeline(uint32_t id, VertexType vertexType);
+    Pipeline* GetPipeline(const PipelineState& state);
     uint32_t GetNumPipelines() const;
+    uint32_t GetNumPendingPipelines() const;
     void Reset();
     void Update();
     void Enable(bool enable);
+    bool IsEnabled() const;
+
+    // Drops requests and pipelines that reference the shader. Must be called before the shader is deleted.
+    void RemoveShader(Shader* shader);
 
     uint32_t GetMaxPipelines() const;
     void SetMaxPipelines(uint32_t maxPipelines);
@@ -43,18 +54,24 @@ protected:
 
     static ThreadFuncRet BuildThreadFunc(void* arg);
 
+    void ProcessResults();
+    void EvictPipelines();
+    void WaitForBuilds(Shader* shader);
+
     // These two data structures can be queried on main thread without locking mutex.
-    std::unordered_map<uint32_t, Pipeline*> mPipelines;
+    std::unordered_map<PipelineState, MaterialPipelineEntry, PipelineStateHasher> mPipelines;
     uint32_t mMaxPipelines = 256;
+    uint32_t mNumPending = 0;
 
     MutexObject* mMutex = nullptr;
-    //CondObject* mWorkCondition = nullptr;
+    SemaphoreObject* mRequestSemaphore = nullptr;
+    SemaphoreObject* mBuildDoneSemaphore = nullptr;
+    bool mWaitingForBuilds = false;
     std::vector<MaterialPipelineRequest> mRequests;
     std::vector<MaterialPipelineResult> mResults;
-    VkRenderPass mRenderPass;
+    std::vector<MaterialPipelineRequest> mBuilding;
+    VkPipelineCache mVkPipelineCache = VK_NULL_HANDLE;
     bool mEnabled = false;
 
-    ThreadObject* mBuildThread = nullptr;
+    std::vector<ThreadObject*> mBuildThreads;
 };
-
-#endif
@@ -118,4 +118,48 @@ UniformBlock UniformBuffer::AllocBlock(uint32_t blockSize)
     return retBlock;
 }
 
+FrameVertexBuffer::FrameVertexBuffer(size_t size, const char* debugName) :
+    MultiBuffer(BufferType::Vertex, size, debugName)
+{
+
+}
+
+void FrameVertexBuffer::Reset(uint32_t frameIndex)
+{
+    if (frameIndex < MAX_FRAMES)
+    {
+        mHead[frameIndex] = 0;
+    }
+    else
+    {
+        LogError("Invalid frame index in FrameVertexBuffer::Reset()");
+    }
+}
+
+VertexBlock FrameVertexBuffer::AllocBlock(uint32_t blockSize)
+{
+    VertexBlock retBlock;
+
+    uint32_t frameIndex = GetFrameIndex();
+    int32_t head = mHead[frameIndex];
+
+    if (head + blockSize <= GetSize())
+    {
+        retBlock.mOffset = head;
+        retBlock.mSize = blockSize;
+        retBlock.mData = ((uint8_t*)GetBuffer(frameIndex)->GetMappedPointer()) + retBlock.mOffset;
+        retBlock.mVertexBuffer = this;
+
+        // Keep blocks 16 byte aligned so any vertex format can follow.
+        uint32_t alignedBlockSize = (blockSize + 15) & (~15u);
+        mHead[frameIndex] = head + alignedBlockSize;
+    }
+    else
+    {
+        LogError("Frame vertex buffer overflowed.");
+    }
+
+    return retBlock;
+}
+
 #endif
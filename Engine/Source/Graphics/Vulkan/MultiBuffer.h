@@ -55,4 +55,27 @@ protected:
     int32_t mHead[MAX_FRAMES] = {};
 };
 
+struct VertexBlock
+{
+    class FrameVertexBuffer* mVertexBuffer = nullptr;
+    uint8_t* mData = nullptr;
+    uint32_t mOffset = 0;
+    uint32_t mSize = 0;
+};
+
+// Linear allocator for transient vertex data that is rewritten every frame.
+class FrameVertexBuffer : public MultiBuffer
+{
+public:
+    FrameVertexBuffer(size_t size, const char* debugName);
+
+    void Reset(uint32_t frameIndex);
+
+    VertexBlock AllocBlock(uint32_t blockSize);
+
+protected:
+
+    int32_t mHead[MAX_FRAMES] = {};
+};
+
 #endif
\ No newline at end of file
@@ -5,7 +5,46 @@
 #include "VulkanContext.h"
 #include "VulkanConstants.h"
 
+#include "Engine.h"
+
+#include <string.h>
+
 #define PIPELINE_CACHE_SAVE_NAME "PipelineCache.sav"
+#define PIPELINE_CACHE_SAVE_MAGIC 0x4f435043 // "OCPC"
+
+static void WritePipelineCacheHeader(Stream& stream)
+{
+    const VkPhysicalDeviceProperties& props = GetVulkanContext()->GetDeviceProperties();
+    stream.WriteUint32(PIPELINE_CACHE_SAVE_MAGIC);
+    stream.WriteUint32(props.vendorID);
+    stream.WriteUint32(props.deviceID);
+    stream.WriteUint32(props.driverVersion);
+    stream.WriteBytes(props.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+static bool ReadPipelineCacheHeader(Stream& stream)
+{
+    // The blob is only valid for the exact device + driver that produced it.
+    const VkPhysicalDeviceProperties& props = GetVulkanContext()->GetDeviceProperties();
+    const uint32_t headerSize = sizeof(uint32_t) * 4 + VK_UUID_SIZE;
+
+    if (stream.GetSize() < headerSize ||
+        stream.ReadUint32() != PIPELINE_CACHE_SAVE_MAGIC)
+    {
+        return false;
+    }
+
+    uint32_t vendorId = stream.ReadUint32();
+    uint32_t deviceId = stream.ReadUint32();
+    uint32_t driverVersion = stream.ReadUint32();
+    uint8_t uuid[VK_UUID_SIZE] = {};
+    stream.ReadBytes(uuid, VK_UUID_SIZE);
+
+    return vendorId == props.vendorID &&
+        deviceId == props.deviceID &&
+        driverVersion == props.driverVersion &&
+        memcmp(uuid, props.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
 
 void PipelineCache::Create()
 {
@@ -18,8 +57,15 @@ void PipelineCache::Create()
     {
         if (SYS_ReadSave(PIPELINE_CACHE_SAVE_NAME, pipelineData))
         {
-            initData = pipelineData.GetData();
-            initSize = (size_t)pipelineData.GetSize();
+            if (ReadPipelineCacheHeader(pipelineData))
+            {
+                initData = pipelineData.GetData() + pipelineData.GetPos();
+                initSize = (size_t)(pipelineData.GetSize() - pipelineData.GetPos());
+            }
+            else
+            {
+                LogDebug("Discarding pipeline cache saved by a different device or driver");
+            }
         }
     }
 
@@ -35,10 +81,15 @@ void PipelineCache::Create()
         LogError("Failed to create pipeline cache");
         OCT_ASSERT(0);
     }
+
+    mMaterialPipelineCache.Create(mPipelineCache);
+    mMaterialPipelineCache.Enable(GetEngineConfig()->mAsyncPipelines);
 }
 
 void PipelineCache::Clear()
 {
+    mMaterialPipelineCache.Reset();
+
     for (auto it : mPipelineMap)
     {
         GetDestroyQueue()->Destroy(it.second);
@@ -49,6 +100,9 @@ void PipelineCache::Clear()
 
 void PipelineCache::Destroy()
 {
+    // Stop the builder threads before saving so their pipelines are included in the blob.
+    mMaterialPipelineCache.Destroy();
+
     SaveToFile();
 
     Clear();
@@ -77,6 +131,7 @@ void PipelineCache::SaveToFile()
             OCT_ASSERT(res == VK_SUCCESS);
 
             Stream stream;
+            WritePipelineCacheHeader(stream);
             stream.WriteBytes((uint8_t*)cacheData, (uint32_t)cacheSize);
 
             SYS_WriteSave(PIPELINE_CACHE_SAVE_NAME, stream);
@@ -87,11 +142,21 @@ void PipelineCache::SaveToFile()
     }
 }
 
+void PipelineCache::Update()
+{
+    mMaterialPipelineCache.Update();
+}
+
 VkPipelineCache PipelineCache::GetPipelineCacheObj()
 {
     return mPipelineCache;
 }
 
+MaterialPipelineCache& PipelineCache::GetMaterialPipelineCache()
+{
+    return mMaterialPipelineCache;
+}
+
 Pipeline* PipelineCache::Resolve(const PipelineState& state)
 {
     VkDevice device = GetVulkanDevice();
@@ -110,3 +175,42 @@ Pipeline* PipelineCache::Resolve(const PipelineState& state)
         return newPipeline;
     }
 }
+
+Pipeline* PipelineCache::ResolveAsync(const PipelineState& state)
+{
+    if (!mMaterialPipelineCache.IsEnabled())
+    {
+        return Resolve(state);
+    }
+
+    // It may have already been built synchronously (e.g. before async building was enabled).
+    auto it = mPipelineMap.find(state);
+    if (it != mPipelineMap.end())
+    {
+        return it->second;
+    }
+
+    return mMaterialPipelineCache.GetPipeline(state);
+}
+
+void PipelineCache::RemoveShader(Shader* shader)
+{
+    mMaterialPipelineCache.RemoveShader(shader);
+
+    for (auto it = mPipelineMap.begin(); it != mPipelineMap.end();)
+    {
+        const PipelineState& state = it->first;
+
+        if (state.mVertexShader == shader ||
+            state.mFragmentShader == shader ||
+            state.mComputeShader == shader)
+        {
+            GetDestroyQueue()->Destroy(it->second);
+            it = mPipelineMap.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
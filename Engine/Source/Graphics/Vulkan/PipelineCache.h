@@ -2,6 +2,7 @@
 
 #include "VulkanTypes.h"
 #include "Pipeline.h"
+#include "MaterialPipelineCache.h"
 
 #include <vulkan/vulkan.h>
 
@@ -12,14 +13,22 @@ public:
     void Create();
     void Destroy();
     void Clear();
+    void Update();
     void SaveToFile();
 
     VkPipelineCache GetPipelineCacheObj();
+    MaterialPipelineCache& GetMaterialPipelineCache();
 
     Pipeline* Resolve(const PipelineState& state);
 
+    // Returns nullptr if the pipeline is still being built in the background.
+    Pipeline* ResolveAsync(const PipelineState& state);
+
+    void RemoveShader(Shader* shader);
+
 protected:
 
     std::unordered_map<PipelineState, Pipeline*, PipelineStateHasher> mPipelineMap;
+    MaterialPipelineCache mMaterialPipelineCache;
     VkPipelineCache mPipelineCache = VK_NULL_HANDLE;
 };
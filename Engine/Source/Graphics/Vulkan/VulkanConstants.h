@@ -22,6 +22,8 @@
 
 #define NUM_MATERIAL_VERTEX_CONFIGS 4
 #define MAX_MATERIAL_UBO_SIZE (4 * 1024)
+#define MATERIAL_PIPELINE_BUILD_THREADS 2
+#define FRAME_VERTEX_BUFFER_SIZE (4 * 1024 * 1024)
 
 #define VULKAN_VERBOSE_LOGGING 0
 
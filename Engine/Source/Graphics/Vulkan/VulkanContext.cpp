@@ -306,6 +306,9 @@ void VulkanContext::BeginFrame()
     // Reset descriptor pool
     mDescriptorPools[mFrameIndex].Reset();
 
+    // Pick up any pipelines that finished building in the background.
+    mPipelineCache.Update();
+
     VkCommandBufferBeginInfo beginInfo = {};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
@@ -314,6 +317,24 @@ void VulkanContext::BeginFrame()
     vkBeginCommandBuffer(cb, &beginInfo);
     SetDebugObjectName(VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)cb, "FrameCommandBuffer");
 
+    // Staging copies (e.g. partial instance buffer updates) are submitted on their own command buffers while this
+    // frame is recorded. They come before this command buffer in submission order, so this barrier makes their
+    // writes visible to the frame's draws. Draws happen inside render passes, where a barrier can't be recorded.
+    VkMemoryBarrier uploadBarrier = {};
+    uploadBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    uploadBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    uploadBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+
+    vkCmdPipelineBarrier(
+        cb,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0,
+        1,
+        &uploadBarrier,
+        0, nullptr,
+        0, nullptr);
+
     ReadTimeQueryResults();
 
     // We need to update global data at begining of the frame because 
@@ -387,8 +408,9 @@ void VulkanContext::EndFrame()
     // It should be safe if we waited to acquire the swapchain image.
     mDestroyQueue.Flush(nextFrameIndex);
 
-    // Reset the head offset for our frame uniform buffer.
+    // Reset the head offset for our frame uniform / vertex buffers.
     mFrameUniformBuffer->Reset(nextFrameIndex);
+    mFrameVertexBuffer->Reset(nextFrameIndex);
 
     mFrameIndex = nextFrameIndex;
     mFrameNumber++;
@@ -614,7 +636,30 @@ void VulkanContext::EndVkRenderPass()
 
 void VulkanContext::CommitPipeline()
 {
-    mBoundPipeline = mPipelineCache.Resolve(mPipelineState);
+    mBoundPipeline = nullptr;
+    mFallbackPipelineBound = false;
+
+    if (mFallbackVertexShader != nullptr || mFallbackFragmentShader != nullptr)
+    {
+        // Material pipelines are built in the background. Until it's ready, draw with
+        // the engine's default forward shaders instead of stalling on pipeline creation.
+        mBoundPipeline = mPipelineCache.ResolveAsync(mPipelineState);
+
+        if (mBoundPipeline == nullptr)
+        {
+            PipelineState fallbackState = mPipelineState;
+            fallbackState.mVertexShader = mFallbackVertexShader ? mFallbackVertexShader : fallbackState.mVertexShader;
+            fallbackState.mFragmentShader = mFallbackFragmentShader ? mFallbackFragmentShader : fallbackState.mFragmentShader;
+
+            mBoundPipeline = mPipelineCache.Resolve(fallbackState);
+            mFallbackPipelineBound = true;
+        }
+    }
+    else
+    {
+        mBoundPipeline = mPipelineCache.Resolve(mPipelineState);
+    }
+
     mBoundPipeline->Bind(mCommandBuffers[mFrameIndex]);
 
     // TODO: Can we avoid always binding the global descriptor set.
@@ -1353,10 +1398,13 @@ void VulkanContext::CreateFrameUniformBuffer()
 {
     mFrameUniformBuffer = new UniformBuffer(32 * 1024 * 1024, "Frame Uniform Buffer");
 
+    mFrameVertexBuffer = new FrameVertexBuffer(FRAME_VERTEX_BUFFER_SIZE, "Frame Vertex Buffer");
+
     // Leave these buffers mapped forever?
     for (uint32_t i = 0; i < MAX_FRAMES; ++i)
     {
         mFrameUniformBuffer->GetBuffer(i)->Map();
+        mFrameVertexBuffer->GetBuffer(i)->Map();
     }
 }
 
@@ -1364,6 +1412,9 @@ void VulkanContext::DestroyFrameUniformBuffer()
 {
     GetDestroyQueue()->Destroy(mFrameUniformBuffer);
     mFrameUniformBuffer = nullptr;
+
+    GetDestroyQueue()->Destroy(mFrameVertexBuffer);
+    mFrameVertexBuffer = nullptr;
 }
 
 void VulkanContext::CreateSceneColorImage()
@@ -2257,6 +2308,11 @@ UniformBuffer* VulkanContext::GetFrameUniformBuffer()
     return mFrameUniformBuffer;
 }
 
+FrameVertexBuffer* VulkanContext::GetFrameVertexBuffer()
+{
+    return mFrameVertexBuffer;
+}
+
 Shader* VulkanContext::GetGlobalShader(const std::string& name)
 {
     Shader* shader = mGlobalShaders[name];
@@ -2277,6 +2333,9 @@ const PipelineState& VulkanContext::GetPipelineState() const
 
 void VulkanContext::SetPipelineState(const PipelineState& state)
 {
+    mFallbackVertexShader = nullptr;
+    mFallbackFragmentShader = nullptr;
+
     // Do not change Render Pass.
     VkRenderPass curRenderPass = mPipelineState.mRenderPass;
 
@@ -2289,6 +2348,7 @@ void VulkanContext::SetVertexShader(Shader* shader)
 {
     if (shader->mStage == ShaderStage::Vertex)
     {
+        mFallbackVertexShader = nullptr;
         mPipelineState.mVertexShader = shader;
         mPipelineState.mComputeShader = nullptr;
     }
@@ -2303,6 +2363,7 @@ void VulkanContext::SetFragmentShader(Shader* shader)
 {
     if (shader->mStage == ShaderStage::Fragment)
     {
+        mFallbackFragmentShader = nullptr;
         mPipelineState.mFragmentShader = shader;
         mPipelineState.mComputeShader = nullptr;
     }
@@ -2317,6 +2378,8 @@ void VulkanContext::SetComputeShader(Shader* shader)
 {
     if (shader->mStage == ShaderStage::Compute)
     {
+        mFallbackVertexShader = nullptr;
+        mFallbackFragmentShader = nullptr;
         mPipelineState.mComputeShader = shader;
         mPipelineState.mVertexShader = nullptr;
         mPipelineState.mFragmentShader = nullptr;
@@ -2328,6 +2391,16 @@ void VulkanContext::SetComputeShader(Shader* shader)
     }
 }
 
+void VulkanContext::SetFallbackVertexShader(Shader* shader)
+{
+    mFallbackVertexShader = shader;
+}
+
+void VulkanContext::SetFallbackFragmentShader(Shader* shader)
+{
+    mFallbackFragmentShader = shader;
+}
+
 void VulkanContext::SetVertexShader(const std::string& globalName)
 {
     Shader* shader = GetGlobalShader(globalName);
@@ -2604,6 +2677,11 @@ Pipeline* VulkanContext::GetBoundPipeline()
     return mBoundPipeline;
 }
 
+bool VulkanContext::IsFallbackPipelineBound() const
+{
+    return mFallbackPipelineBound;
+}
+
 PipelineCache& VulkanContext::GetPipelineCache()
 {
     return mPipelineCache;
@@ -97,6 +97,7 @@ public:
     Image* GetSwapchainImage();
 
     Pipeline* GetBoundPipeline();
+    bool IsFallbackPipelineBound() const;
     PipelineCache& GetPipelineCache();
     void SavePipelineCacheToFile();
 
@@ -146,6 +147,7 @@ public:
 
     const VkPhysicalDeviceProperties& GetDeviceProperties() const;
     UniformBuffer* GetFrameUniformBuffer();
+    FrameVertexBuffer* GetFrameVertexBuffer();
 
     Shader* GetGlobalShader(const std::string& name);
 
@@ -155,6 +157,8 @@ public:
     void SetVertexShader(Shader* shader);
     void SetFragmentShader(Shader* shader);
     void SetComputeShader(Shader* shader);
+    void SetFallbackVertexShader(Shader* shader);
+    void SetFallbackFragmentShader(Shader* shader);
     void SetVertexShader(const std::string& globalName);
     void SetFragmentShader(const std::string& globalName);
     void SetComputeShader(const std::string& globalName);
@@ -279,6 +283,7 @@ private:
     // Pipelines
     PipelineCache mPipelineCache;
     Pipeline* mBoundPipeline = nullptr;
+    bool mFallbackPipelineBound = false;
 
     // Shader Data
     std::unordered_map<std::string, Shader*> mGlobalShaders;
@@ -286,6 +291,7 @@ private:
     DescriptorSet mDebugDescriptorSet;
     DescriptorSet mPostProcessDescriptorSet;
     UniformBuffer* mFrameUniformBuffer = nullptr;
+    FrameVertexBuffer* mFrameVertexBuffer = nullptr;
     GlobalUniformData mGlobalUniformData;
 
     // Destroy Queue
@@ -311,6 +317,8 @@ private:
 
     //Pipeline State
     PipelineState mPipelineState;
+    Shader* mFallbackVertexShader = nullptr;
+    Shader* mFallbackFragmentShader = nullptr;
 
     // PostProcess
     PostProcessChain mPostProcessChain;
@@ -114,6 +114,12 @@ struct LightUniformData
 struct MeshInstanceBufferData
 {
     glm::mat4 mTransform;
+
+    // Instances are stored in chunk order, so keep the original index for hit checks and selection.
+    uint32_t mInstanceIndex;
+    uint32_t mPad0;
+    uint32_t mPad1;
+    uint32_t mPad2;
 };
 
 struct GlobalUniformData
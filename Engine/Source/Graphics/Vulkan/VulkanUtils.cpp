@@ -276,12 +276,13 @@ void TransitionImageLayout(
     }
 }
 
-void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
+void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize dstOffset)
 {
     VkCommandBuffer commandBuffer = BeginCommandBuffer();
 
     VkBufferCopy copyRegion = {};
     copyRegion.size = size;
+    copyRegion.dstOffset = dstOffset;
     vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
 
     EndCommandBuffer(commandBuffer);
@@ -895,10 +896,22 @@ void GatherGeometryLightUniformData(GeometryData& outData, Primitive3D* primitiv
     {
         const std::vector<LightData>& lights = Renderer::Get()->GetLightData();
         uint32_t lightIndices[MAX_LIGHTS_PER_DRAW] = {};
+        float lightScores[MAX_LIGHTS_PER_DRAW] = {};
 
-        // Don't worry about sorting for now. Just choose the first X overlapping lights.
-        for (uint32_t i = 0; i < lights.size() && i < MAX_LIGHTS_PER_FRAME; ++i)
+        // Only consider the lights binned into the clusters that this primitive's bounds touch.
+        static std::vector<uint32_t> sCandidates;
+        sCandidates.clear();
+        Renderer::Get()->GetLightGrid().GatherLights(bounds, sCandidates);
+
+        for (uint32_t c = 0; c < sCandidates.size(); ++c)
         {
+            uint32_t i = sCandidates[c];
+
+            if (i >= lights.size())
+            {
+                continue;
+            }
+
             LightingDomain domain = lights[i].mDomain;
 
             if ((domain == LightingDomain::Static && !useStaticDomain) ||
@@ -908,54 +921,64 @@ void GatherGeometryLightUniformData(GeometryData& outData, Primitive3D* primitiv
                 continue;
             }
 
-            bool overlaps = false;
-            if (lights[i].mType == LightType::Directional)
-            {
-                // Global light always overlaps.
-                overlaps = true;
-            }
-            else
+            // Lower score = more important. Directional lights always overlap and take priority,
+            // local lights are ranked by how deep the bounds are inside the light's radius.
+            float score = -1.0f;
+
+            if (lights[i].mType != LightType::Directional)
             {
-                // If the local light is overlapping the geometry bounds, then just add it to the list.
                 float dist2 = glm::distance2(lights[i].mPosition, bounds.mCenter);
 
                 float maxDist = (bounds.mRadius + lights[i].mRadius);
                 float maxDist2 = maxDist * maxDist;
 
-                // Overlap!
-                if (dist2 < maxDist2)
+                if (dist2 >= maxDist2)
                 {
-                    overlaps = true;
+                    // Not overlapping
+                    continue;
                 }
+
+                score = dist2 / maxDist2;
             }
 
-            if (overlaps)
+            // Insert into the sorted list of the best MAX_LIGHTS_PER_DRAW lights.
+            if (numLights == MAX_LIGHTS_PER_DRAW &&
+                score >= lightScores[MAX_LIGHTS_PER_DRAW - 1])
             {
-                // Light indices are packed as bytes into 32-bit uints.
-                // Lights0 contains indices for lights 0 - 3
-                // Lights1 contains indices for lights 4 - 7
-                uint32_t lightNum = numLights;
-                uint32_t& lightIndexInt = (lightNum >= 4) ? outData.mLights1 : outData.mLights0;
-                uint32_t shiftedIdx = 0;
-
-                if (lightNum >= 4)
-                {
-                    shiftedIdx = i << (8 * (lightNum - 4));
-                }
-                else
-                {
-                    shiftedIdx = i << (8 * lightNum);
-                }
+                continue;
+            }
 
-                lightIndexInt |= shiftedIdx;
+            uint32_t slot = (numLights < MAX_LIGHTS_PER_DRAW) ? numLights++ : (MAX_LIGHTS_PER_DRAW - 1);
 
-                ++numLights;
+            while (slot > 0 && lightScores[slot - 1] > score)
+            {
+                lightScores[slot] = lightScores[slot - 1];
+                lightIndices[slot] = lightIndices[slot - 1];
+                --slot;
+            }
 
-                if (numLights >= MAX_LIGHTS_PER_DRAW)
-                {
-                    break;
-                }
+            lightScores[slot] = score;
+            lightIndices[slot] = i;
+        }
+
+        // Light indices are packed as bytes into 32-bit uints.
+        // Lights0 contains indices for lights 0 - 3
+        // Lights1 contains indices for lights 4 - 7
+        for (uint32_t lightNum = 0; lightNum < numLights; ++lightNum)
+        {
+            uint32_t& lightIndexInt = (lightNum >= 4) ? outData.mLights1 : outData.mLights0;
+            uint32_t shiftedIdx = 0;
+
+            if (lightNum >= 4)
+            {
+                shiftedIdx = lightIndices[lightNum] << (8 * (lightNum - 4));
             }
+            else
+            {
+                shiftedIdx = lightIndices[lightNum] << (8 * lightNum);
+            }
+
+            lightIndexInt |= shiftedIdx;
         }
     }
 
@@ -1210,6 +1233,7 @@ void BindForwardVertexType(VertexType vertType, Material* material, bool instanc
     if (vertShader != nullptr)
     {
         ctx->SetVertexShader(vertShader);
+        ctx->SetFallbackVertexShader(ctx->GetGlobalShader(vertShaderName));
     }
     else
     {
@@ -1302,13 +1326,17 @@ void BindMaterialResource(Material* material)
     }
 
     Shader* matFragShader = res->mFragmentShader;
+    Shader* forwardFragShader = ctx->GetGlobalShader("Forward.frag");
 
     if (matFragShader == nullptr)
     {
-        matFragShader = GetVulkanContext()->GetGlobalShader("Forward.frag");
+        ctx->SetFragmentShader(forwardFragShader);
+    }
+    else
+    {
+        ctx->SetFragmentShader(matFragShader);
+        ctx->SetFallbackFragmentShader(forwardFragShader);
     }
-
-    ctx->SetFragmentShader(matFragShader);
 
     bool depthEnabled = !material->IsDepthTestDisabled();
     ctx->SetDepthTestEnabled(depthEnabled);
@@ -1337,6 +1365,13 @@ void BindMaterialResource(Material* material)
 
 void BindMaterialDescriptorSet(Material* material)
 {
+    // The fallback pipeline (bound while the material's pipeline builds) has the layout of a lite material.
+    if (material != nullptr &&
+        GetVulkanContext()->IsFallbackPipelineBound())
+    {
+        material = Renderer::Get()->GetDefaultMaterial();
+    }
+
     if (material == nullptr)
         return;
 
@@ -1418,13 +1453,32 @@ void BindMaterialDescriptorSet(Material* material)
     }
 }
 
+static Buffer* CreateMeshIndexBuffer(uint32_t numVertices, uint32_t numIndices, const IndexType* indices, const char* debugName, VkIndexType& outIndexType)
+{
+    // Meshes small enough for 16 bit indices get them on the GPU. The CPU copy stays as IndexType.
+    if (numVertices <= 0xffff)
+    {
+        std::vector<uint16_t> shortIndices(numIndices);
+        for (uint32_t i = 0; i < numIndices; ++i)
+        {
+            shortIndices[i] = uint16_t(indices[i]);
+        }
+
+        outIndexType = VK_INDEX_TYPE_UINT16;
+        return new Buffer(BufferType::Index, numIndices * sizeof(uint16_t), debugName, shortIndices.data(), false);
+    }
+
+    outIndexType = VK_INDEX_TYPE_UINT32;
+    return new Buffer(BufferType::Index, numIndices * sizeof(uint32_t), debugName, indices, false);
+}
+
 void CreateStaticMeshResource(StaticMesh* staticMesh, bool hasColor, uint32_t numVertices, void* vertices, uint32_t numIndices, IndexType* indices)
 {
     StaticMeshResource* resource = staticMesh->GetResource();
 
     uint32_t vertexSize = hasColor ? sizeof(VertexColor) : sizeof(Vertex);
     resource->mVertexBuffer = new Buffer(BufferType::Vertex, numVertices * vertexSize, "StaticMesh Vertices", vertices, false);
-    resource->mIndexBuffer = new Buffer(BufferType::Index, numIndices * sizeof(IndexType), "StaticMesh Indices", indices, false);
+    resource->mIndexBuffer = CreateMeshIndexBuffer(numVertices, numIndices, indices, "StaticMesh Indices", resource->mIndexType);
 }
 
 void DestroyStaticMeshResource(StaticMesh* staticMesh)
@@ -1452,14 +1506,14 @@ void BindStaticMeshResource(StaticMesh* staticMesh)
     VkBuffer vertexBuffers[] = { resource->mVertexBuffer->Get() };
     VkDeviceSize offsets[] = { 0 };
     vkCmdBindVertexBuffers(cb, 0, 1, vertexBuffers, offsets);
-    vkCmdBindIndexBuffer(cb, resource->mIndexBuffer->Get(), 0, VK_INDEX_TYPE_UINT32);
+    vkCmdBindIndexBuffer(cb, resource->mIndexBuffer->Get(), 0, resource->mIndexType);
 }
 
 void CreateSkeletalMeshResource(SkeletalMesh* skeletalMesh, uint32_t numVertices, VertexSkinned* vertices, uint32_t numIndices, IndexType* indices)
 {
     SkeletalMeshResource* resource = skeletalMesh->GetResource();
     resource->mVertexBuffer = new Buffer(BufferType::Vertex, sizeof(VertexSkinned) * numVertices, "SkeletalMesh Vertices", vertices, true);
-    resource->mIndexBuffer = new Buffer(BufferType::Index, numIndices * sizeof(uint32_t), "SkeletalMesh Indices", indices, false);
+    resource->mIndexBuffer = CreateMeshIndexBuffer(numVertices, numIndices, indices, "SkeletalMesh Indices", resource->mIndexType);
 }
 
 void DestroySkeletalMeshResource(SkeletalMesh* skeletalMesh)
@@ -1488,7 +1542,7 @@ void BindSkeletalMeshResource(SkeletalMesh* skeletalMesh)
     VkDeviceSize offsets[] = { 0 };
     vkCmdBindVertexBuffers(cb, 0, 1, vertexBuffers, offsets);
 
-    vkCmdBindIndexBuffer(cb, resource->mIndexBuffer->Get(), 0, VK_INDEX_TYPE_UINT32);
+    vkCmdBindIndexBuffer(cb, resource->mIndexBuffer->Get(), 0, resource->mIndexType);
 }
 
 void BindSkeletalMeshResourceIndices(SkeletalMesh* skeletalMesh)
@@ -1496,7 +1550,7 @@ void BindSkeletalMeshResourceIndices(SkeletalMesh* skeletalMesh)
     SkeletalMeshResource* resource = skeletalMesh->GetResource();
 
     VkCommandBuffer cb = GetCommandBuffer();
-    vkCmdBindIndexBuffer(cb, resource->mIndexBuffer->Get(), 0, VK_INDEX_TYPE_UINT32);
+    vkCmdBindIndexBuffer(cb, resource->mIndexBuffer->Get(), 0, resource->mIndexType);
 }
 
 void BindGeometryDescriptorSet(StaticMesh3D* staticMeshComp)
@@ -1523,7 +1577,7 @@ void BindGeometryDescriptorSet(StaticMesh3D* staticMeshComp)
 
         DescriptorSet::Begin("StaticMesh3D DS")
             .WriteUniformBuffer(GD_UNIFORM_BUFFER, uniformBlock)
-            .WriteStorageBuffer(GD_INSTANCE_DATA_BUFFER, instResource->mInstanceDataBuffer)
+            .WriteStorageBuffer(GD_INSTANCE_DATA_BUFFER, instResource->mInstanceDataBuffers[GetFrameIndex()])
             //.WriteStoragebuffer(GD_INSTANCE_COLOR_BUFFER, instResource->mInstanceColorBuffer)
             .Build()
             .Bind(cb, 1);
@@ -1588,10 +1642,13 @@ void DestroyStaticMeshCompResource(StaticMesh3D* staticMeshComp)
     {
         InstancedMeshCompResource* instResource = ((InstancedMesh3D*)staticMeshComp)->GetInstancedMeshResource();
 
-        if (instResource->mInstanceDataBuffer != nullptr)
+        for (uint32_t i = 0; i < MAX_FRAMES; ++i)
         {
-            GetDestroyQueue()->Destroy(instResource->mInstanceDataBuffer);
-            instResource->mInstanceDataBuffer = nullptr;
+            if (instResource->mInstanceDataBuffers[i] != nullptr)
+            {
+                GetDestroyQueue()->Destroy(instResource->mInstanceDataBuffers[i]);
+                instResource->mInstanceDataBuffers[i] = nullptr;
+            }
         }
 
         if (instResource->mVertexColorBuffer != nullptr)
@@ -1599,6 +1656,9 @@ void DestroyStaticMeshCompResource(StaticMesh3D* staticMeshComp)
             GetDestroyQueue()->Destroy(instResource->mVertexColorBuffer);
             instResource->mVertexColorBuffer = nullptr;
         }
+
+        instResource->mInstanceCapacity = 0;
+        instResource->mDirty = true;
     }
 }
 
@@ -1854,47 +1914,123 @@ void DrawShadowMeshComp(ShadowMesh3D* shadowMeshComp)
     }
 }
 
-static void UpdateInstancedMeshResource(InstancedMesh3D* instancedMeshComp)
+static void GenerateInstanceBufferData(
+    InstancedMesh3D* instancedMeshComp,
+    uint32_t startSlot,
+    uint32_t numSlots,
+    std::vector<MeshInstanceBufferData>& outData)
 {
-    Camera3D* camera = instancedMeshComp->GetWorld()->GetActiveCamera();
+    const std::vector<uint32_t>& drawOrder = instancedMeshComp->GetInstanceDrawOrder();
+    OCT_ASSERT(startSlot + numSlots <= drawOrder.size());
 
+    outData.resize(numSlots);
+
+    for (uint32_t i = 0; i < numSlots; ++i)
+    {
+        uint32_t instanceIndex = drawOrder[startSlot + i];
+        outData[i] = {};
+        outData[i].mTransform = instancedMeshComp->CalculateInstanceTransform(instanceIndex);
+        outData[i].mInstanceIndex = instanceIndex;
+    }
+}
+
+static void UpdateInstancedMeshResource(InstancedMesh3D* instancedMeshComp)
+{
     InstancedMeshCompResource* instResource = instancedMeshComp->GetInstancedMeshResource();
     uint32_t numInstances = instancedMeshComp->GetNumInstances();
-    uint32_t totalNumVerts = instancedMeshComp->GetTotalVertexCount();
+    std::vector<MeshInstanceBufferData> meshInstanceBufferData;
 
-    // Destroy existing buffers
-    if (instResource->mInstanceDataBuffer != nullptr)
+    if (instResource->mDirty ||
+        numInstances > instResource->mInstanceCapacity)
     {
-        GetDestroyQueue()->Destroy(instResource->mInstanceDataBuffer);
-        instResource->mInstanceDataBuffer = nullptr;
-    }
+        // Destroy existing buffers
+        for (uint32_t i = 0; i < MAX_FRAMES; ++i)
+        {
+            if (instResource->mInstanceDataBuffers[i] != nullptr)
+            {
+                GetDestroyQueue()->Destroy(instResource->mInstanceDataBuffers[i]);
+                instResource->mInstanceDataBuffers[i] = nullptr;
+            }
+        }
+
+        if (instResource->mVertexColorBuffer != nullptr)
+        {
+            GetDestroyQueue()->Destroy(instResource->mVertexColorBuffer);
+            instResource->mVertexColorBuffer = nullptr;
+        }
+
+        // Leave room to grow when instances were appended, so the next appends are partial updates too.
+        uint32_t capacity = numInstances;
+        if (!instResource->mDirty)
+        {
+            capacity = glm::max(numInstances, instResource->mInstanceCapacity + instResource->mInstanceCapacity / 2);
+        }
+
+        // Allocate and fill the buffers. New buffers aren't in use by any frame, so all of them can be written now.
+        GenerateInstanceBufferData(instancedMeshComp, 0, numInstances, meshInstanceBufferData);
+
+        for (uint32_t i = 0; i < MAX_FRAMES; ++i)
+        {
+            instResource->mInstanceDataBuffers[i] = new Buffer(
+                BufferType::Storage,
+                sizeof(MeshInstanceBufferData) * capacity,
+                "InstanceDataBuffer",
+                nullptr,
+                false);
+
+            instResource->mInstanceDataBuffers[i]->Update(
+                meshInstanceBufferData.data(),
+                sizeof(MeshInstanceBufferData) * numInstances,
+                0);
+
+            instResource->mFrameDirtyStart[i] = 0;
+            instResource->mFrameDirtyEnd[i] = 0;
+        }
 
-    if (instResource->mVertexColorBuffer != nullptr)
+        instResource->mInstanceCapacity = capacity;
+        instResource->mDirtyStart = 0;
+        instResource->mDirtyEnd = 0;
+        instResource->mDirty = false;
+    }
+    else if (instResource->mDirtyStart < instResource->mDirtyEnd)
     {
-        GetDestroyQueue()->Destroy(instResource->mVertexColorBuffer);
-        instResource->mVertexColorBuffer = nullptr;
+        // Every frame's buffer needs the change, but each one can only be written once its frame comes around again.
+        for (uint32_t i = 0; i < MAX_FRAMES; ++i)
+        {
+            if (instResource->mFrameDirtyStart[i] >= instResource->mFrameDirtyEnd[i])
+            {
+                instResource->mFrameDirtyStart[i] = instResource->mDirtyStart;
+                instResource->mFrameDirtyEnd[i] = instResource->mDirtyEnd;
+            }
+            else
+            {
+                instResource->mFrameDirtyStart[i] = glm::min(instResource->mFrameDirtyStart[i], instResource->mDirtyStart);
+                instResource->mFrameDirtyEnd[i] = glm::max(instResource->mFrameDirtyEnd[i], instResource->mDirtyEnd);
+            }
+        }
+
+        instResource->mDirtyStart = 0;
+        instResource->mDirtyEnd = 0;
     }
 
-    // Generate instance data
-    const std::vector<MeshInstanceData>& meshInstanceData = instancedMeshComp->GetInstanceData();
-    std::vector<MeshInstanceBufferData> meshInstanceBufferData;
-    meshInstanceBufferData.resize(numInstances);
-    OCT_ASSERT(meshInstanceData.size() == numInstances);
+    uint32_t frameIndex = GetFrameIndex();
+    uint32_t dirtyStart = instResource->mFrameDirtyStart[frameIndex];
+    uint32_t dirtyEnd = glm::min(instResource->mFrameDirtyEnd[frameIndex], numInstances);
 
-    for (uint32_t i = 0; i < numInstances; ++i)
+    if (dirtyStart < dirtyEnd)
     {
-        meshInstanceBufferData[i].mTransform = instancedMeshComp->CalculateInstanceTransform(i);
-    }
+        // Only the changed slot range is copied in (through a staging buffer). The copy is submitted ahead of
+        // this frame's command buffer, and VulkanContext::BeginFrame() makes transfer writes visible to the draws.
+        GenerateInstanceBufferData(instancedMeshComp, dirtyStart, dirtyEnd - dirtyStart, meshInstanceBufferData);
 
-    // Allocate and fill the buffers
-    instResource->mInstanceDataBuffer = new Buffer(
-        BufferType::Storage,
-        sizeof(MeshInstanceBufferData) * numInstances,
-        "InstanceDataBuffer",
-        meshInstanceBufferData.data(),
-        false);
+        instResource->mInstanceDataBuffers[frameIndex]->Update(
+            meshInstanceBufferData.data(),
+            sizeof(MeshInstanceBufferData) * (dirtyEnd - dirtyStart),
+            sizeof(MeshInstanceBufferData) * dirtyStart);
+    }
 
-    instResource->mDirty = false;
+    instResource->mFrameDirtyStart[frameIndex] = 0;
+    instResource->mFrameDirtyEnd[frameIndex] = 0;
 }
 
 void DrawInstancedMeshComp(InstancedMesh3D* instancedMeshComp)
@@ -1905,15 +2041,13 @@ void DrawInstancedMeshComp(InstancedMesh3D* instancedMeshComp)
     InstancedMeshCompResource* instResource = instancedMeshComp->GetInstancedMeshResource();
 
     uint32_t numInstances = instancedMeshComp->GetNumInstances();
-    uint32_t totalNumVerts = instancedMeshComp->GetTotalVertexCount();
+    const std::vector<InstanceDrawRange>& visibleRanges = instancedMeshComp->GetVisibleInstanceRanges();
 
     if (mesh != nullptr &&
-        numInstances > 0)
+        numInstances > 0 &&
+        visibleRanges.size() > 0)
     {
-        if (instResource->mDirty)
-        {
-            UpdateInstancedMeshResource(instancedMeshComp);
-        }
+        UpdateInstancedMeshResource(instancedMeshComp);
 
         VkCommandBuffer cb = GetCommandBuffer();
 
@@ -1976,12 +2110,16 @@ void DrawInstancedMeshComp(InstancedMesh3D* instancedMeshComp)
         BindGeometryDescriptorSet(instancedMeshComp);
         BindMaterialDescriptorSet(material);
 
-        vkCmdDrawIndexed(cb,
-            mesh->GetNumIndices(),
-            numInstances,
-            0,
-            0,
-            0);
+        // One draw per run of visible chunks. firstInstance offsets gl_InstanceIndex into the instance buffer.
+        for (const InstanceDrawRange& range : visibleRanges)
+        {
+            vkCmdDrawIndexed(cb,
+                mesh->GetNumIndices(),
+                range.mCount,
+                0,
+                0,
+                range.mStart);
+        }
 
 #if EDITOR
         if (context->GetCurrentRenderPassId() == RenderPassId::HitCheck || 
@@ -2293,59 +2431,30 @@ void DrawQuad(Quad* quad)
 
 void CreateTextResource(Text* text)
 {
-    TextResource* resource = text->GetResource();
-
-    CreateTextResourceVertexBuffer(text);
-    UpdateTextResourceVertexData(text);
+    // Text vertices are streamed into the frame vertex buffer when drawn.
 }
 
 void DestroyTextResource(Text* text)
 {
-    TextResource* resource = text->GetResource();
-
-    DestroyTextResourceVertexBuffer(text);
-}
-
-void CreateTextResourceVertexBuffer(Text* text)
-{
-    TextResource* resource = text->GetResource();
-
-    if (text->GetText().size() > 0 && text->GetNumCharactersAllocated() > 0)
-    {
-        resource->mVertexBuffer = new MultiBuffer(BufferType::Vertex, text->GetNumCharactersAllocated() * TEXT_VERTS_PER_CHAR * sizeof(VertexUI), "Text Vertex Buffer");
-        resource->mNumBufferCharsAllocated = text->GetNumCharactersAllocated();
-    }
-}
-
-void DestroyTextResourceVertexBuffer(Text* text)
-{
-    TextResource* resource = text->GetResource();
 
-    if (resource->mVertexBuffer != nullptr)
-    {
-        GetDestroyQueue()->Destroy(resource->mVertexBuffer);
-        resource->mVertexBuffer = nullptr;
-        resource->mNumBufferCharsAllocated = 0;
-    }
 }
 
-void BindGeometryDescriptorSet(Text* text)
+static void BindTextDescriptorSet(Text* text, bool batched)
 {
     VkCommandBuffer cb = GetCommandBuffer();
-    TextResource* resource = text->GetResource();
 
     // Uniform Buffer
     int32_t fontSize = text->GetFont() ? text->GetFont()->GetSize() : 32;
     glm::vec2 justifiedOffset = text->GetJustifiedOffset();
 
     TextUniformData ubo = {};
-    ubo.mTransform = glm::mat4(text->GetTransform());
+    ubo.mTransform = batched ? glm::mat4(1.0f) : glm::mat4(text->GetTransform());
     ubo.mColor = text->GetColor();
-    ubo.mX = text->GetRect().mX + justifiedOffset.x;
-    ubo.mY = text->GetRect().mY + justifiedOffset.y;
+    ubo.mX = batched ? 0.0f : (text->GetRect().mX + justifiedOffset.x);
+    ubo.mY = batched ? 0.0f : (text->GetRect().mY + justifiedOffset.y);
     ubo.mCutoff = text->GetCutoff();
     ubo.mOutlineSize = text->GetOutlineSize();
-    ubo.mScale = text->GetScaledTextSize() / fontSize;
+    ubo.mScale = batched ? 1.0f : (text->GetScaledTextSize() / fontSize);
     ubo.mSoftness = text->GetSoftness();
     ubo.mPadding1 = 1337;
     ubo.mPadding2 = 1337;
@@ -2372,42 +2481,84 @@ void BindGeometryDescriptorSet(Text* text)
         .Bind(cb, 1);
 }
 
-void UpdateTextResourceVertexData(Text* text)
+void BindGeometryDescriptorSet(Text* text)
 {
-    TextResource* resource = text->GetResource();
-    uint32_t numCharsAllocated = text->GetNumCharactersAllocated();
-    if (resource->mNumBufferCharsAllocated < numCharsAllocated)
-    {
-        DestroyTextResourceVertexBuffer(text);
-        CreateTextResourceVertexBuffer(text);
-    }
+    BindTextDescriptorSet(text, false);
+}
 
-    if (resource->mVertexBuffer != nullptr)
-    {
-        // Copy over vertex array from system memory
-        resource->mVertexBuffer->Update(text->GetVertices(), sizeof(VertexUI) * TEXT_VERTS_PER_CHAR * numCharsAllocated);
-    }
+void UpdateTextResourceVertexData(Text* text)
+{
+    // Nothing to upload. Vertices are copied into the frame vertex buffer in DrawTextWidgets().
 }
 
 void DrawTextWidget(Text* text)
 {
-    TextResource* resource = text->GetResource();
+    DrawTextWidgets(&text, 1);
+}
+
+void DrawTextWidgets(Text* const* texts, uint32_t numTexts)
+{
+    uint32_t numVerts = 0;
 
-    if (text->GetText().size() > 0 && resource->mVertexBuffer != nullptr)
+    for (uint32_t i = 0; i < numTexts; ++i)
     {
-        VkCommandBuffer cb = GetCommandBuffer();
-        BindPipelineConfig(PipelineConfig::Text);
+        numVerts += texts[i]->GetNumVisibleCharacters() * TEXT_VERTS_PER_CHAR;
+    }
 
-        VkDeviceSize offset = 0;
-        VkBuffer vertexBuffer = resource->mVertexBuffer->Get();
-        vkCmdBindVertexBuffers(cb, 0, 1, &vertexBuffer, &offset);
+    if (numVerts == 0)
+        return;
 
-        GetVulkanContext()->CommitPipeline();
+    VertexBlock block = GetVulkanContext()->GetFrameVertexBuffer()->AllocBlock(numVerts * sizeof(VertexUI));
+
+    if (block.mData == nullptr)
+        return;
 
-        BindGeometryDescriptorSet(text);
+    VertexUI* dst = reinterpret_cast<VertexUI*>(block.mData);
+    bool batched = (numTexts > 1);
 
-        vkCmdDraw(cb, 6 * text->GetNumVisibleCharacters(), 1, 0, 0);
+    if (!batched)
+    {
+        memcpy(dst, texts[0]->GetVertices(), numVerts * sizeof(VertexUI));
     }
+    else
+    {
+        // Every widget in the batch shares a font and uniform data, so bake each widget's
+        // placement into the vertices and draw them all with an identity transform.
+        for (uint32_t t = 0; t < numTexts; ++t)
+        {
+            Text* text = texts[t];
+            const VertexUI* src = text->GetVertices();
+            uint32_t textVerts = text->GetNumVisibleCharacters() * TEXT_VERTS_PER_CHAR;
+
+            Font* font = text->GetFont();
+            int32_t fontSize = font ? font->GetSize() : 32;
+            float scale = text->GetScaledTextSize() / fontSize;
+            glm::vec2 offset = glm::vec2(text->GetRect().mX, text->GetRect().mY) + text->GetJustifiedOffset();
+            const glm::mat3& transform = text->GetTransform();
+
+            for (uint32_t v = 0; v < textVerts; ++v)
+            {
+                glm::vec2 pos = src[v].mPosition * scale + offset;
+                dst[v] = src[v];
+                dst[v].mPosition = glm::vec2(transform * glm::vec3(pos, 1.0f));
+            }
+
+            dst += textVerts;
+        }
+    }
+
+    VkCommandBuffer cb = GetCommandBuffer();
+    BindPipelineConfig(PipelineConfig::Text);
+
+    VkDeviceSize offset = block.mOffset;
+    VkBuffer vertexBuffer = block.mVertexBuffer->Get();
+    vkCmdBindVertexBuffers(cb, 0, 1, &vertexBuffer, &offset);
+
+    GetVulkanContext()->CommitPipeline();
+
+    BindTextDescriptorSet(texts[0], batched);
+
+    vkCmdDraw(cb, numVerts, 1, 0, 0);
 }
 
 void CreatePolyResource(Poly* poly)
@@ -59,7 +59,8 @@ void TransitionImageLayout(
 void CopyBuffer(
     VkBuffer srcBuffer,
     VkBuffer dstBuffer,
-    VkDeviceSize size);
+    VkDeviceSize size,
+    VkDeviceSize dstOffset = 0);
 
 void CopyBufferToImage(
     VkBuffer buffer,
@@ -164,11 +165,10 @@ void DrawQuad(Quad* quad);
 // Text
 void CreateTextResource(Text* text);
 void DestroyTextResource(Text* text);
-void CreateTextResourceVertexBuffer(Text* text);
-void DestroyTextResourceVertexBuffer(Text* text);
 void BindGeometryDescriptorSet(Text* text);
 void UpdateTextResourceVertexData(Text* text);
 void DrawTextWidget(Text* text);
+void DrawTextWidgets(Text* const* texts, uint32_t numTexts);
 
 // Poly
 void CreatePolyResource(Poly* poly);
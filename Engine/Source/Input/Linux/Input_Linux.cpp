@@ -6,7 +6,9 @@
 #include "Engine.h"
 #include "Log.h"
 
+#if !DEDICATED_SERVER
 #include <xcb/xcb.h>
+#endif
 
 #include <fcntl.h>
 #include <stdio.h>
@@ -190,11 +192,19 @@ void INP_SetCursorPos(int32_t x, int32_t y)
 
 void INP_ShowCursor(bool show)
 {
+#if !DEDICATED_SERVER
     SystemState& system = GetEngineState()->mSystem;
+
+    if (system.mXcbConnection == nullptr)
+    {
+        return;
+    }
+
     uint32_t mask = XCB_CW_CURSOR;
     uint32_t valueList = show ? XCB_NONE : system.mNullCursor;
     xcb_change_window_attributes (system.mXcbConnection, system.mXcbWindow, mask, &valueList);
     xcb_flush(system.mXcbConnection);
+#endif
 }
 
 void INP_LockCursor(bool lock)
@@ -206,9 +216,11 @@ void INP_LockCursor(bool lock)
 
 void INP_TrapCursor(bool trap)
 {
-    SystemState& system = GetEngineState()->mSystem;
     InputState& input = GetEngineState()->mInput;
 
+#if !DEDICATED_SERVER
+    SystemState& system = GetEngineState()->mSystem;
+
     if (system.mWindowHasFocus)
     {
         if (trap)
@@ -238,6 +250,7 @@ void INP_TrapCursor(bool trap)
             xcb_ungrab_pointer(system.mXcbConnection, XCB_CURRENT_TIME);
         }
     }
+#endif
 
     input.mCursorTrapped = trap;
 }
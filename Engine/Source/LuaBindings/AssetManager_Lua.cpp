@@ -83,6 +83,67 @@ int AssetManager_Lua::CreateAndRegisterAsset(lua_State* L)
     return 1;
 }
 
+int AssetManager_Lua::GetMemoryUsage(lua_State* L)
+{
+    AssetMemoryStats stats = AssetManager::Get()->GetMemoryStats();
+
+    // Returns cpu, gpu, and cached (evictable) megabytes.
+    lua_pushnumber(L, stats.mCpuBytes / double(1024 * 1024));
+    lua_pushnumber(L, stats.mGpuBytes / double(1024 * 1024));
+    lua_pushnumber(L, stats.mCachedBytes / double(1024 * 1024));
+    return 3;
+}
+
+int AssetManager_Lua::GetTypeMemoryUsage(lua_State* L)
+{
+    std::unordered_map<TypeId, AssetMemoryStats> typeStats = AssetManager::Get()->GetTypeMemoryStats();
+
+    // Returns a table keyed by asset type name.
+    lua_newtable(L);
+    int tableIdx = lua_gettop(L);
+
+    for (auto it = typeStats.begin(); it != typeStats.end(); ++it)
+    {
+        const AssetMemoryStats& stats = it->second;
+
+        if (stats.mNumAssets == 0)
+        {
+            continue;
+        }
+
+        lua_newtable(L);
+        int statIdx = lua_gettop(L);
+
+        lua_pushnumber(L, stats.mCpuBytes / double(1024 * 1024));
+        lua_setfield(L, statIdx, "cpu");
+        lua_pushnumber(L, stats.mGpuBytes / double(1024 * 1024));
+        lua_setfield(L, statIdx, "gpu");
+        lua_pushnumber(L, stats.mCachedBytes / double(1024 * 1024));
+        lua_setfield(L, statIdx, "cached");
+        lua_pushinteger(L, stats.mNumAssets);
+        lua_setfield(L, statIdx, "count");
+
+        lua_setfield(L, tableIdx, Asset::GetNameFromTypeId(it->first));
+    }
+
+    return 1;
+}
+
+int AssetManager_Lua::GetMemoryBudget(lua_State* L)
+{
+    uint64_t budget = AssetManager::Get()->GetMemoryBudget();
+
+    lua_pushnumber(L, budget / double(1024 * 1024));
+    return 1;
+}
+
+int AssetManager_Lua::SetMemoryBudget(lua_State* L)
+{
+    float budgetMb = CHECK_NUMBER(L, 1);
+
+    AssetManager::Get()->SetMemoryBudget(uint64_t(glm::max(budgetMb, 0.0f) * 1024 * 1024));
+    return 0;
+}
 
 void AssetManager_Lua::Bind()
 {
@@ -106,6 +167,14 @@ void AssetManager_Lua::Bind()
 
     REGISTER_TABLE_FUNC(L, tableIdx, CreateAndRegisterAsset);
 
+    REGISTER_TABLE_FUNC(L, tableIdx, GetMemoryUsage);
+
+    REGISTER_TABLE_FUNC(L, tableIdx, GetTypeMemoryUsage);
+
+    REGISTER_TABLE_FUNC(L, tableIdx, GetMemoryBudget);
+
+    REGISTER_TABLE_FUNC(L, tableIdx, SetMemoryBudget);
+
     lua_setglobal(L, ASSET_MANAGER_LUA_NAME);
     OCT_ASSERT(lua_gettop(L) == 0);
 
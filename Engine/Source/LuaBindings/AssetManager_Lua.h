@@ -15,6 +15,10 @@ struct AssetManager_Lua
     static int AsyncLoadAsset(lua_State* L);
     static int UnloadAsset(lua_State* L);
     static int CreateAndRegisterAsset(lua_State* L);
+    static int GetMemoryUsage(lua_State* L);
+    static int GetTypeMemoryUsage(lua_State* L);
+    static int GetMemoryBudget(lua_State* L);
+    static int SetMemoryBudget(lua_State* L);
 
     static void Bind();
     static void BindGlobalFunctions();
@@ -446,6 +446,31 @@ void BindCullMode()
     OCT_ASSERT(lua_gettop(L) == 0);
 }
 
+void BindTickGroup()
+{
+    lua_State* L = GetLua();
+    OCT_ASSERT(lua_gettop(L) == 0);
+
+    lua_newtable(L);
+    int tableIdx = lua_gettop(L);
+
+    lua_pushinteger(L, (int)TickGroup::PrePhysics);
+    lua_setfield(L, tableIdx, "PrePhysics");
+
+    lua_pushinteger(L, (int)TickGroup::PostPhysics);
+    lua_setfield(L, tableIdx, "PostPhysics");
+
+    lua_pushinteger(L, (int)TickGroup::Late);
+    lua_setfield(L, tableIdx, "Late");
+
+    lua_pushinteger(L, (int)TickGroup::Count);
+    lua_setfield(L, tableIdx, "Count");
+
+    lua_setglobal(L, "TickGroup");
+
+    OCT_ASSERT(lua_gettop(L) == 0);
+}
+
 void Misc_Lua::BindMisc()
 {
     BindBlendMode();
@@ -462,6 +487,7 @@ void Misc_Lua::BindMisc()
     BindNetConstants();
     BindAttenuationFunc();
     BindCullMode();
+    BindTickGroup();
 }
 
 #endif
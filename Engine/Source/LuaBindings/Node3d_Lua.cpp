@@ -303,6 +303,26 @@ int Node3D_Lua::GetUpVector(lua_State* L)
     return 1;
 }
 
+int Node3D_Lua::EnableTransformInterpolation(lua_State* L)
+{
+    Node3D* comp = CHECK_NODE_3D(L, 1);
+    bool value = CHECK_BOOLEAN(L, 2);
+
+    comp->EnableTransformInterpolation(value);
+
+    return 0;
+}
+
+int Node3D_Lua::IsTransformInterpolationEnabled(lua_State* L)
+{
+    Node3D* comp = CHECK_NODE_3D(L, 1);
+
+    bool ret = comp->IsTransformInterpolationEnabled();
+
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
 void Node3D_Lua::Bind()
 {
     lua_State* L = GetLua();
@@ -385,6 +405,10 @@ void Node3D_Lua::Bind()
 
     REGISTER_TABLE_FUNC(L, mtIndex, GetUpVector);
 
+    REGISTER_TABLE_FUNC(L, mtIndex, EnableTransformInterpolation);
+
+    REGISTER_TABLE_FUNC(L, mtIndex, IsTransformInterpolationEnabled);
+
     lua_pop(L, 1);
     OCT_ASSERT(lua_gettop(L) == 0);
 }
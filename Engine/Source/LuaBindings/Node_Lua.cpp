@@ -798,6 +798,29 @@ int Node_Lua::EnableLateTick(lua_State* L)
     return 0;
 }
 
+int Node_Lua::SetTickGroup(lua_State* L)
+{
+    Node* node = CHECK_NODE(L, 1);
+    TickGroup value = (TickGroup) CHECK_INTEGER(L, 2);
+
+    if (value < TickGroup::Count)
+    {
+        node->SetTickGroup(value);
+    }
+
+    return 0;
+}
+
+int Node_Lua::GetTickGroup(lua_State* L)
+{
+    Node* node = CHECK_NODE(L, 1);
+
+    TickGroup ret = node->GetTickGroup();
+
+    lua_pushinteger(L, (int)ret);
+    return 1;
+}
+
 int Node_Lua::InvokeNetFunc(lua_State* L)
 {
     Node* node = CHECK_NODE(L, 1);
@@ -974,6 +997,10 @@ void Node_Lua::Bind()
 
     REGISTER_TABLE_FUNC(L, mtIndex, EnableLateTick);
 
+    REGISTER_TABLE_FUNC(L, mtIndex, SetTickGroup);
+
+    REGISTER_TABLE_FUNC(L, mtIndex, GetTickGroup);
+
     REGISTER_TABLE_FUNC(L, mtIndex, InvokeNetFunc);
 
     REGISTER_TABLE_FUNC(L, mtIndex, CheckType);
@@ -90,6 +90,8 @@ struct Node_Lua
 
     static int IsLateTickEnabled(lua_State* L);
     static int EnableLateTick(lua_State* L);
+    static int SetTickGroup(lua_State* L);
+    static int GetTickGroup(lua_State* L);
 
     static int InvokeNetFunc(lua_State* L);
 
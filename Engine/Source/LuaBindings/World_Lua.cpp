@@ -13,6 +13,110 @@
 
 #if LUA_ENABLED
 
+static void GatherIgnoreObjects(lua_State* L, int arg, std::vector<btCollisionObject*>& outObjects)
+{
+    if (!lua_isnoneornil(L, arg))
+    {
+        CHECK_TABLE(L, arg);
+        Datum ignoreTable = LuaObjectToDatum(L, arg);
+
+        for (uint32_t i = 1; i <= ignoreTable.GetCount(); ++i)
+        {
+            RTTI* rtti = ignoreTable.GetPointerField(i);
+            Primitive3D* prim = rtti ? rtti->As<Primitive3D>() : nullptr;
+
+            if (prim && prim->GetRigidBody())
+            {
+                outObjects.push_back(prim->GetRigidBody());
+            }
+        }
+    }
+}
+
+// Reads a flat number array of { sx, sy, sz, ex, ey, ez, ... } segments.
+// Plain numbers avoid allocating a Vector userdata per ray on both sides of the call.
+static void GatherSegments(lua_State* L, int arg, const char* funcName, std::vector<glm::vec3>& outStarts, std::vector<glm::vec3>& outEnds)
+{
+    CHECK_TABLE(L, arg);
+    uint32_t count = (uint32_t)lua_rawlen(L, arg);
+
+    if (count % 6 != 0)
+    {
+        LogError("%s: segment array length must be a multiple of 6.", funcName);
+    }
+
+    uint32_t numSegments = count / 6;
+    outStarts.resize(numSegments);
+    outEnds.resize(numSegments);
+
+    for (uint32_t i = 0; i < numSegments; ++i)
+    {
+        float values[6];
+
+        for (uint32_t c = 0; c < 6; ++c)
+        {
+            lua_rawgeti(L, arg, i * 6 + c + 1);
+            values[c] = (float)lua_tonumber(L, -1);
+            lua_pop(L, 1);
+        }
+
+        outStarts[i] = glm::vec3(values[0], values[1], values[2]);
+        outEnds[i] = glm::vec3(values[3], values[4], values[5]);
+    }
+}
+
+// Pushes three parallel arrays: hit fractions (1 means nothing was hit), then flat { x, y, z, ... }
+// hit positions and hit normals.
+template<typename ResultType>
+static void PushBatchResults(lua_State* L, const std::vector<ResultType>& results)
+{
+    uint32_t numResults = (uint32_t)results.size();
+
+    lua_createtable(L, (int)numResults, 0);
+    for (uint32_t i = 0; i < numResults; ++i)
+    {
+        lua_pushnumber(L, results[i].mHitFraction);
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    lua_createtable(L, (int)numResults * 3, 0);
+    for (uint32_t i = 0; i < numResults; ++i)
+    {
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            lua_pushnumber(L, results[i].mHitPosition[c]);
+            lua_rawseti(L, -2, i * 3 + c + 1);
+        }
+    }
+
+    lua_createtable(L, (int)numResults * 3, 0);
+    for (uint32_t i = 0; i < numResults; ++i)
+    {
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            lua_pushnumber(L, results[i].mHitNormal[c]);
+            lua_rawseti(L, -2, i * 3 + c + 1);
+        }
+    }
+}
+
+static void PushTestResult(lua_State* L, glm::vec3 start, glm::vec3 end, Node* hitNode, glm::vec3 hitNormal, glm::vec3 hitPosition, float hitFraction)
+{
+    lua_newtable(L);
+    Vector_Lua::Create(L, start);
+    lua_setfield(L, -2, "start");
+    Vector_Lua::Create(L, end);
+    lua_setfield(L, -2, "end");
+    Node_Lua::Create(L, hitNode);
+    lua_setfield(L, -2, "hitNode");
+    Vector_Lua::Create(L, hitNormal);
+    lua_setfield(L, -2, "hitNormal");
+    Vector_Lua::Create(L, hitPosition);
+    lua_setfield(L, -2, "hitPosition");
+    lua_pushnumber(L, hitFraction);
+    lua_setfield(L, -2, "hitFraction");
+}
+
 int World_Lua::Create(lua_State* L, World* world)
 {
     if (world != nullptr)
@@ -282,41 +386,37 @@ int World_Lua::RayTest(lua_State* L)
     glm::vec3 end = CHECK_VECTOR(L, 3);
     uint8_t colMask = (uint8_t) CHECK_INTEGER(L, 4);
     std::vector<btCollisionObject*> ignoreObjects;
+    GatherIgnoreObjects(L, 5, ignoreObjects);
 
-    if (!lua_isnoneornil(L, 5))
-    {
-        CHECK_TABLE(L, 5);
-        Datum ignoreTable = LuaObjectToDatum(L, 5);
+    RayTestResult result;
+    world->RayTest(start, end, colMask, result, uint32_t(ignoreObjects.size()), ignoreObjects.data());
 
-        for (uint32_t i = 1; i <= ignoreTable.GetCount(); ++i)
-        {
-            RTTI* rtti = ignoreTable.GetPointerField(i);
-            Primitive3D* prim = rtti ? rtti->As<Primitive3D>() : nullptr;
+    PushTestResult(L, result.mStart, result.mEnd, result.mHitNode, result.mHitNormal, result.mHitPosition, result.mHitFraction);
+    return 1;
+}
 
-            if (prim && prim->GetRigidBody())
-            {
-                ignoreObjects.push_back(prim->GetRigidBody());
-            }
-        }
+int World_Lua::RayTestBatch(lua_State* L)
+{
+    World* world = CHECK_WORLD(L, 1);
+    std::vector<glm::vec3> starts;
+    std::vector<glm::vec3> ends;
+    GatherSegments(L, 2, "RayTestBatch", starts, ends);
+    uint8_t colMask = (uint8_t)CHECK_INTEGER(L, 3);
+    std::vector<btCollisionObject*> ignoreObjects;
+    GatherIgnoreObjects(L, 4, ignoreObjects);
+
+    std::vector<RayTestQuery> rays(starts.size());
+    for (uint32_t i = 0; i < rays.size(); ++i)
+    {
+        rays[i].mStart = starts[i];
+        rays[i].mEnd = ends[i];
     }
 
-    RayTestResult result;
-    world->RayTest(start, end, colMask, result, uint32_t(ignoreObjects.size()), ignoreObjects.data());
+    std::vector<RayTestResult> results;
+    world->RayTestBatch(rays, colMask, results, uint32_t(ignoreObjects.size()), ignoreObjects.data());
 
-    lua_newtable(L);
-    Vector_Lua::Create(L, result.mStart);
-    lua_setfield(L, -2, "start");
-    Vector_Lua::Create(L, result.mEnd);
-    lua_setfield(L, -2, "end");
-    Node_Lua::Create(L, result.mHitNode);
-    lua_setfield(L, -2, "hitNode");
-    Vector_Lua::Create(L, result.mHitNormal);
-    lua_setfield(L, -2, "hitNormal");
-    Vector_Lua::Create(L, result.mHitPosition);
-    lua_setfield(L, -2, "hitPosition");
-    lua_pushnumber(L, result.mHitFraction);
-    lua_setfield(L, -2, "hitFraction");
-    return 1;
+    PushBatchResults(L, results);
+    return 3;
 }
 
 int World_Lua::RayTestMulti(lua_State* L)
@@ -384,22 +484,47 @@ int World_Lua::SweepTest(lua_State* L)
     SweepTestResult result;
     world->SweepTest(primComp, start, end, colMask, result);
 
-    lua_newtable(L);
-    Vector_Lua::Create(L, result.mStart);
-    lua_setfield(L, -2, "start");
-    Vector_Lua::Create(L, result.mEnd);
-    lua_setfield(L, -2, "end");
-    Node_Lua::Create(L, result.mHitNode);
-    lua_setfield(L, -2, "hitNode");
-    Vector_Lua::Create(L, result.mHitNormal);
-    lua_setfield(L, -2, "hitNormal");
-    Vector_Lua::Create(L, result.mHitPosition);
-    lua_setfield(L, -2, "hitPosition");
-    lua_pushnumber(L, result.mHitFraction);
-    lua_setfield(L, -2, "hitFraction");
+    PushTestResult(L, result.mStart, result.mEnd, result.mHitNode, result.mHitNormal, result.mHitPosition, result.mHitFraction);
     return 1;
 }
 
+int World_Lua::SweepTestBatch(lua_State* L)
+{
+    World* world = CHECK_WORLD(L, 1);
+    Primitive3D* primComp = CHECK_PRIMITIVE_3D(L, 2);
+    std::vector<glm::vec3> starts;
+    std::vector<glm::vec3> ends;
+    GatherSegments(L, 3, "SweepTestBatch", starts, ends);
+    uint8_t colMask = (uint8_t)CHECK_INTEGER(L, 4);
+
+    btCollisionShape* shape = primComp->GetCollisionShape();
+    std::vector<SweepTestResult> results;
+
+    if (shape == nullptr ||
+        shape->isCompound() ||
+        !shape->isConvex())
+    {
+        LogError("SweepTestBatch is only supported for non-compound convex shapes.");
+    }
+    else
+    {
+        glm::quat rotation = primComp->GetRotationQuat();
+        std::vector<SweepTestQuery> sweeps(starts.size());
+        for (uint32_t i = 0; i < sweeps.size(); ++i)
+        {
+            sweeps[i].mStart = starts[i];
+            sweeps[i].mEnd = ends[i];
+            sweeps[i].mRotation = rotation;
+        }
+
+        btCollisionObject* primColObj = primComp->GetRigidBody();
+        world->SweepTestBatch(static_cast<btConvexShape*>(shape), sweeps, colMask, results, 1, &primColObj);
+    }
+
+    PushBatchResults(L, results);
+    return 3;
+}
+
 int World_Lua::LoadScene(lua_State* L)
 {
     World* world = CHECK_WORLD(L, 1);
@@ -442,6 +567,46 @@ int World_Lua::IsInternalEdgeSmoothingEnabled(lua_State* L)
     return 1;
 }
 
+int World_Lua::EnableMultithreadedPhysics(lua_State* L)
+{
+    World* world = CHECK_WORLD(L, 1);
+    bool value = CHECK_BOOLEAN(L, 2);
+
+    world->EnableMultithreadedPhysics(value);
+
+    return 0;
+}
+
+int World_Lua::IsMultithreadedPhysicsEnabled(lua_State* L)
+{
+    World* world = CHECK_WORLD(L, 1);
+
+    bool ret = world->IsMultithreadedPhysicsEnabled();
+
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+int World_Lua::SetFixedTickRate(lua_State* L)
+{
+    World* world = CHECK_WORLD(L, 1);
+    float rate = CHECK_NUMBER(L, 2);
+
+    world->SetFixedTickRate(rate);
+
+    return 0;
+}
+
+int World_Lua::GetFixedTickRate(lua_State* L)
+{
+    World* world = CHECK_WORLD(L, 1);
+
+    float ret = world->GetFixedTickRate();
+
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
 int World_Lua::SpawnParticle(lua_State* L)
 {
     World* world = CHECK_WORLD(L, 1);
@@ -508,6 +673,10 @@ void World_Lua::Bind()
 
     REGISTER_TABLE_FUNC(L, mtIndex, SweepTest);
 
+    REGISTER_TABLE_FUNC(L, mtIndex, RayTestBatch);
+
+    REGISTER_TABLE_FUNC(L, mtIndex, SweepTestBatch);
+
     REGISTER_TABLE_FUNC(L, mtIndex, LoadScene);
 
     REGISTER_TABLE_FUNC(L, mtIndex, QueueRootNode);
@@ -516,6 +685,14 @@ void World_Lua::Bind()
 
     REGISTER_TABLE_FUNC(L, mtIndex, IsInternalEdgeSmoothingEnabled);
 
+    REGISTER_TABLE_FUNC(L, mtIndex, EnableMultithreadedPhysics);
+
+    REGISTER_TABLE_FUNC(L, mtIndex, IsMultithreadedPhysicsEnabled);
+
+    REGISTER_TABLE_FUNC(L, mtIndex, SetFixedTickRate);
+
+    REGISTER_TABLE_FUNC(L, mtIndex, GetFixedTickRate);
+
     REGISTER_TABLE_FUNC(L, mtIndex, SpawnParticle);
 
     // Set the __index metamethod to itself
@@ -46,12 +46,18 @@ struct World_Lua
     static int RayTest(lua_State* L);
     static int RayTestMulti(lua_State* L);
     static int SweepTest(lua_State* L);
+    static int RayTestBatch(lua_State* L);
+    static int SweepTestBatch(lua_State* L);
 
     static int LoadScene(lua_State* L);
     static int QueueRootNode(lua_State* L);
 
     static int EnableInternalEdgeSmoothing(lua_State* L);
     static int IsInternalEdgeSmoothingEnabled(lua_State* L);
+    static int EnableMultithreadedPhysics(lua_State* L);
+    static int IsMultithreadedPhysicsEnabled(lua_State* L);
+    static int SetFixedTickRate(lua_State* L);
+    static int GetFixedTickRate(lua_State* L);
 
     static int SpawnParticle(lua_State* L);
 
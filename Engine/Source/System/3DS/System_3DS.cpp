@@ -72,6 +72,28 @@ bool SYS_DoesFileExist(const char* path, bool isAsset)
     return exists;
 }
 
+bool SYS_GetFileInfo(const char* path, uint64_t& outModTime, uint64_t& outSize)
+{
+    struct stat info;
+    bool exists = false;
+
+    outModTime = 0;
+    outSize = 0;
+
+    int32_t retStatus = stat(path, &info);
+
+    if (retStatus == 0 &&
+        !(info.st_mode & S_IFDIR))
+    {
+        exists = true;
+        // Only whole seconds are available here.
+        outModTime = uint64_t(info.st_mtime) * 1000000000;
+        outSize = uint64_t(info.st_size);
+    }
+
+    return exists;
+}
+
 void SYS_AcquireFileData(const char* path, bool isAsset, int32_t maxSize, char*& outData, uint32_t& outSize)
 {
     outData = nullptr;
@@ -112,6 +134,58 @@ void SYS_ReleaseFileData(char* data)
     }
 }
 
+FileObject* SYS_OpenFile(const char* path, bool isAsset)
+{
+    FileObject* retFile = nullptr;
+    FILE* file = fopen(path, "rb");
+
+    if (file != nullptr)
+    {
+        fseek(file, 0, SEEK_END);
+        int32_t fileSize = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        retFile = new FileObject();
+        retFile->mFile = file;
+        retFile->mSize = uint32_t(fileSize);
+    }
+    else
+    {
+        LogError("Failed to open file: %s", path);
+    }
+
+    return retFile;
+}
+
+void SYS_CloseFile(FileObject* file)
+{
+    if (file != nullptr)
+    {
+        if (file->mFile != nullptr)
+        {
+            fclose(file->mFile);
+            file->mFile = nullptr;
+        }
+
+        delete file;
+    }
+}
+
+bool SYS_ReadFileRange(FileObject* file, uint32_t offset, uint32_t size, char* outData)
+{
+    bool success = false;
+
+    if (file != nullptr &&
+        file->mFile != nullptr &&
+        uint64_t(offset) + size <= file->mSize)
+    {
+        success = (fseek(file->mFile, long(offset), SEEK_SET) == 0) &&
+            (size == 0 || fread(outData, size, 1, file->mFile) == 1);
+    }
+
+    return success;
+}
+
 std::string SYS_GetCurrentDirectoryPath()
 {
     char path[MAX_PATH_SIZE] = {};
@@ -307,6 +381,46 @@ void SYS_DestroyMutex(MutexObject* mutex)
     delete mutex;
 }
 
+SemaphoreObject* SYS_CreateSemaphore(uint32_t initialCount)
+{
+    SemaphoreObject* retSemaphore = new SemaphoreObject();
+
+    int32_t result = svcCreateSemaphore(retSemaphore, int32_t(initialCount), INT32_MAX);
+
+    if (result < 0)
+    {
+        LogError("Failed to create Semaphore");
+    }
+
+    return retSemaphore;
+}
+
+void SYS_WaitSemaphore(SemaphoreObject* semaphore)
+{
+    int32_t result = svcWaitSynchronization(*semaphore, UINT64_MAX);
+
+    if (result < 0)
+    {
+        LogError("Error waiting on semaphore");
+    }
+}
+
+void SYS_SignalSemaphore(SemaphoreObject* semaphore)
+{
+    int32_t count = 0;
+
+    if (svcReleaseSemaphore(&count, *semaphore, 1) < 0)
+    {
+        LogError("Error releasing semaphore");
+    }
+}
+
+void SYS_DestroySemaphore(SemaphoreObject* semaphore)
+{
+    svcCloseHandle(*semaphore);
+    delete semaphore;
+}
+
 void SYS_Sleep(uint32_t milliseconds)
 {
     svcSleepThread(milliseconds * 1000 * 1000);
@@ -14,6 +14,7 @@
 #include <string>
 #include <assert.h>
 #include <signal.h>
+#include <errno.h>
 
 #include <android/input.h>
 #include <android/window.h>
@@ -437,6 +438,27 @@ bool SYS_DoesFileExist(const char* path, bool isAsset)
     return exists;
 }
 
+bool SYS_GetFileInfo(const char* path, uint64_t& outModTime, uint64_t& outSize)
+{
+    struct stat info;
+    bool exists = false;
+
+    outModTime = 0;
+    outSize = 0;
+
+    int32_t retStatus = stat(path, &info);
+
+    if (retStatus == 0 &&
+        !(info.st_mode & S_IFDIR))
+    {
+        exists = true;
+        outModTime = uint64_t(info.st_mtim.tv_sec) * 1000000000 + uint64_t(info.st_mtim.tv_nsec);
+        outSize = uint64_t(info.st_size);
+    }
+
+    return exists;
+}
+
 void SYS_AcquireFileData(const char* path, bool isAsset, int32_t maxSize, char*& outData, uint32_t& outSize)
 {
     outData = nullptr;
@@ -508,6 +530,93 @@ void SYS_ReleaseFileData(char* data)
     }
 }
 
+FileObject* SYS_OpenFile(const char* path, bool isAsset)
+{
+    FileObject* retFile = nullptr;
+
+    if (isAsset)
+    {
+        AAssetManager* assetManager = GetEngineState()->mSystem.mState->activity->assetManager;
+        AAsset* asset = AAssetManager_open(assetManager, path, AASSET_MODE_RANDOM);
+
+        if (asset != nullptr)
+        {
+            retFile = new FileObject();
+            retFile->mAsset = asset;
+            retFile->mSize = uint32_t(AAsset_getLength(asset));
+        }
+        else
+        {
+            LogError("Could not open asset: %s", path);
+        }
+    }
+    else
+    {
+        FILE* file = fopen(path, "rb");
+
+        if (file != nullptr)
+        {
+            fseek(file, 0, SEEK_END);
+            int32_t fileSize = ftell(file);
+            fseek(file, 0, SEEK_SET);
+
+            retFile = new FileObject();
+            retFile->mFile = file;
+            retFile->mSize = uint32_t(fileSize);
+        }
+        else
+        {
+            LogError("Failed to open file: %s", path);
+        }
+    }
+
+    return retFile;
+}
+
+void SYS_CloseFile(FileObject* file)
+{
+    if (file != nullptr)
+    {
+        if (file->mAsset != nullptr)
+        {
+            AAsset_close(file->mAsset);
+            file->mAsset = nullptr;
+        }
+
+        if (file->mFile != nullptr)
+        {
+            fclose(file->mFile);
+            file->mFile = nullptr;
+        }
+
+        delete file;
+    }
+}
+
+bool SYS_ReadFileRange(FileObject* file, uint32_t offset, uint32_t size, char* outData)
+{
+    bool success = false;
+
+    if (file == nullptr ||
+        uint64_t(offset) + size > file->mSize)
+    {
+        return false;
+    }
+
+    if (file->mAsset != nullptr)
+    {
+        success = (AAsset_seek(file->mAsset, off_t(offset), SEEK_SET) == off_t(offset)) &&
+            (AAsset_read(file->mAsset, outData, size) == int32_t(size));
+    }
+    else if (file->mFile != nullptr)
+    {
+        success = (fseek(file->mFile, long(offset), SEEK_SET) == 0) &&
+            (size == 0 || fread(outData, size, 1, file->mFile) == 1);
+    }
+
+    return success;
+}
+
 std::string SYS_GetCurrentDirectoryPath()
 {
     char path[MAX_PATH_SIZE] = {};
@@ -732,6 +841,50 @@ void SYS_DestroyMutex(MutexObject* mutex)
     delete mutex;
 }
 
+SemaphoreObject* SYS_CreateSemaphore(uint32_t initialCount)
+{
+    SemaphoreObject* retSemaphore = new SemaphoreObject();
+    int status = sem_init(retSemaphore, 0, initialCount);
+
+    if (status != 0)
+    {
+        LogError("Failed to create Semaphore");
+    }
+
+    return retSemaphore;
+}
+
+void SYS_WaitSemaphore(SemaphoreObject* semaphore)
+{
+    int status = 0;
+
+    do
+    {
+        status = sem_wait(semaphore);
+    } while (status != 0 && errno == EINTR);
+
+    if (status != 0)
+    {
+        LogError("Failed to wait on semaphore");
+    }
+}
+
+void SYS_SignalSemaphore(SemaphoreObject* semaphore)
+{
+    int status = sem_post(semaphore);
+
+    if (status != 0)
+    {
+        LogError("Failed to signal semaphore");
+    }
+}
+
+void SYS_DestroySemaphore(SemaphoreObject* semaphore)
+{
+    sem_destroy(semaphore);
+    delete semaphore;
+}
+
 void SYS_Sleep(uint32_t milliseconds)
 {
     usleep(milliseconds * 1000);
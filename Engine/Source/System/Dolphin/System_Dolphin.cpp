@@ -111,6 +111,28 @@ bool SYS_DoesFileExist(const char* path, bool isAsset)
     return exists;
 }
 
+bool SYS_GetFileInfo(const char* path, uint64_t& outModTime, uint64_t& outSize)
+{
+    struct stat info;
+    bool exists = false;
+
+    outModTime = 0;
+    outSize = 0;
+
+    int32_t retStatus = stat(path, &info);
+
+    if (retStatus == 0 &&
+        !(info.st_mode & S_IFDIR))
+    {
+        exists = true;
+        // Only whole seconds are available here.
+        outModTime = uint64_t(info.st_mtime) * 1000000000;
+        outSize = uint64_t(info.st_size);
+    }
+
+    return exists;
+}
+
 void SYS_AcquireFileData(const char* path, bool isAsset, int32_t maxSize, char*& outData, uint32_t& outSize)
 {
     // Need to init fat in case opening the Engine.ini in OctPreInitialize()
@@ -156,6 +178,60 @@ void SYS_ReleaseFileData(char* data)
     }
 }
 
+FileObject* SYS_OpenFile(const char* path, bool isAsset)
+{
+    InitFAT();
+
+    FileObject* retFile = nullptr;
+    FILE* file = fopen(path, "rb");
+
+    if (file != nullptr)
+    {
+        fseek(file, 0, SEEK_END);
+        int32_t fileSize = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        retFile = new FileObject();
+        retFile->mFile = file;
+        retFile->mSize = uint32_t(fileSize);
+    }
+    else
+    {
+        LogError("Failed to open file: %s", path);
+    }
+
+    return retFile;
+}
+
+void SYS_CloseFile(FileObject* file)
+{
+    if (file != nullptr)
+    {
+        if (file->mFile != nullptr)
+        {
+            fclose(file->mFile);
+            file->mFile = nullptr;
+        }
+
+        delete file;
+    }
+}
+
+bool SYS_ReadFileRange(FileObject* file, uint32_t offset, uint32_t size, char* outData)
+{
+    bool success = false;
+
+    if (file != nullptr &&
+        file->mFile != nullptr &&
+        uint64_t(offset) + size <= file->mSize)
+    {
+        success = (fseek(file->mFile, long(offset), SEEK_SET) == 0) &&
+            (size == 0 || fread(outData, size, 1, file->mFile) == 1);
+    }
+
+    return success;
+}
+
 std::string SYS_GetCurrentDirectoryPath()
 {
     char path[MAX_PATH_SIZE] = {};
@@ -340,6 +416,36 @@ void SYS_DestroyMutex(MutexObject* mutex)
     delete mutex;
 }
 
+SemaphoreObject* SYS_CreateSemaphore(uint32_t initialCount)
+{
+    SemaphoreObject* retSemaphore = new SemaphoreObject();
+
+    int32_t status = LWP_SemInit(retSemaphore, initialCount, 0xffffffff);
+
+    if (status < 0)
+    {
+        LogError("Failed to create Semaphore");
+    }
+
+    return retSemaphore;
+}
+
+void SYS_WaitSemaphore(SemaphoreObject* semaphore)
+{
+    LWP_SemWait(*semaphore);
+}
+
+void SYS_SignalSemaphore(SemaphoreObject* semaphore)
+{
+    LWP_SemPost(*semaphore);
+}
+
+void SYS_DestroySemaphore(SemaphoreObject* semaphore)
+{
+    LWP_SemDestroy(*semaphore);
+    delete semaphore;
+}
+
 void SYS_Sleep(uint32_t milliseconds)
 {
     // Uh... not sure how to sleep for a given duration.
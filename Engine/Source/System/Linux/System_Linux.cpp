@@ -14,6 +14,7 @@
 #include <string>
 #include <assert.h>
 #include <signal.h>
+#include <errno.h>
 
 #if EDITOR
 #include "imgui.h"
@@ -26,6 +27,7 @@ extern int32_t gWarpCursorY;
 
 static std::string sClipboardString;
 
+#if !DEDICATED_SERVER
 static xcb_atom_t InternAtom(const char* atomId)
 {
     SystemState& system = GetEngineState()->mSystem;
@@ -261,9 +263,17 @@ void HandleXcbEvent(xcb_generic_event_t* event)
         break;
     }
 }
+#endif
 
 void SYS_Initialize()
 {
+#if !DEDICATED_SERVER
+    // A dedicated server is headless, so don't open a window or connect to X at all.
+    if (IsDedicatedServer())
+    {
+        return;
+    }
+
     EngineState& engine = *GetEngineState();
     SystemState& system = engine.mSystem;
 
@@ -410,12 +420,19 @@ void SYS_Initialize()
 #if EDITOR
     ImGui_ImplXcb_Init(system.mXcbWindow);
 #endif
+#endif
 }
 
 void SYS_Shutdown()
 {
+#if !DEDICATED_SERVER
     SystemState& system = GetEngineState()->mSystem;
 
+    if (system.mXcbConnection == nullptr)
+    {
+        return;
+    }
+
 #if EDITOR
     ImGui_ImplXcb_Shutdown();
 #endif
@@ -427,19 +444,25 @@ void SYS_Shutdown()
         xcb_destroy_window(system.mXcbConnection, system.mXcbWindow);
     }
     
-    if (system.mXcbConnection != nullptr)
-    {
-        xcb_disconnect(system.mXcbConnection);
-    }
+    xcb_disconnect(system.mXcbConnection);
+#endif
 }
 
 void SYS_Update()
 {
+#if !DEDICATED_SERVER
+    SystemState& system = GetEngineState()->mSystem;
+
+    // No window means no events or cursor to handle (dedicated server).
+    if (system.mXcbConnection == nullptr)
+    {
+        return;
+    }
+
     int32_t prevMouseX = 0;
     int32_t prevMouseY = 0;
     INP_GetMousePosition(prevMouseX, prevMouseY);
 
-    SystemState& system = GetEngineState()->mSystem;
     xcb_generic_event_t* event;
     while ((event = xcb_poll_for_event(system.mXcbConnection)))
     {
@@ -453,7 +476,6 @@ void SYS_Update()
     if (gWarpCursor)
     {
         warped = true;
-        SystemState& system = GetEngineState()->mSystem;
         xcb_warp_pointer(
             system.mXcbConnection,
             XCB_NONE,
@@ -504,6 +526,7 @@ void SYS_Update()
 #if EDITOR
     ImGui_ImplXcb_NewFrame();
 #endif
+#endif
 }
 
 // Files
@@ -523,6 +546,27 @@ bool SYS_DoesFileExist(const char* path, bool isAsset)
     return exists;
 }
 
+bool SYS_GetFileInfo(const char* path, uint64_t& outModTime, uint64_t& outSize)
+{
+    struct stat info;
+    bool exists = false;
+
+    outModTime = 0;
+    outSize = 0;
+
+    int32_t retStatus = stat(path, &info);
+
+    if (retStatus == 0 &&
+        !(info.st_mode & S_IFDIR))
+    {
+        exists = true;
+        outModTime = uint64_t(info.st_mtim.tv_sec) * 1000000000 + uint64_t(info.st_mtim.tv_nsec);
+        outSize = uint64_t(info.st_size);
+    }
+
+    return exists;
+}
+
 void SYS_AcquireFileData(const char* path, bool isAsset, int32_t maxSize, char*& outData, uint32_t& outSize)
 {
     outData = nullptr;
@@ -563,6 +607,58 @@ void SYS_ReleaseFileData(char* data)
     }
 }
 
+FileObject* SYS_OpenFile(const char* path, bool isAsset)
+{
+    FileObject* retFile = nullptr;
+    FILE* file = fopen(path, "rb");
+
+    if (file != nullptr)
+    {
+        fseek(file, 0, SEEK_END);
+        int32_t fileSize = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        retFile = new FileObject();
+        retFile->mFile = file;
+        retFile->mSize = uint32_t(fileSize);
+    }
+    else
+    {
+        LogError("Failed to open file: %s", path);
+    }
+
+    return retFile;
+}
+
+void SYS_CloseFile(FileObject* file)
+{
+    if (file != nullptr)
+    {
+        if (file->mFile != nullptr)
+        {
+            fclose(file->mFile);
+            file->mFile = nullptr;
+        }
+
+        delete file;
+    }
+}
+
+bool SYS_ReadFileRange(FileObject* file, uint32_t offset, uint32_t size, char* outData)
+{
+    bool success = false;
+
+    if (file != nullptr &&
+        file->mFile != nullptr &&
+        uint64_t(offset) + size <= file->mSize)
+    {
+        success = (fseek(file->mFile, long(offset), SEEK_SET) == 0) &&
+            (size == 0 || fread(outData, size, 1, file->mFile) == 1);
+    }
+
+    return success;
+}
+
 std::string SYS_GetCurrentDirectoryPath()
 {
     char path[MAX_PATH_SIZE] = {};
@@ -788,6 +884,50 @@ void SYS_DestroyMutex(MutexObject* mutex)
     delete mutex;
 }
 
+SemaphoreObject* SYS_CreateSemaphore(uint32_t initialCount)
+{
+    SemaphoreObject* retSemaphore = new SemaphoreObject();
+    int status = sem_init(retSemaphore, 0, initialCount);
+
+    if (status != 0)
+    {
+        LogError("Failed to create Semaphore");
+    }
+
+    return retSemaphore;
+}
+
+void SYS_WaitSemaphore(SemaphoreObject* semaphore)
+{
+    int status = 0;
+
+    do
+    {
+        status = sem_wait(semaphore);
+    } while (status != 0 && errno == EINTR);
+
+    if (status != 0)
+    {
+        LogError("Failed to wait on semaphore");
+    }
+}
+
+void SYS_SignalSemaphore(SemaphoreObject* semaphore)
+{
+    int status = sem_post(semaphore);
+
+    if (status != 0)
+    {
+        LogError("Failed to signal semaphore");
+    }
+}
+
+void SYS_DestroySemaphore(SemaphoreObject* semaphore)
+{
+    sem_destroy(semaphore);
+    delete semaphore;
+}
+
 void SYS_Sleep(uint32_t milliseconds)
 {
     usleep(milliseconds * 1000);
@@ -940,11 +1080,16 @@ void SYS_SetClipboardText(const std::string& str)
 {
     sClipboardString = str;
 
+#if !DEDICATED_SERVER
     SystemState& system = GetEngineState()->mSystem;
-    xcb_atom_t selection = InternAtom("CLIPBOARD");
-    xcb_set_selection_owner(system.mXcbConnection, system.mXcbWindow, selection, XCB_CURRENT_TIME);
-    xcb_flush(system.mXcbConnection);
 
+    if (system.mXcbConnection != nullptr)
+    {
+        xcb_atom_t selection = InternAtom("CLIPBOARD");
+        xcb_set_selection_owner(system.mXcbConnection, system.mXcbWindow, selection, XCB_CURRENT_TIME);
+        xcb_flush(system.mXcbConnection);
+    }
+#endif
 }
 
 std::string SYS_GetClipboardText()
@@ -958,10 +1103,16 @@ std::string SYS_GetClipboardText()
         return retStr;
     }
 
+#if !DEDICATED_SERVER
     SystemState& system = GetEngineState()->mSystem;
 
     xcb_connection_t* conn = system.mXcbConnection;
-    
+
+    if (conn == nullptr)
+    {
+        return retStr;
+    }
+
     xcb_atom_t selection = InternAtom("CLIPBOARD");
     xcb_atom_t target    = InternAtom("STRING");
     xcb_atom_t property  = InternAtom("OCTAVETEMP");
@@ -1020,6 +1171,7 @@ std::string SYS_GetClipboardText()
         delete [] clipboardData;
         clipboardData = nullptr;
     }
+#endif
 
     return retStr;
 }
@@ -1056,10 +1208,16 @@ int32_t SYS_GetPlatformTier()
 
 void SYS_SetWindowTitle(const char* title)
 {
+#if !DEDICATED_SERVER
     SystemState& system = GetEngineState()->mSystem;
-	xcb_change_property(system.mXcbConnection, XCB_PROP_MODE_REPLACE,
-		system.mXcbWindow, XCB_ATOM_WM_NAME, XCB_ATOM_STRING, 8,
-		strlen(title), title);
+
+    if (system.mXcbConnection != nullptr)
+    {
+        xcb_change_property(system.mXcbConnection, XCB_PROP_MODE_REPLACE,
+            system.mXcbWindow, XCB_ATOM_WM_NAME, XCB_ATOM_STRING, 8,
+            strlen(title), title);
+    }
+#endif
 }
 
 bool SYS_DoesWindowHaveFocus()
@@ -1085,6 +1243,12 @@ void SYS_SetFullscreen(bool fullscreen)
     {
         system.mFullscreen = fullscreen;
 
+#if !DEDICATED_SERVER
+        if (system.mXcbConnection == nullptr)
+        {
+            return;
+        }
+
         xcb_atom_t atomState = InternAtom("_NET_WM_STATE");
         xcb_atom_t atomFullscreen = InternAtom("_NET_WM_STATE_FULLSCREEN");
 
@@ -1099,6 +1263,7 @@ void SYS_SetFullscreen(bool fullscreen)
 
         xcb_send_event(system.mXcbConnection, 0, system.mXcbScreen->root, XCB_EVENT_MASK_SUBSTRUCTURE_NOTIFY, (char *)&ev);
         xcb_flush(system.mXcbConnection);
+#endif
     }
 }
 
@@ -1109,14 +1274,32 @@ bool SYS_IsFullscreen()
 
 void SYS_SetWindowRect(int32_t x, int32_t y, int32_t width, int32_t height)
 {
+#if !DEDICATED_SERVER
     SystemState& system = GetEngineState()->mSystem;
-    uint32_t values[] = { (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height };
-    xcb_configure_window(system.mXcbConnection, system.mXcbWindow, XCB_CONFIG_WINDOW_X | XCB_CONFIG_WINDOW_Y | XCB_CONFIG_WINDOW_WIDTH | XCB_CONFIG_WINDOW_HEIGHT, values);
+
+    if (system.mXcbConnection != nullptr)
+    {
+        uint32_t values[] = { (uint32_t)x, (uint32_t)y, (uint32_t)width, (uint32_t)height };
+        xcb_configure_window(system.mXcbConnection, system.mXcbWindow, XCB_CONFIG_WINDOW_X | XCB_CONFIG_WINDOW_Y | XCB_CONFIG_WINDOW_WIDTH | XCB_CONFIG_WINDOW_HEIGHT, values);
+    }
+#endif
 }
 
 void SYS_GetWindowRect(int32_t& outX, int32_t& outY, int32_t& outWidth, int32_t& outHeight)
 {
+    outX = 0;
+    outY = 0;
+    outWidth = 0;
+    outHeight = 0;
+
+#if !DEDICATED_SERVER
     SystemState& system = GetEngineState()->mSystem;
+
+    if (system.mXcbConnection == nullptr)
+    {
+        return;
+    }
+
     xcb_get_geometry_reply_t* geom = xcb_get_geometry_reply(system.mXcbConnection, xcb_get_geometry(system.mXcbConnection, system.mXcbWindow), NULL);
 
     /* Do something with the fields of geom */
@@ -1128,6 +1311,7 @@ void SYS_GetWindowRect(int32_t& outX, int32_t& outY, int32_t& outWidth, int32_t&
 
     free(geom);
     geom = nullptr;
+#endif
 }
 
 #endif
@@ -14,8 +14,13 @@ void SYS_Update();
 
 // Files
 bool SYS_DoesFileExist(const char* path, bool isAsset);
+// outModTime is in nanoseconds, at whatever resolution the platform's file system provides.
+bool SYS_GetFileInfo(const char* path, uint64_t& outModTime, uint64_t& outSize);
 void SYS_AcquireFileData(const char* path, bool isAsset, int32_t maxSize, char*& outData, uint32_t& outSize);
 void SYS_ReleaseFileData(char* data);
+FileObject* SYS_OpenFile(const char* path, bool isAsset);
+void SYS_CloseFile(FileObject* file);
+bool SYS_ReadFileRange(FileObject* file, uint32_t offset, uint32_t size, char* outData);
 std::string SYS_GetCurrentDirectoryPath();
 std::string SYS_GetAbsolutePath(const std::string& relativePath);
 void SYS_SetWorkingDirectory(const std::string& dirPath);
@@ -38,6 +43,10 @@ MutexObject* SYS_CreateMutex();
 void SYS_LockMutex(MutexObject* mutex);
 void SYS_UnlockMutex(MutexObject* mutex);
 void SYS_DestroyMutex(MutexObject* mutex);
+SemaphoreObject* SYS_CreateSemaphore(uint32_t initialCount);
+void SYS_WaitSemaphore(SemaphoreObject* semaphore);
+void SYS_SignalSemaphore(SemaphoreObject* semaphore);
+void SYS_DestroySemaphore(SemaphoreObject* semaphore);
 void SYS_Sleep(uint32_t milliseconds);
 
 // Time
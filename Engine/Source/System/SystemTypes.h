@@ -3,6 +3,7 @@
 #include "Constants.h"
 #include "Maths.h"
 #include <string>
+#include <stdio.h>
 
 #if PLATFORM_WINDOWS
 #include <Windows.h>
@@ -12,8 +13,11 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#if !DEDICATED_SERVER
 #include <xcb/xcb.h>
+#endif
 #include <pthread.h>
+#include <semaphore.h>
 #elif PLATFORM_ANDROID
 #include <stdio.h>
 #include <dirent.h>
@@ -21,6 +25,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <semaphore.h>
 #include <android/native_window.h>
 #include <android/native_activity.h>
 #include <android_native_app_glue.h>
@@ -39,18 +44,22 @@
 #if PLATFORM_WINDOWS
 typedef HANDLE ThreadObject;
 typedef HANDLE MutexObject;
+typedef HANDLE SemaphoreObject;
 typedef DWORD ThreadFuncRet;
 #elif (PLATFORM_LINUX || PLATFORM_ANDROID)
 typedef pthread_t ThreadObject;
 typedef pthread_mutex_t MutexObject;
+typedef sem_t SemaphoreObject;
 typedef void* ThreadFuncRet;
 #elif PLATFORM_DOLPHIN
 typedef lwp_t ThreadObject;
 typedef uint32_t MutexObject;
+typedef uint32_t SemaphoreObject;
 typedef void* ThreadFuncRet;
 #elif PLATFORM_3DS
 typedef Thread ThreadObject;
 typedef uint32_t MutexObject;
+typedef uint32_t SemaphoreObject;
 typedef void ThreadFuncRet;
 #endif
 
@@ -90,6 +99,16 @@ struct DirEntry
 #endif
 };
 
+// Handle for random access reads of a single file (e.g. an asset pack).
+struct FileObject
+{
+#if PLATFORM_ANDROID
+    AAsset* mAsset = nullptr;
+#endif
+    FILE* mFile = nullptr;
+    uint32_t mSize = 0;
+};
+
 struct SystemState
 {
 #if PLATFORM_WINDOWS
@@ -99,11 +118,13 @@ struct SystemState
     bool mWindowHasFocus = true;
     bool mFullscreen = false;
 #elif PLATFORM_LINUX
+#if !DEDICATED_SERVER
     xcb_connection_t* mXcbConnection = nullptr;
     xcb_screen_t* mXcbScreen = nullptr;
     xcb_window_t mXcbWindow = 0;
     xcb_intern_atom_reply_t* mAtomDeleteWindow = nullptr;
     xcb_cursor_t mNullCursor = XCB_NONE;
+#endif
     bool mWindowHasFocus = false;
     bool mFullscreen = false;
 #elif PLATFORM_ANDROID
@@ -249,6 +249,12 @@ void SYS_Initialize()
     HINSTANCE hInst = GetModuleHandle(NULL); // hInstance
     engineState->mSystem.mConnection = hInst;
 
+    // A dedicated server is headless, so there is no window to create.
+    if (IsDedicatedServer())
+    {
+        return;
+    }
+
     WNDCLASSEX win_class;
 
     char exeName[1024];
@@ -371,6 +377,28 @@ bool SYS_DoesFileExist(const char* path, bool isAsset)
     return exists;
 }
 
+bool SYS_GetFileInfo(const char* path, uint64_t& outModTime, uint64_t& outSize)
+{
+    WIN32_FILE_ATTRIBUTE_DATA info;
+    bool exists = false;
+
+    outModTime = 0;
+    outSize = 0;
+
+    if (GetFileAttributesExA(path, GetFileExInfoStandard, &info) &&
+        !(info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+    {
+        exists = true;
+
+        // FILETIME counts 100 nanosecond intervals.
+        uint64_t writeTime = uint64_t(info.ftLastWriteTime.dwLowDateTime) | (uint64_t(info.ftLastWriteTime.dwHighDateTime) << 32);
+        outModTime = writeTime * 100;
+        outSize = uint64_t(info.nFileSizeLow) | (uint64_t(info.nFileSizeHigh) << 32);
+    }
+
+    return exists;
+}
+
 void SYS_AcquireFileData(const char* path, bool isAsset, int32_t maxSize, char*& outData, uint32_t& outSize)
 {
     outData = nullptr;
@@ -411,6 +439,58 @@ void SYS_ReleaseFileData(char* data)
     }
 }
 
+FileObject* SYS_OpenFile(const char* path, bool isAsset)
+{
+    FileObject* retFile = nullptr;
+    FILE* file = fopen(path, "rb");
+
+    if (file != nullptr)
+    {
+        fseek(file, 0, SEEK_END);
+        int32_t fileSize = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        retFile = new FileObject();
+        retFile->mFile = file;
+        retFile->mSize = uint32_t(fileSize);
+    }
+    else
+    {
+        LogError("Failed to open file: %s", path);
+    }
+
+    return retFile;
+}
+
+void SYS_CloseFile(FileObject* file)
+{
+    if (file != nullptr)
+    {
+        if (file->mFile != nullptr)
+        {
+            fclose(file->mFile);
+            file->mFile = nullptr;
+        }
+
+        delete file;
+    }
+}
+
+bool SYS_ReadFileRange(FileObject* file, uint32_t offset, uint32_t size, char* outData)
+{
+    bool success = false;
+
+    if (file != nullptr &&
+        file->mFile != nullptr &&
+        uint64_t(offset) + size <= file->mSize)
+    {
+        success = (fseek(file->mFile, long(offset), SEEK_SET) == 0) &&
+            (size == 0 || fread(outData, size, 1, file->mFile) == 1);
+    }
+
+    return success;
+}
+
 std::string SYS_GetCurrentDirectoryPath()
 {
     char path[MAX_PATH_SIZE] = {};
@@ -741,6 +821,47 @@ void SYS_DestroyMutex(MutexObject* mutex)
     delete mutex;
 }
 
+SemaphoreObject* SYS_CreateSemaphore(uint32_t initialCount)
+{
+    SemaphoreObject* retSemaphore = new SemaphoreObject();
+
+    *retSemaphore = CreateSemaphore(
+        NULL,              // default security attributes
+        initialCount,      // initial count
+        LONG_MAX,          // maximum count
+        NULL);             // unnamed semaphore
+
+    if (*retSemaphore == 0)
+    {
+        LogError("Failed to create Semaphore");
+    }
+
+    return retSemaphore;
+}
+
+void SYS_WaitSemaphore(SemaphoreObject* semaphore)
+{
+    DWORD dwWaitResult = WaitForSingleObject(
+        *semaphore,  // handle to semaphore
+        INFINITE);  // no time-out interval
+
+    OCT_UNUSED(dwWaitResult);
+}
+
+void SYS_SignalSemaphore(SemaphoreObject* semaphore)
+{
+    if (!ReleaseSemaphore(*semaphore, 1, NULL))
+    {
+        LogError("Error releasing semaphore");
+    }
+}
+
+void SYS_DestroySemaphore(SemaphoreObject* semaphore)
+{
+    CloseHandle(*semaphore);
+    delete semaphore;
+}
+
 void SYS_Sleep(uint32_t milliseconds)
 {
     Sleep(milliseconds);